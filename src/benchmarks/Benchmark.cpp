@@ -0,0 +1,143 @@
+#include "Benchmark.hpp"
+#include "mesh/Mesh.hpp"
+#include "mesh/Vertex.hpp"
+#include "mesh/Edge.hpp"
+#include "mesh/Data.hpp"
+#include "math/constants.hpp"
+#include <Eigen/Core>
+#include <algorithm>
+#include <cmath>
+#include <iomanip>
+#include <numeric>
+#include <sstream>
+
+namespace precice {
+namespace benchmarks {
+
+namespace {
+
+/// Writes the elements of values as JSON array.
+template<typename VALUES_T>
+void writeArray ( std::ostream& out, const VALUES_T& values )
+{
+  out << '[';
+  for (size_t i=0; i < values.size(); i++){
+    out << (i > 0 ? ", " : "") << values[i];
+  }
+  out << ']';
+}
+
+double median ( std::vector<double> times )
+{
+  std::sort(times.begin(), times.end());
+  size_t half = times.size() / 2;
+  return times.size() % 2 == 1 ? times[half] : 0.5 * (times[half-1] + times[half]);
+}
+
+}
+
+void Report:: add
+(
+  Result        result,
+  std::ostream* out )
+{
+  if (out != nullptr && not result.times.empty()){
+    std::ostringstream parameters;
+    for (const auto& parameter : result.parameters){
+      parameters << ' ' << parameter.first << '=' << parameter.second;
+    }
+    *out << std::left << std::setw(56) << result.name << std::setw(30) << parameters.str()
+         << std::right << std::scientific << std::setprecision(3)
+         << median(result.times) << " s" << std::endl;
+    out->unsetf(std::ios::floatfield);
+  }
+  _results.push_back(std::move(result));
+}
+
+void Report:: write
+(
+  std::ostream&  out,
+  const Options& options,
+  int            processes ) const
+{
+  out << std::setprecision(9);
+  out << "{\n";
+  out << "  \"options\": {\"processes\": " << processes
+      << ", \"repetitions\": " << options.repetitions
+      << ", \"seed\": " << options.seed
+      << ", \"dense-limit\": " << options.denseLimit
+      << ", \"threads\": " << options.threads << "},\n";
+  out << "  \"results\": [";
+  for (size_t i=0; i < _results.size(); i++){
+    const Result& result = _results[i];
+    out << (i > 0 ? "," : "") << "\n    {\"name\": \"" << result.name << "\", \"parameters\": {";
+    for (size_t j=0; j < result.parameters.size(); j++){
+      out << (j > 0 ? ", " : "") << '"' << result.parameters[j].first << "\": "
+          << result.parameters[j].second;
+    }
+    out << "}, \"samples\": " << result.times.size();
+    if (not result.times.empty()){
+      double sum = std::accumulate(result.times.begin(), result.times.end(), 0.0);
+      out << ", \"min\": " << *std::min_element(result.times.begin(), result.times.end())
+          << ", \"median\": " << median(result.times)
+          << ", \"mean\": " << sum / result.times.size()
+          << ", \"max\": " << *std::max_element(result.times.begin(), result.times.end());
+    }
+    out << ", \"times\": ";
+    writeArray(out, result.times);
+    out << '}';
+  }
+  out << "\n  ]\n}\n";
+}
+
+const std::vector<Result>& Report:: results() const
+{
+  return _results;
+}
+
+mesh::PtrMesh createSurfaceMesh
+(
+  const std::string& name,
+  int                vertices,
+  double             offset )
+{
+  int n = std::max(2, (int) std::lround(std::sqrt((double) vertices)));
+  double h = 1.0 / (n - 1);
+  mesh::PtrMesh mesh(new mesh::Mesh(name, 3, false));
+  mesh->reserveVertices(n * n);
+  mesh->reserveEdges(3 * (n - 1) * (n - 1) + 2 * (n - 1));
+  mesh->reserveTriangles(2 * (n - 1) * (n - 1));
+  std::vector<mesh::Vertex*> grid;
+  grid.reserve(n * n);
+  for (int j=0; j < n; j++){
+    for (int i=0; i < n; i++){
+      double x = i * h + offset;
+      double y = j * h + offset;
+      double z = 0.1 * std::sin(2.0 * math::PI * x) * std::cos(2.0 * math::PI * y);
+      grid.push_back(&mesh->createVertex(Eigen::Vector3d(x, y, z)));
+    }
+  }
+  for (int j=0; j < n - 1; j++){
+    for (int i=0; i < n - 1; i++){
+      mesh::Vertex& v00 = *grid[j * n + i];
+      mesh::Vertex& v10 = *grid[j * n + i + 1];
+      mesh::Vertex& v01 = *grid[(j + 1) * n + i];
+      mesh::Vertex& v11 = *grid[(j + 1) * n + i + 1];
+      mesh::Edge& diagonal = mesh->createUniqueEdge(v10, v01);
+      mesh->createTriangle(mesh->createUniqueEdge(v00, v10), diagonal,
+                           mesh->createUniqueEdge(v01, v00));
+      mesh->createTriangle(mesh->createUniqueEdge(v10, v11),
+                           mesh->createUniqueEdge(v11, v01), diagonal);
+    }
+  }
+  for (mesh::Vertex& vertex : mesh->vertices()){
+    vertex.setGlobalIndex(vertex.getID());
+  }
+  mesh->createData("Scalar", 1);
+  mesh->createData("Vector", 3);
+  mesh->computeState();
+  mesh->allocateDataValues();
+  return mesh;
+}
+
+}} // namespace precice, benchmarks
@@ -0,0 +1,114 @@
+#pragma once
+
+#include "mesh/SharedPointer.hpp"
+#include <chrono>
+#include <ostream>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace precice {
+namespace benchmarks {
+
+/// Options of a run of precice-bench, see the usage of src/drivers/bench.cpp.
+struct Options
+{
+  /// Numbers of mesh vertices of the mesh and mapping benchmarks and of unknowns n of post-processing.
+  std::vector<int> sizes {1000, 10000};
+
+  /// Numbers of vertices exchanged by the M2N benchmarks.
+  std::vector<int> exchangeSizes {10000, 100000};
+
+  /// Numbers of columns m of QRFactorization and the quasi-Newton post-processings.
+  std::vector<int> columns {10, 50};
+
+  /// Number of timed runs of every benchmark case.
+  int repetitions = 5;
+
+  /// Seed of all random numbers, such that runs with equal options are comparable.
+  unsigned int seed = 1;
+
+  /// Sizes above this limit skip the dense RBF mappings and the explicit IMVJ Jacobian.
+  int denseLimit = 2000;
+
+  /// Threads of the mesh, mapping and post-processing benchmarks, see utils::Threads.
+  int threads = 1;
+};
+
+/// Timings of one benchmark case.
+struct Result
+{
+  /// Hierarchical name, e.g., mapping/nearest-neighbor/compute.
+  std::string name;
+
+  /// Parameters of the case, e.g., ("vertices", 1000).
+  std::vector<std::pair<std::string,int>> parameters;
+
+  /// Durations of the single runs in seconds.
+  std::vector<double> times;
+};
+
+/// Collects the results of all benchmarks and writes them as JSON.
+class Report
+{
+public:
+
+  /// Adds a result and prints a summary line of it to out, if out is not null.
+  void add ( Result result, std::ostream* out );
+
+  /**
+   * @brief Writes the options and all results as one JSON object.
+   *
+   * Every result holds its name, parameters, the number of samples and their
+   * minimum, median, mean and maximum in seconds.
+   */
+  void write ( std::ostream& out, const Options& options, int processes ) const;
+
+  const std::vector<Result>& results() const;
+
+private:
+
+  std::vector<Result> _results;
+};
+
+/// Returns the duration of running f once in seconds.
+template<typename FUNCTION_T>
+double measure ( FUNCTION_T f )
+{
+  auto start = std::chrono::steady_clock::now();
+  f();
+  return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+}
+
+/**
+ * @brief Creates a triangulated surface mesh in 3D with about the given number of vertices.
+ *
+ * The vertices form a structured grid over the unit square, which is bent to a
+ * sine wave in z-direction and shifted by offset in x- and y-direction. Every
+ * mesh gets a scalar data "Scalar" and a vector data "Vector" with allocated
+ * values. The vertices carry their IDs as global indices.
+ */
+mesh::PtrMesh createSurfaceMesh (
+  const std::string& name,
+  int                vertices,
+  double             offset );
+
+/// Benchmarks the creation of vertices, edges and triangles, Mesh::computeState() and a closest vertex search.
+void runMeshBenchmarks ( const Options& options, Report& report, std::ostream* out );
+
+/// Benchmarks computeMapping() and map() of all Mapping subclasses on two surface meshes.
+void runMappingBenchmarks ( const Options& options, Report& report, std::ostream* out );
+
+/// Benchmarks QRFactorization column updates and iterations and time steps of the IQN-ILS and IMVJ post-processings.
+void runPostProcessingBenchmarks ( const Options& options, Report& report, std::ostream* out );
+
+/**
+ * @brief Benchmarks data exchange between two participants through M2N.
+ *
+ * Has to be called by all ranks, which are split into two participants. Runs
+ * PointToPointCommunication and GatherScatterCommunication over MPI ports and,
+ * if enabled, sockets on localhost. Needs at least 4 processes.
+ */
+void runM2NBenchmarks ( const Options& options, Report& report, std::ostream* out );
+
+}} // namespace precice, benchmarks
@@ -0,0 +1,194 @@
+#include "Benchmark.hpp"
+
+#ifndef PRECICE_NO_MPI
+
+#include "com/MPIDirectCommunication.hpp"
+#include "com/MPIPortsCommunicationFactory.hpp"
+#include "com/SocketCommunicationFactory.hpp"
+#include "m2n/M2N.hpp"
+#include "m2n/GatherScatterComFactory.hpp"
+#include "m2n/PointToPointComFactory.hpp"
+#include "mesh/Mesh.hpp"
+#include "utils/MasterSlave.hpp"
+#include "utils/Parallel.hpp"
+#include <Eigen/Core>
+
+namespace precice {
+namespace benchmarks {
+
+namespace {
+
+using utils::MasterSlave;
+using utils::Parallel;
+
+/**
+ * @brief Exchanges data of the given number of vertices between the participants A and B.
+ *
+ * The first half of the ranks of the global communicator forms A, the second
+ * half B, each with its first rank as master. A owns consecutive blocks of
+ * vertices, B blocks shifted by half a block, such that every rank exchanges
+ * data with two remote ranks. One sample is a round trip, i.e., A sends and
+ * receives the values back from B.
+ */
+void exchange
+(
+  const std::string&                       name,
+  com::CommunicationFactory::SharedPointer comFactory,
+  bool                                     pointToPoint,
+  int                                      vertices,
+  const Options&                           options,
+  Report&                                  report,
+  std::ostream*                            out )
+{
+  int size = Parallel::getCommunicatorSize() / 2;
+  bool isA = Parallel::getProcessRank() < size;
+  int rank = isA ? Parallel::getProcessRank() : Parallel::getProcessRank() - size;
+  std::string participant = isA ? "A" : "B";
+
+  MasterSlave::_communication = com::Communication::SharedPointer(new com::MPIDirectCommunication());
+  MasterSlave::configure(rank, size);
+  if (MasterSlave::_masterMode){
+    MasterSlave::_communication->acceptConnection(participant + "Master", participant + "Slaves", 0, 1);
+    MasterSlave::_communication->setRankOffset(1);
+  }
+  else {
+    MasterSlave::_communication->requestConnection(participant + "Master", participant + "Slaves",
+                                                   rank - 1, size - 1);
+  }
+
+  mesh::PtrMesh mesh(new mesh::Mesh("Exchange", 3, false));
+  if (MasterSlave::_masterMode){
+    mesh->setGlobalNumberOfVertices(vertices);
+    int shift = isA ? 0 : vertices / (2 * size);
+    for (int owner=0; owner < size; owner++){
+      for (int i=owner * vertices / size; i < (owner + 1) * vertices / size; i++){
+        mesh->getVertexDistribution()[owner].push_back((i + shift) % vertices);
+      }
+    }
+  }
+  int localVertices = (rank + 1) * vertices / size - rank * vertices / size;
+
+  com::Communication::SharedPointer masterCom = comFactory->newCommunication();
+  m2n::DistributedComFactory::SharedPointer distrFactory;
+  if (pointToPoint){
+    distrFactory.reset(new m2n::PointToPointComFactory(comFactory));
+  }
+  else {
+    distrFactory.reset(new m2n::GatherScatterComFactory(masterCom));
+  }
+  m2n::M2N m2n(masterCom, distrFactory);
+  m2n.createDistributedCommunication(mesh);
+
+  Result connect {"m2n/" + name + "/connect", {{"vertices", vertices}, {"ranks", size}}, {}};
+  Parallel::synchronizeProcesses();
+  // The slaves connection uses other names than the masters, otherwise B could read
+  // the address file of the masters connection, before A has removed it
+  connect.times.push_back(measure([&](){
+    if (isA){
+      m2n.acceptMasterConnection("A", "B");
+      m2n.acceptSlavesConnection("ASlaves", "BSlaves");
+    }
+    else {
+      m2n.requestMasterConnection("A", "B");
+      m2n.requestSlavesConnection("ASlaves", "BSlaves");
+    }
+  }));
+
+  Result roundTrip {"m2n/" + name + "/round-trip", {{"vertices", vertices}, {"ranks", size}}, {}};
+  Eigen::VectorXd values = Eigen::VectorXd::Constant(localVertices, 1.0);
+  for (int run=0; run < options.repetitions + 1; run++){
+    Parallel::synchronizeProcesses();
+    double time = measure([&](){
+      if (isA){
+        m2n.send(values.data(), localVertices, mesh->getID(), 1);
+        m2n.receive(values.data(), localVertices, mesh->getID(), 1);
+      }
+      else {
+        m2n.receive(values.data(), localVertices, mesh->getID(), 1);
+        m2n.send(values.data(), localVertices, mesh->getID(), 1);
+      }
+    });
+    // The first run warms up connections and buffers
+    if (run > 0){
+      roundTrip.times.push_back(time);
+    }
+  }
+  m2n.closeConnection();
+
+  report.add(std::move(connect), out);
+  report.add(std::move(roundTrip), out);
+
+  MasterSlave::_communication.reset();
+  MasterSlave::_rank = Parallel::getProcessRank();
+  MasterSlave::_size = Parallel::getCommunicatorSize();
+  MasterSlave::_masterMode = false;
+  MasterSlave::_slaveMode = false;
+  Parallel::synchronizeProcesses();
+  Parallel::clearGroups();
+}
+
+}
+
+void runM2NBenchmarks
+(
+  const Options& options,
+  Report&        report,
+  std::ostream*  out )
+{
+  int size = Parallel::getCommunicatorSize();
+  if (size < 4){
+    if (out != nullptr){
+      *out << "Skipping M2N benchmarks, they need at least 4 processes" << std::endl;
+    }
+    return;
+  }
+  std::vector<int> ranks;
+  for (int rank=0; rank < size - size % 2; rank++){
+    ranks.push_back(rank);
+  }
+  Parallel::Communicator communicator = Parallel::getRestrictedCommunicator(ranks);
+  if (Parallel::getProcessRank() >= (int) ranks.size()){
+    return;
+  }
+  Parallel::setGlobalCommunicator(communicator);
+
+  std::vector<std::pair<std::string,com::CommunicationFactory::SharedPointer>> comFactories;
+  comFactories.push_back({"mpi", com::CommunicationFactory::SharedPointer(
+      new com::MPIPortsCommunicationFactory())});
+# ifndef PRECICE_NO_SOCKETS
+  comFactories.push_back({"sockets", com::CommunicationFactory::SharedPointer(
+      new com::SocketCommunicationFactory())});
+# endif // not PRECICE_NO_SOCKETS
+
+  for (int vertices : options.exchangeSizes){
+    for (const auto& comFactory : comFactories){
+      exchange("point-to-point/" + comFactory.first, comFactory.second, true,
+               vertices, options, report, out);
+      exchange("gather-scatter/" + comFactory.first, comFactory.second, false,
+               vertices, options, report, out);
+    }
+  }
+  Parallel::setGlobalCommunicator(Parallel::getCommunicatorWorld());
+}
+
+}} // namespace precice, benchmarks
+
+#else // PRECICE_NO_MPI
+
+namespace precice {
+namespace benchmarks {
+
+void runM2NBenchmarks
+(
+  const Options& options,
+  Report&        report,
+  std::ostream*  out )
+{
+  if (out != nullptr){
+    *out << "Skipping M2N benchmarks, preCICE was compiled without MPI" << std::endl;
+  }
+}
+
+}} // namespace precice, benchmarks
+
+#endif // not PRECICE_NO_MPI
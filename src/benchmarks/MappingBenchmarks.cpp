@@ -0,0 +1,106 @@
+#include "Benchmark.hpp"
+#include "mapping/Mapping.hpp"
+#include "mapping/NearestNeighborMapping.hpp"
+#include "mapping/NearestProjectionMapping.hpp"
+#include "mapping/RadialBasisFctMapping.hpp"
+#include "mapping/PetRadialBasisFctMapping.hpp"
+#include "mapping/impl/BasisFunctions.hpp"
+#include "mapping/SharedPointer.hpp"
+#include "mesh/Mesh.hpp"
+#include "mesh/Data.hpp"
+#include <cmath>
+#include <functional>
+#include <random>
+
+namespace precice {
+namespace benchmarks {
+
+namespace {
+
+using mapping::Mapping;
+
+/// A mapping to benchmark, created anew for every mesh size.
+struct MappingCase
+{
+  std::string name;
+
+  /// True, if the mapping solves a dense system, see Options::denseLimit.
+  bool dense;
+
+  /// Creates the mapping for meshes with the given vertex spacing.
+  std::function<mapping::PtrMapping(double)> create;
+};
+
+std::vector<MappingCase> getMappingCases()
+{
+  using namespace mapping;
+  const int dim = 3;
+  std::vector<MappingCase> cases;
+  cases.push_back({"nearest-neighbor/consistent", false, [](double){
+    return PtrMapping(new NearestNeighborMapping(Mapping::CONSISTENT, dim)); }});
+  cases.push_back({"nearest-neighbor/conservative", false, [](double){
+    return PtrMapping(new NearestNeighborMapping(Mapping::CONSERVATIVE, dim)); }});
+  cases.push_back({"nearest-projection/consistent", false, [](double){
+    return PtrMapping(new NearestProjectionMapping(Mapping::CONSISTENT, dim)); }});
+  cases.push_back({"rbf-thin-plate-splines/consistent", true, [](double){
+    return PtrMapping(new RadialBasisFctMapping<ThinPlateSplines>(
+        Mapping::CONSISTENT, dim, ThinPlateSplines(), false, false, false)); }});
+  cases.push_back({"rbf-compact-polynomial-c6/consistent", false, [](double spacing){
+    return PtrMapping(new RadialBasisFctMapping<CompactPolynomialC6>(
+        Mapping::CONSISTENT, dim, CompactPolynomialC6(5.0 * spacing), false, false, false)); }});
+# ifndef PRECICE_NO_PETSC
+  cases.push_back({"petrbf-thin-plate-splines/consistent", true, [](double){
+    return PtrMapping(new PetRadialBasisFctMapping<ThinPlateSplines>(
+        Mapping::CONSISTENT, dim, ThinPlateSplines(), false, false, false)); }});
+  cases.push_back({"petrbf-compact-polynomial-c6/consistent", false, [](double spacing){
+    return PtrMapping(new PetRadialBasisFctMapping<CompactPolynomialC6>(
+        Mapping::CONSISTENT, dim, CompactPolynomialC6(5.0 * spacing), false, false, false)); }});
+# endif // not PRECICE_NO_PETSC
+  return cases;
+}
+
+}
+
+void runMappingBenchmarks
+(
+  const Options& options,
+  Report&        report,
+  std::ostream*  out )
+{
+  for (int size : options.sizes){
+    // The output mesh is shifted by half a grid spacing, such that no vertices coincide
+    double spacing = 1.0 / (std::lround(std::sqrt((double) size)) - 1);
+    mesh::PtrMesh inMesh = createSurfaceMesh("MappingIn", size, 0.0);
+    mesh::PtrMesh outMesh = createSurfaceMesh("MappingOut", size, 0.5 * spacing);
+    const mesh::PtrData& inData = inMesh->data()[1];
+    const mesh::PtrData& outData = outMesh->data()[1];
+    std::mt19937 generator(options.seed);
+    std::uniform_real_distribution<double> distribution(-1.0, 1.0);
+    for (int i=0; i < inData->values().size(); i++){
+      inData->values()(i) = distribution(generator);
+    }
+
+    for (const MappingCase& mappingCase : getMappingCases()){
+      if (mappingCase.dense && size > options.denseLimit){
+        continue;
+      }
+      mapping::PtrMapping mapping = mappingCase.create(spacing);
+      mapping->setMeshes(inMesh, outMesh);
+      Result compute {"mapping/" + mappingCase.name + "/compute", {{"vertices", size}}, {}};
+      Result map {"mapping/" + mappingCase.name + "/map", {{"vertices", size}}, {}};
+      for (int run=0; run < options.repetitions; run++){
+        mapping->clear();
+        compute.times.push_back(measure([&](){
+          mapping->computeMapping();
+        }));
+        map.times.push_back(measure([&](){
+          mapping->map(inData->getID(), outData->getID());
+        }));
+      }
+      report.add(std::move(compute), out);
+      report.add(std::move(map), out);
+    }
+  }
+}
+
+}} // namespace precice, benchmarks
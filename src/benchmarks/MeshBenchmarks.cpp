@@ -0,0 +1,58 @@
+#include "Benchmark.hpp"
+#include "mesh/Mesh.hpp"
+#include "query/FindClosestVertex.hpp"
+#include <Eigen/Core>
+#include <random>
+
+namespace precice {
+namespace benchmarks {
+
+void runMeshBenchmarks
+(
+  const Options& options,
+  Report&        report,
+  std::ostream*  out )
+{
+  for (int size : options.sizes){
+    std::mt19937 generator(options.seed);
+    std::uniform_real_distribution<double> distribution(0.0, 1.0);
+    Eigen::MatrixXd coords(3, size);
+    for (int i=0; i < coords.size(); i++){
+      coords.data()[i] = distribution(generator);
+    }
+
+    Result vertices {"mesh/create-vertices", {{"vertices", size}}, {}};
+    Result surface {"mesh/create-surface", {{"vertices", size}}, {}};
+    Result state {"mesh/compute-state", {{"vertices", size}}, {}};
+    Result closest {"mesh/find-closest-vertex", {{"vertices", size}}, {}};
+    for (int run=0; run < options.repetitions; run++){
+      vertices.times.push_back(measure([&](){
+        mesh::Mesh mesh("Vertices", 3, false);
+        mesh.reserveVertices(size);
+        for (int i=0; i < size; i++){
+          mesh.createVertex(coords.col(i));
+        }
+      }));
+      mesh::PtrMesh mesh;
+      surface.times.push_back(measure([&](){
+        mesh = createSurfaceMesh("Surface", size, 0.0);
+      }));
+      state.times.push_back(measure([&](){
+        mesh->computeState();
+      }));
+      // linear scan over the coordinates of all vertices
+      Eigen::VectorXd point = Eigen::Vector3d(distribution(generator), distribution(generator),
+                                              distribution(generator));
+      closest.times.push_back(measure([&](){
+        query::FindClosestVertex find(point);
+        find(*mesh);
+      }));
+    }
+    report.add(std::move(vertices), out);
+    report.add(std::move(surface), out);
+    report.add(std::move(state), out);
+    report.add(std::move(closest), out);
+  }
+}
+
+}} // namespace precice, benchmarks
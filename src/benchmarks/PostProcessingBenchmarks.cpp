@@ -0,0 +1,200 @@
+#include "Benchmark.hpp"
+#include "cplscheme/CouplingData.hpp"
+#include "cplscheme/impl/BaseQNPostProcessing.hpp"
+#include "cplscheme/impl/ConstantPreconditioner.hpp"
+#include "cplscheme/impl/IQNILSPostProcessing.hpp"
+#include "cplscheme/impl/MVQNPostProcessing.hpp"
+#include "cplscheme/impl/QRFactorization.hpp"
+#include "mesh/Mesh.hpp"
+#include <Eigen/Core>
+#include <algorithm>
+#include <functional>
+#include <random>
+
+namespace precice {
+namespace benchmarks {
+
+namespace {
+
+using namespace cplscheme;
+
+Eigen::VectorXd randomVector ( int size, std::mt19937& generator )
+{
+  std::uniform_real_distribution<double> distribution(-1.0, 1.0);
+  Eigen::VectorXd vector(size);
+  for (int i=0; i < size; i++){
+    vector(i) = distribution(generator);
+  }
+  return vector;
+}
+
+impl::PtrPreconditioner newPreconditioner ( const std::vector<double>& factors )
+{
+  return impl::PtrPreconditioner(new impl::ConstantPreconditioner(factors));
+}
+
+/**
+ * @brief Times performPostProcessing() with m stored columns.
+ *
+ * The fixed-point iteration x = 0.5*x + b + r_k with random perturbations r_k
+ * never converges, hence the differences stay linearly independent and, after
+ * m iterations, every iteration replaces the oldest of m columns.
+ */
+std::vector<double> timePostProcessing
+(
+  impl::PostProcessing& postProcessing,
+  int                   n,
+  int                   m,
+  const Options&        options )
+{
+  std::mt19937 generator(options.seed);
+  mesh::PtrMesh mesh(new mesh::Mesh("PostProcessing", 3, false));
+  Eigen::VectorXd values = Eigen::VectorXd::Zero(n);
+  PtrCouplingData data(new CouplingData(&values, mesh, false, 1));
+  impl::PostProcessing::DataMap dataMap;
+  dataMap.insert(std::make_pair(0, data));
+  postProcessing.initialize(dataMap);
+
+  Eigen::VectorXd b = randomVector(n, generator);
+  std::vector<double> times;
+  for (int iteration=0; iteration < m + 1 + options.repetitions; iteration++){
+    const auto& x = data->oldValues.col(0);
+    values = 0.5 * x + b + 0.1 * randomVector(n, generator);
+    double time = measure([&](){
+      postProcessing.performPostProcessing(dataMap);
+    });
+    if (iteration > m){
+      times.push_back(time);
+    }
+    data->oldValues.col(0) = values;
+  }
+  return times;
+}
+
+/**
+ * @brief Times complete time steps, i.e., all iterations until convergence.
+ *
+ * Solves x = 0.5*x + U*U^T*x + b_t with a random low-rank U, applied without
+ * storing the matrix, and a right-hand side changing in time, such that the
+ * information of previous time steps is reused by the post-processing.
+ */
+std::vector<double> timeTimesteps
+(
+  impl::PostProcessing& postProcessing,
+  int                   n,
+  const Options&        options )
+{
+  const int rank = std::min(n, 10);
+  const int maxIterations = 30;
+  std::mt19937 generator(options.seed);
+  Eigen::MatrixXd U(n, rank);
+  for (int j=0; j < rank; j++){
+    U.col(j) = randomVector(n, generator);
+    U.col(j) *= 0.2 / U.col(j).norm();
+  }
+  mesh::PtrMesh mesh(new mesh::Mesh("PostProcessing", 3, false));
+  Eigen::VectorXd values = Eigen::VectorXd::Zero(n);
+  PtrCouplingData data(new CouplingData(&values, mesh, false, 1));
+  impl::PostProcessing::DataMap dataMap;
+  dataMap.insert(std::make_pair(0, data));
+  postProcessing.initialize(dataMap);
+
+  std::vector<double> times;
+  for (int timestep=0; timestep < options.repetitions; timestep++){
+    Eigen::VectorXd b = Eigen::VectorXd::Constant(n, 1.0 + 0.1 * timestep);
+    times.push_back(measure([&](){
+      for (int iteration=0; iteration < maxIterations; iteration++){
+        const auto& x = data->oldValues.col(0);
+        values = 0.5 * x + U * (U.transpose() * x) + b;
+        bool converged = (values - x).norm() < 1e-6 * values.norm();
+        if (converged || iteration == maxIterations - 1){
+          postProcessing.iterationsConverged(dataMap);
+        }
+        else {
+          postProcessing.performPostProcessing(dataMap);
+        }
+        data->oldValues.col(0) = values;
+        if (converged){
+          break;
+        }
+      }
+    }));
+  }
+  return times;
+}
+
+}
+
+void runPostProcessingBenchmarks
+(
+  const Options& options,
+  Report&        report,
+  std::ostream*  out )
+{
+  for (int n : options.sizes){
+    for (int m : options.columns){
+      if (m > n){
+        continue;
+      }
+      std::vector<std::pair<std::string,int>> parameters {{"n", n}, {"m", m}};
+
+      // One sample replaces all m columns, by popBack() and pushFront() as in the
+      // quasi-Newton post-processings
+      std::mt19937 generator(options.seed);
+      impl::QRFactorization qr;
+      qr.setGlobalRows(n);
+      for (int j=0; j < m; j++){
+        qr.pushFront(randomVector(n, generator));
+      }
+      Result qrUpdate {"post-processing/qr-factorization/update", parameters, {}};
+      for (int run=0; run < options.repetitions; run++){
+        std::vector<Eigen::VectorXd> columns;
+        for (int j=0; j < m; j++){
+          columns.push_back(randomVector(n, generator));
+        }
+        qrUpdate.times.push_back(measure([&](){
+          for (const Eigen::VectorXd& column : columns){
+            qr.popBack();
+            qr.pushFront(column);
+          }
+        }));
+      }
+      report.add(std::move(qrUpdate), out);
+
+      std::vector<int> dataIDs {0};
+      std::vector<double> factors {1.0};
+      impl::IQNILSPostProcessing iqnils(0.1, false, m, 0, impl::BaseQNPostProcessing::QR2FILTER,
+                                        1e-2, dataIDs, newPreconditioner(factors));
+      report.add({"post-processing/iqn-ils/iteration", parameters,
+                  timePostProcessing(iqnils, n, m, options)}, out);
+
+#     ifndef PRECICE_NO_MPI
+      if (n <= options.denseLimit){
+        impl::MVQNPostProcessing imvj(0.1, false, m, 0, impl::BaseQNPostProcessing::QR2FILTER,
+                                      1e-2, dataIDs, newPreconditioner(factors), false,
+                                      impl::MVQNPostProcessing::NO_RESTART, 8, 0, 1e-4, m);
+        report.add({"post-processing/imvj/iteration", parameters,
+                    timePostProcessing(imvj, n, m, options)}, out);
+        impl::MVQNPostProcessing imvjTimesteps(0.1, false, m, 0, impl::BaseQNPostProcessing::QR2FILTER,
+                                               1e-2, dataIDs, newPreconditioner(factors), false,
+                                               impl::MVQNPostProcessing::NO_RESTART, 8, 0, 1e-4, m);
+        report.add({"post-processing/imvj/timestep", parameters,
+                    timeTimesteps(imvjTimesteps, n, options)}, out);
+      }
+
+      impl::MVQNPostProcessing matrixFree(0.1, false, m, 0, impl::BaseQNPostProcessing::QR2FILTER,
+                                          1e-2, dataIDs, newPreconditioner(factors), false,
+                                          impl::MVQNPostProcessing::MATRIX_FREE, 8, 0, 1e-4, m);
+      report.add({"post-processing/imvj-matrix-free/iteration", parameters,
+                  timePostProcessing(matrixFree, n, m, options)}, out);
+      impl::MVQNPostProcessing matrixFreeTimesteps(0.1, false, m, 0, impl::BaseQNPostProcessing::QR2FILTER,
+                                                   1e-2, dataIDs, newPreconditioner(factors), false,
+                                                   impl::MVQNPostProcessing::MATRIX_FREE, 8, 0, 1e-4, m);
+      report.add({"post-processing/imvj-matrix-free/timestep", parameters,
+                  timeTimesteps(matrixFreeTimesteps, n, options)}, out);
+#     endif // not PRECICE_NO_MPI
+    }
+  }
+}
+
+}} // namespace precice, benchmarks
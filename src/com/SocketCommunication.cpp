@@ -9,6 +9,7 @@
 #include <boost/asio.hpp>
 #include <boost/bind.hpp>
 
+#include <algorithm>
 #include <sstream>
 
 using precice::utils::Publisher;
@@ -19,6 +20,12 @@ namespace com {
 
 namespace asio = boost::asio;
 
+class SocketCommunication::Socket : public TCP::socket {
+public:
+  explicit Socket(IOService& ioService)
+    : TCP::socket(ioService) {}
+};
+
 logging::Logger SocketCommunication::_log(
     "precice::com::SocketCommunication");
 
@@ -35,7 +42,13 @@ SocketCommunication::SocketCommunication(unsigned short portNumber,
     , _ioService(new IOService)
     , _sockets()
     , _work()
-    , _thread() {
+    , _thread()
+    , _nameRequester()
+    , _treeRank(0)
+    , _treeSize(0)
+    , _treeParent()
+    , _treeChildren()
+    , _treeChildRanks() {
   if (_addressDirectory.empty()) {
     _addressDirectory = ".";
   }
@@ -135,6 +148,10 @@ SocketCommunication::acceptConnection(std::string const& nameAcceptor,
 
     _remoteCommunicatorSize = remoteSize;
 
+    _nameRequester = nameRequester;
+    _treeRank = 0;
+    _treeSize = _remoteCommunicatorSize + 1;
+
     _sockets.resize(_remoteCommunicatorSize);
 
     _sockets[remoteRank] = socket;
@@ -354,6 +371,10 @@ SocketCommunication::requestConnection(std::string const& nameAcceptor,
                      << "size has to be 1!");
 
     _remoteCommunicatorSize = remoteSize;
+
+    _nameRequester = nameRequester;
+    _treeRank = requesterProcessRank + 1;
+    _treeSize = requesterCommunicatorSize + 1;
   } catch (std::exception& e) {
     preciceError("requestConnection()",
                  "Requesting connection to " << address
@@ -463,6 +484,11 @@ SocketCommunication::closeConnection() {
   if (not isConnected())
     return;
 
+  _treeParent.reset();
+  _treeChildren.reset();
+  _treeChildRanks.clear();
+  _treeSize = 0;
+
   if (_thread.joinable()) {
     _work.reset();
     _ioService->stop();
@@ -498,6 +524,233 @@ void
 SocketCommunication::finishReceivePackage() {
 }
 
+void
+SocketCommunication::reduceSum(double* itemsToSend,
+                               double* itemsToReceive,
+                               int size,
+                               int rankMaster) {
+  preciceTrace("reduceSum(double*)", size);
+
+  if (not isTree()) {
+    Communication::reduceSum(itemsToSend, itemsToReceive, size, rankMaster);
+    return;
+  }
+
+  assertion(rankMaster == 0, rankMaster);
+
+  std::vector<double> partialSum(size);
+
+  reduceTree(itemsToSend, partialSum.data(), size);
+}
+
+void
+SocketCommunication::reduceSum(double* itemsToSend,
+                               double* itemsToReceive,
+                               int size) {
+  preciceTrace("reduceSum(double*)", size);
+
+  if (not isTree()) {
+    Communication::reduceSum(itemsToSend, itemsToReceive, size);
+    return;
+  }
+
+  reduceTree(itemsToSend, itemsToReceive, size);
+}
+
+void
+SocketCommunication::reduceSum(int& itemsToSend,
+                               int& itemsToReceive,
+                               int rankMaster) {
+  preciceTrace("reduceSum(int)");
+
+  if (not isTree()) {
+    Communication::reduceSum(itemsToSend, itemsToReceive, rankMaster);
+    return;
+  }
+
+  assertion(rankMaster == 0, rankMaster);
+
+  int partialSum = 0;
+
+  reduceTree(&itemsToSend, &partialSum, 1);
+}
+
+void
+SocketCommunication::reduceSum(int& itemsToSend, int& itemsToReceive) {
+  preciceTrace("reduceSum(int)");
+
+  if (not isTree()) {
+    Communication::reduceSum(itemsToSend, itemsToReceive);
+    return;
+  }
+
+  reduceTree(&itemsToSend, &itemsToReceive, 1);
+}
+
+void
+SocketCommunication::allreduceSum(double* itemsToSend,
+                                  double* itemsToReceive,
+                                  int size,
+                                  int rankMaster) {
+  preciceTrace("allreduceSum(double*)", size);
+
+  if (not isTree()) {
+    Communication::allreduceSum(itemsToSend, itemsToReceive, size, rankMaster);
+    return;
+  }
+
+  assertion(rankMaster == 0, rankMaster);
+
+  reduceTree(itemsToSend, itemsToReceive, size);
+  broadcastTree(itemsToReceive, size);
+}
+
+void
+SocketCommunication::allreduceSum(double* itemsToSend,
+                                  double* itemsToReceive,
+                                  int size) {
+  preciceTrace("allreduceSum(double*)", size);
+
+  if (not isTree()) {
+    Communication::allreduceSum(itemsToSend, itemsToReceive, size);
+    return;
+  }
+
+  reduceTree(itemsToSend, itemsToReceive, size);
+  broadcastTree(itemsToReceive, size);
+}
+
+void
+SocketCommunication::allreduceSum(double& itemToSend,
+                                  double& itemToReceive,
+                                  int rankMaster) {
+  allreduceSum(&itemToSend, &itemToReceive, 1, rankMaster);
+}
+
+void
+SocketCommunication::allreduceSum(double& itemToSend, double& itemToReceive) {
+  allreduceSum(&itemToSend, &itemToReceive, 1);
+}
+
+void
+SocketCommunication::allreduceSum(int& itemToSend,
+                                  int& itemToReceive,
+                                  int rankMaster) {
+  preciceTrace("allreduceSum(int)");
+
+  if (not isTree()) {
+    Communication::allreduceSum(itemToSend, itemToReceive, rankMaster);
+    return;
+  }
+
+  assertion(rankMaster == 0, rankMaster);
+
+  reduceTree(&itemToSend, &itemToReceive, 1);
+  broadcastTree(&itemToReceive, 1);
+}
+
+void
+SocketCommunication::allreduceSum(int& itemToSend, int& itemToReceive) {
+  preciceTrace("allreduceSum(int)");
+
+  if (not isTree()) {
+    Communication::allreduceSum(itemToSend, itemToReceive);
+    return;
+  }
+
+  reduceTree(&itemToSend, &itemToReceive, 1);
+  broadcastTree(&itemToReceive, 1);
+}
+
+void
+SocketCommunication::broadcast(int* itemsToSend, int size) {
+  preciceTrace("broadcast(int*)", size);
+
+  if (not isTree()) {
+    Communication::broadcast(itemsToSend, size);
+    return;
+  }
+
+  broadcastTree(itemsToSend, size);
+}
+
+void
+SocketCommunication::broadcast(int* itemsToReceive,
+                               int size,
+                               int rankBroadcaster) {
+  preciceTrace("broadcast(int*)", size);
+
+  if (not isTree()) {
+    Communication::broadcast(itemsToReceive, size, rankBroadcaster);
+    return;
+  }
+
+  assertion(rankBroadcaster == 0, rankBroadcaster);
+
+  broadcastTree(itemsToReceive, size);
+}
+
+void
+SocketCommunication::broadcast(int itemToSend) {
+  broadcast(&itemToSend, 1);
+}
+
+void
+SocketCommunication::broadcast(int& itemToReceive, int rankBroadcaster) {
+  broadcast(&itemToReceive, 1, rankBroadcaster);
+}
+
+void
+SocketCommunication::broadcast(double* itemsToSend, int size) {
+  preciceTrace("broadcast(double*)", size);
+
+  if (not isTree()) {
+    Communication::broadcast(itemsToSend, size);
+    return;
+  }
+
+  broadcastTree(itemsToSend, size);
+}
+
+void
+SocketCommunication::broadcast(double* itemsToReceive,
+                               int size,
+                               int rankBroadcaster) {
+  preciceTrace("broadcast(double*)", size);
+
+  if (not isTree()) {
+    Communication::broadcast(itemsToReceive, size, rankBroadcaster);
+    return;
+  }
+
+  assertion(rankBroadcaster == 0, rankBroadcaster);
+
+  broadcastTree(itemsToReceive, size);
+}
+
+void
+SocketCommunication::broadcast(double itemToSend) {
+  broadcast(&itemToSend, 1);
+}
+
+void
+SocketCommunication::broadcast(double& itemToReceive, int rankBroadcaster) {
+  broadcast(&itemToReceive, 1, rankBroadcaster);
+}
+
+void
+SocketCommunication::broadcast(bool itemToSend) {
+  int item = itemToSend;
+  broadcast(&item, 1);
+}
+
+void
+SocketCommunication::broadcast(bool& itemToReceive, int rankBroadcaster) {
+  int item;
+  broadcast(&item, 1, rankBroadcaster);
+  itemToReceive = item;
+}
+
 void
 SocketCommunication::send(std::string const& itemToSend, int rankReceiver) {
   preciceTrace("send(string)", itemToSend, rankReceiver);
@@ -911,6 +1164,153 @@ SocketCommunication::aReceive(bool* itemToReceive, int rankSender) {
   return request;
 }
 
+bool
+SocketCommunication::isTree() {
+  return _treeSize > 0;
+}
+
+std::vector<int>
+SocketCommunication::getTreeChildren() {
+  std::vector<int> children;
+
+  // Binomial tree: the children of a node differ from it in one bit, which is
+  // lower than its lowest set bit. The root has the children 1, 2, 4, ...
+  int lowestBit = _treeRank & -_treeRank;
+
+  for (int bit = 1; (_treeRank == 0 || bit < lowestBit) && _treeRank + bit < _treeSize; bit <<= 1) {
+    children.push_back(_treeRank + bit);
+  }
+
+  return children;
+}
+
+void
+SocketCommunication::connectTree() {
+  // The root communicates with its children by the sockets of the connection
+  // itself, as do the children of the root with their parent.
+  if (_treeRank == 0 || _treeParent || _treeChildren)
+    return;
+
+  preciceTrace("connectTree()", _treeRank, _treeSize);
+
+  int parent = _treeRank & (_treeRank - 1);
+
+  if (parent != 0) {
+    _treeParent = std::make_shared<SocketCommunication>(
+        0, _reuseAddress, _networkName, _addressDirectory);
+    _treeParent->requestConnectionAsClient(
+        _nameRequester + "-tree-" + std::to_string(parent), _nameRequester);
+    _treeParent->send(_treeRank, 0);
+  }
+
+  std::vector<int> children = getTreeChildren();
+
+  if (not children.empty()) {
+    _treeChildren = std::make_shared<SocketCommunication>(
+        0, _reuseAddress, _networkName, _addressDirectory);
+    _treeChildren->acceptConnectionAsServer(
+        _nameRequester + "-tree-" + std::to_string(_treeRank),
+        _nameRequester,
+        children.size());
+
+    // Children connect in arbitrary order, but are served in ascending order
+    // to sum up deterministically.
+    _treeChildRanks.resize(children.size());
+
+    for (size_t rank = 0; rank < children.size(); ++rank) {
+      int child = -1;
+
+      _treeChildren->receive(child, rank);
+
+      auto position = std::find(children.begin(), children.end(), child);
+
+      assertion(position != children.end(), child);
+
+      _treeChildRanks[position - children.begin()] = rank;
+    }
+  }
+}
+
+template<typename T>
+void
+SocketCommunication::sendToTreeParent(T* items, int size) {
+  if (_treeParent) {
+    _treeParent->send(items, size, 0);
+  } else {
+    send(items, size, _rankOffset);
+  }
+}
+
+template<typename T>
+void
+SocketCommunication::receiveFromTreeParent(T* items, int size) {
+  if (_treeParent) {
+    _treeParent->receive(items, size, 0);
+  } else {
+    receive(items, size, _rankOffset);
+  }
+}
+
+template<typename T>
+void
+SocketCommunication::sendToTreeChild(T* items, int size, int child) {
+  if (_treeRank == 0) {
+    send(items, size, getTreeChildren()[child] - 1 + _rankOffset);
+  } else {
+    _treeChildren->send(items, size, _treeChildRanks[child]);
+  }
+}
+
+template<typename T>
+void
+SocketCommunication::receiveFromTreeChild(T* items, int size, int child) {
+  if (_treeRank == 0) {
+    receive(items, size, getTreeChildren()[child] - 1 + _rankOffset);
+  } else {
+    _treeChildren->receive(items, size, _treeChildRanks[child]);
+  }
+}
+
+template<typename T>
+void
+SocketCommunication::reduceTree(T* itemsToSend, T* itemsToReceive, int size) {
+  connectTree();
+
+  std::copy(itemsToSend, itemsToSend + size, itemsToReceive);
+
+  std::vector<T> childItems(size);
+
+  int childCount = getTreeChildren().size();
+
+  for (int child = 0; child < childCount; ++child) {
+    receiveFromTreeChild(childItems.data(), size, child);
+
+    for (int i = 0; i < size; ++i) {
+      itemsToReceive[i] += childItems[i];
+    }
+  }
+
+  if (_treeRank != 0) {
+    sendToTreeParent(itemsToReceive, size);
+  }
+}
+
+template<typename T>
+void
+SocketCommunication::broadcastTree(T* items, int size) {
+  connectTree();
+
+  if (_treeRank != 0) {
+    receiveFromTreeParent(items, size);
+  }
+
+  int childCount = getTreeChildren().size();
+
+  for (int child = 0; child < childCount; ++child) {
+    sendToTreeChild(items, size, child);
+  }
+}
+
 std::string
 SocketCommunication::getIpAddress() {
   preciceTrace("getIpAddress()");
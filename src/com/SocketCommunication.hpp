@@ -10,23 +10,18 @@
 #include <boost/asio/io_service.hpp>
 
 #include <condition_variable>
+#include <memory>
 #include <mutex>
 #include <set>
+#include <string>
 #include <thread>
+#include <vector>
 
 namespace boost {
 namespace asio {
-class io_service;
 namespace ip {
 class tcp;
 }
-template <typename Protocol>
-class stream_socket_service;
-template <typename Protocol, typename StreamSocketService>
-class basic_stream_socket;
-}
-namespace system {
-class error_code;
 }
 }
 
@@ -134,6 +129,61 @@ public:
    */
   virtual void finishReceivePackage();
 
+  using Communication::reduceSum;
+  using Communication::allreduceSum;
+  using Communication::broadcast;
+
+  /**
+   * @brief Collective operations along a binomial tree.
+   *
+   * The acceptor of requestConnection() is the root of the tree, the requester
+   * with rank i is node i+1. Inner nodes of the tree forward and accumulate
+   * values, such that a collective operation takes O(log P) communication
+   * steps instead of O(P) steps on the root. The connections between requesters,
+   * which are additionally required for the tree, are set up on the first
+   * collective operation. Connections established by acceptConnectionAsServer()
+   * and requestConnectionAsClient() use the linear default implementations.
+   */
+  virtual void reduceSum(double* itemsToSend, double* itemsToReceive, int size, int rankMaster);
+
+  virtual void reduceSum(double* itemsToSend, double* itemsToReceive, int size);
+
+  virtual void reduceSum(int& itemsToSend, int& itemsToReceive, int rankMaster);
+
+  virtual void reduceSum(int& itemsToSend, int& itemsToReceive);
+
+  virtual void allreduceSum(double* itemsToSend, double* itemsToReceive, int size, int rankMaster);
+
+  virtual void allreduceSum(double* itemsToSend, double* itemsToReceive, int size);
+
+  virtual void allreduceSum(double& itemToSend, double& itemToReceive, int rankMaster);
+
+  virtual void allreduceSum(double& itemToSend, double& itemToReceive);
+
+  virtual void allreduceSum(int& itemToSend, int& itemToReceive, int rankMaster);
+
+  virtual void allreduceSum(int& itemToSend, int& itemToReceive);
+
+  virtual void broadcast(int* itemsToSend, int size);
+
+  virtual void broadcast(int* itemsToReceive, int size, int rankBroadcaster);
+
+  virtual void broadcast(int itemToSend);
+
+  virtual void broadcast(int& itemToReceive, int rankBroadcaster);
+
+  virtual void broadcast(double* itemsToSend, int size);
+
+  virtual void broadcast(double* itemsToReceive, int size, int rankBroadcaster);
+
+  virtual void broadcast(double itemToSend);
+
+  virtual void broadcast(double& itemToReceive, int rankBroadcaster);
+
+  virtual void broadcast(bool itemToSend);
+
+  virtual void broadcast(bool& itemToReceive, int rankBroadcaster);
+
   /**
    * @brief Sends a std::string to process with given rank.
    */
@@ -275,8 +325,8 @@ private:
   std::shared_ptr<IOService> _ioService;
 
   typedef boost::asio::ip::tcp TCP;
-  typedef boost::asio::stream_socket_service<TCP> SocketService;
-  typedef boost::asio::basic_stream_socket<TCP, SocketService> Socket;
+  /// TCP socket, defined in the source file to keep Boost.Asio sockets out of this header.
+  class Socket;
   typedef std::shared_ptr<Socket> PtrSocket;
   std::vector<PtrSocket> _sockets;
 
@@ -286,10 +336,62 @@ private:
 
   std::thread _thread;
 
+  /// Name of the requesting participant, used to name the tree connections.
+  std::string _nameRequester;
+
+  /// Rank in the binomial tree of collective operations, 0 for the acceptor.
+  int _treeRank;
+
+  /// Number of nodes of the tree, 0 if collective operations are not done along a tree.
+  int _treeSize;
+
+  /// Connection to the parent in the tree, if that is not the root.
+  std::shared_ptr<SocketCommunication> _treeParent;
+
+  /// Connections to the children in the tree, if this is neither root nor leaf.
+  std::shared_ptr<SocketCommunication> _treeChildren;
+
+  /// Rank in _treeChildren of the i-th child in getTreeChildren().
+  std::vector<int> _treeChildRanks;
+
   bool isClient();
   bool isServer();
 
   std::string getIpAddress();
+
+  /// Returns true, if collective operations are done along the binomial tree.
+  bool isTree();
+
+  /// Returns the ranks of the children of this node in the tree, in ascending order.
+  std::vector<int> getTreeChildren();
+
+  /// Connects to the parent and the children in the tree, if not done already.
+  void connectTree();
+
+  template<typename T>
+  void sendToTreeParent(T* items, int size);
+
+  template<typename T>
+  void receiveFromTreeParent(T* items, int size);
+
+  template<typename T>
+  void sendToTreeChild(T* items, int size, int child);
+
+  template<typename T>
+  void receiveFromTreeChild(T* items, int size, int child);
+
+  /**
+   * @brief Sums up the items of the subtree of this node.
+   *
+   * The sum is written to itemsToReceive on the root and is sent to the parent
+   * on all other nodes.
+   */
+  template<typename T>
+  void reduceTree(T* itemsToSend, T* itemsToReceive, int size);
+
+  /// Receives items from the parent, if any, and sends them to all children.
+  template<typename T>
+  void broadcastTree(T* items, int size);
 };
 }
 } // namespace precice, com
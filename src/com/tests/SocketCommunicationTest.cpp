@@ -35,6 +35,12 @@ void SocketCommunicationTest:: run()
     }
     utils::Parallel::synchronizeProcesses(); // Necessary for sockets
   }
+  if ( utils::Parallel::getCommunicatorSize() >= 4 ){
+    if ( utils::Parallel::getProcessRank() < 4 ){
+      testMethod ( testCollectives );
+    }
+    utils::Parallel::synchronizeProcesses(); // Necessary for sockets
+  }
 }
 
 void SocketCommunicationTest:: testSendAndReceive()
@@ -170,6 +176,64 @@ void SocketCommunicationTest:: testParallelClient()
   }
 }
 
+void SocketCommunicationTest:: testCollectives()
+{
+  TRACE();
+  SocketCommunication com;
+  int rank = utils::Parallel::getProcessRank();
+  if ( rank == 0 ){
+    com.acceptConnection("master", "slaves", 0, 1);
+    com.setRankOffset(1);
+  }
+  else {
+    com.requestConnection("master", "slaves", rank-1, 3);
+  }
+  // Rank 3 is connected to the tree through rank 2
+  Eigen::Vector2d values(rank, 2 * rank);
+  Eigen::Vector2d sum = Eigen::Vector2d::Zero();
+  if ( rank == 0 ){
+    com.reduceSum(values.data(), sum.data(), 2);
+    validate ( math::equals(sum, Eigen::Vector2d(6, 12)) );
+  }
+  else {
+    com.reduceSum(values.data(), sum.data(), 2, 0);
+  }
+
+  sum = Eigen::Vector2d::Zero();
+  if ( rank == 0 ){
+    com.allreduceSum(values.data(), sum.data(), 2);
+  }
+  else {
+    com.allreduceSum(values.data(), sum.data(), 2, 0);
+  }
+  validate ( math::equals(sum, Eigen::Vector2d(6, 12)) );
+
+  int count = 1;
+  int totalCount = 0;
+  if ( rank == 0 ){
+    com.allreduceSum(count, totalCount);
+  }
+  else {
+    com.allreduceSum(count, totalCount, 0);
+  }
+  validateEquals ( totalCount, 4 );
+
+  Eigen::Vector3d broadcasted = Eigen::Vector3d::Zero();
+  bool flag = false;
+  if ( rank == 0 ){
+    broadcasted = Eigen::Vector3d(1, 2, 3);
+    com.broadcast(broadcasted.data(), 3);
+    com.broadcast(true);
+  }
+  else {
+    com.broadcast(broadcasted.data(), 3, 0);
+    com.broadcast(flag, 0);
+    validate ( flag );
+  }
+  validate ( math::equals(broadcasted, Eigen::Vector3d(1, 2, 3)) );
+  com.closeConnection();
+}
+
 }}} // namespace precice, com, tests
 
 #endif // not PRECICE_NO_SOCKETS
@@ -49,6 +49,9 @@ private:
 
   void testReceiveFromAnyClient();
 
+  /// Tests the tree-based collective operations with one acceptor and three requesters.
+  void testCollectives();
+
   //void testSendAndReceiveFromAnySender();
 };
 
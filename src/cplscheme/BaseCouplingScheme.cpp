@@ -8,7 +8,7 @@
 #include "impl/PostProcessing.hpp"
 #include "impl/ConvergenceMeasure.hpp"
 #include "io/TXTWriter.hpp"
-#include "io/TXTReader.hpp"
+#include "io/Checkpoint.hpp"
 #include <Eigen/Dense>
 #include <limits>
 #include <sstream>
@@ -57,6 +57,7 @@ BaseCouplingScheme:: BaseCouplingScheme
   _actions(),
   _sendData(),
   _receiveData (),
+  _pendingSends(),
   _iterationsWriter("iterations-unknown.txt"),
   _convergenceWriter("convergence-unknown.txt")
 {
@@ -121,6 +122,7 @@ BaseCouplingScheme::BaseCouplingScheme
   _actions(),
   _sendData(),
   _receiveData(),
+  _pendingSends(),
   _iterationsWriter("iterations-" + localParticipant + ".txt"),
   _convergenceWriter("convergence-" + localParticipant + ".txt")
 {
@@ -309,16 +311,71 @@ std::vector<int> BaseCouplingScheme:: sendData
   std::vector<int> sentDataIDs;
   assertion(m2n.get() != nullptr);
   assertion(m2n->isConnected());
+  waitForPendingSends();
+  startSend(m2n, _sendData);
   for (DataMap::value_type& pair : _sendData){
-    //std::cout<<"\nsend data id="<<pair.first<<": "<<*(pair.second->values)<<std::endl;
-    int size = pair.second->values->size();
-    m2n->send(pair.second->values->data(), size, pair.second->mesh->getID(), pair.second->dimension);
     sentDataIDs.push_back(pair.first);
   }
   DEBUG("Number of sent data sets = " << sentDataIDs.size());
   return sentDataIDs;
 }
 
+void BaseCouplingScheme:: startSend
+(
+  m2n::M2N::SharedPointer m2n,
+  DataMap&                data)
+{
+  // One batched send per mesh, in the order of the mesh IDs
+  std::map<int,std::vector<CouplingData*>> dataPerMesh = groupByMesh(data);
+  for (auto& meshData : dataPerMesh){
+    std::vector<double*> values;
+    std::vector<int> sizes;
+    std::vector<int> dimensions;
+    for (CouplingData* couplingData : meshData.second){
+      values.push_back(couplingData->values->data());
+      sizes.push_back(couplingData->values->size());
+      dimensions.push_back(couplingData->dimension);
+    }
+    _pendingSends.push_back(m2n->aSend(values, sizes, meshData.first, dimensions));
+  }
+}
+
+void BaseCouplingScheme:: receive
+(
+  m2n::M2N::SharedPointer m2n,
+  DataMap&                data)
+{
+  std::map<int,std::vector<CouplingData*>> dataPerMesh = groupByMesh(data);
+  for (auto& meshData : dataPerMesh){
+    std::vector<double*> values;
+    std::vector<int> sizes;
+    std::vector<int> dimensions;
+    for (CouplingData* couplingData : meshData.second){
+      values.push_back(couplingData->values->data());
+      sizes.push_back(couplingData->values->size());
+      dimensions.push_back(couplingData->dimension);
+    }
+    m2n->receive(values, sizes, meshData.first, dimensions);
+  }
+}
+
+std::map<int,std::vector<CouplingData*>> BaseCouplingScheme:: groupByMesh
+(
+  DataMap& data)
+{
+  std::map<int,std::vector<CouplingData*>> dataPerMesh;
+  for (DataMap::value_type& pair : data){
+    dataPerMesh[pair.second->mesh->getID()].push_back(pair.second.get());
+  }
+  return dataPerMesh;
+}
+
+void BaseCouplingScheme:: waitForPendingSends()
+{
+  com::Request::wait(_pendingSends);
+  _pendingSends.clear();
+}
+
 std::vector<int> BaseCouplingScheme:: receiveData
 (
   m2n::M2N::SharedPointer m2n)
@@ -328,10 +385,8 @@ std::vector<int> BaseCouplingScheme:: receiveData
   assertion(m2n.get() != nullptr);
   assertion(m2n->isConnected());
 
+  receive(m2n, _receiveData);
   for (DataMap::value_type & pair : _receiveData) {
-    int size = pair.second->values->size();
-    //std::cout<<"\nreceive data id="<<pair.first<<": "<<*(pair.second->values)<<std::endl;
-    m2n->receive(pair.second->values->data(), size, pair.second->mesh->getID(), pair.second->dimension);
     receivedDataIDs.push_back(pair.first);
   }
   DEBUG("Number of received data sets = " << receivedDataIDs.size());
@@ -382,6 +437,7 @@ void BaseCouplingScheme::finalize()
   checkCompletenessRequiredActions();
   preciceCheck(isInitialized(), "finalize()",
            "Called finalize() before initialize()!");
+  waitForPendingSends();
 }
 
 void BaseCouplingScheme:: setExtrapolationOrder
@@ -751,21 +807,14 @@ bool BaseCouplingScheme:: measureConvergence
     _convergenceWriter.writeData("Timestep", _timesteps);
     _convergenceWriter.writeData("Iteration", _iterations);
   }
+
+  evaluateConvergenceMeasures(designSpecifications, false);
   for(size_t i = 0; i < _convergenceMeasures.size(); i++) {
     ConvergenceMeasure& convMeasure = _convergenceMeasures[i];
 
     // only apply convergence measures for fine model optimization, i.e., coupling
     if(convMeasure.level > 0) continue;
 
-    assertion(convMeasure.data != nullptr);
-    assertion(convMeasure.measure.get() != nullptr);
-    const auto& oldValues = convMeasure.data->oldValues.col(0);
-    Eigen::VectorXd q = Eigen::VectorXd::Zero(convMeasure.data->values->size());
-    if(designSpecifications.find(convMeasure.dataID) != designSpecifications.end())
-      q = designSpecifications.at(convMeasure.dataID);
-
-    convMeasure.measure->measure(oldValues, *convMeasure.data->values, q);
-
     if(not utils::MasterSlave::_slaveMode){
       std::stringstream sstm;
       sstm << "resNorm(" <<i<< ")";
@@ -800,21 +849,13 @@ bool BaseCouplingScheme:: measureConvergenceCoarseModelOptimization
   bool allConverged = true;
   bool oneSuffices = false;
   assertion(_convergenceMeasures.size() > 0);
+  evaluateConvergenceMeasures(designSpecifications, true);
   for (ConvergenceMeasure& convMeasure : _convergenceMeasures) {
 
     // only apply convergence measures for coarse model optimization
     if(convMeasure.level == 0) continue;
 
     std::cout<<"  measure convergence coarse measure, id:"<<convMeasure.dataID<<std::endl;
-    assertion(convMeasure.data != nullptr);
-    assertion(convMeasure.measure.get() != nullptr);
-    const auto& oldValues = convMeasure.data->oldValues.col(0);
-    Eigen::VectorXd q = Eigen::VectorXd::Zero(convMeasure.data->values->size());
-    if(designSpecifications.find(convMeasure.dataID) != designSpecifications.end())
-      q = designSpecifications.at(convMeasure.dataID);
-
-    convMeasure.measure->measure(oldValues, *convMeasure.data->values, q);
-
     if (not convMeasure.measure->isConvergence()) {
       allConverged = false;
     }
@@ -831,6 +872,47 @@ bool BaseCouplingScheme:: measureConvergenceCoarseModelOptimization
 }
 
 
+void BaseCouplingScheme:: evaluateConvergenceMeasures
+(
+  std::map<int, Eigen::VectorXd>& designSpecifications,
+  bool                            coarseModelOptimization )
+{
+  preciceTrace(__func__, coarseModelOptimization);
+  // Gather the local parts of the squared norms of all measures, to sum them up
+  // over all ranks with a single allreduce.
+  std::vector<int> offsets(_convergenceMeasures.size() + 1, 0);
+  for(size_t i = 0; i < _convergenceMeasures.size(); i++) {
+    ConvergenceMeasure& convMeasure = _convergenceMeasures[i];
+    assertion(convMeasure.measure.get() != nullptr);
+    offsets[i+1] = offsets[i];
+    if((convMeasure.level > 0) == coarseModelOptimization){
+      offsets[i+1] += convMeasure.measure->getNumberOfSquaredNorms();
+    }
+  }
+  std::vector<double> squaredNorms(offsets.back(), 0.0);
+  for(size_t i = 0; i < _convergenceMeasures.size(); i++) {
+    ConvergenceMeasure& convMeasure = _convergenceMeasures[i];
+    if((convMeasure.level > 0) != coarseModelOptimization) continue;
+
+    assertion(convMeasure.data != nullptr);
+    const auto& oldValues = convMeasure.data->oldValues.col(0);
+    Eigen::VectorXd q = Eigen::VectorXd::Zero(convMeasure.data->values->size());
+    if(designSpecifications.find(convMeasure.dataID) != designSpecifications.end())
+      q = designSpecifications.at(convMeasure.dataID);
+
+    convMeasure.measure->computeSquaredNorms(oldValues, *convMeasure.data->values, q,
+                                             squaredNorms.data() + offsets[i]);
+  }
+
+  utils::MasterSlave::allreduceSum(squaredNorms);
+
+  for(size_t i = 0; i < _convergenceMeasures.size(); i++) {
+    ConvergenceMeasure& convMeasure = _convergenceMeasures[i];
+    if((convMeasure.level > 0) != coarseModelOptimization) continue;
+    convMeasure.measure->evaluate(squaredNorms.data() + offsets[i]);
+  }
+}
+
 void BaseCouplingScheme::initializeTXTWriters()
 {
   if(not utils::MasterSlave::_slaveMode){
@@ -906,39 +988,62 @@ void BaseCouplingScheme::advanceTXTWriters()
 }
 
 
-void BaseCouplingScheme:: exportState(const std::string& filenamePrefix ) const
+void BaseCouplingScheme:: exportState
+(
+  const std::string& prefix,
+  io::Checkpoint&    checkpoint ) const
 {
+  // The data is enumerated in the order of the data IDs, which do not change between runs
   if (not doesFirstStep()) {
-    io::TXTWriter writer(filenamePrefix + "_cplscheme.txt");
+    int index = 0;
     for (const BaseCouplingScheme::DataMap::value_type& dataMap : getSendData()) {
-      writer.write(dataMap.second->oldValues);
+      checkpoint.add(prefix + ":send:" + std::to_string(index++), dataMap.second->oldValues);
     }
+    index = 0;
     for (const BaseCouplingScheme::DataMap::value_type& dataMap : getReceiveData()) {
-      writer.write(dataMap.second->oldValues);
+      checkpoint.add(prefix + ":receive:" + std::to_string(index++), dataMap.second->oldValues);
     }
     if (_postProcessing.get() != nullptr) {
-      _postProcessing->exportState(writer);
+      _postProcessing->exportState(prefix + ":postprocessing", checkpoint);
     }
   }
 }
 
-void BaseCouplingScheme:: importState(const std::string& filenamePrefix)
+void BaseCouplingScheme:: importState
+(
+  const std::string&    prefix,
+  const io::Checkpoint& checkpoint )
 {
   if (not doesFirstStep()) {
-    io::TXTReader reader(filenamePrefix + "_cplscheme.txt");
+    int index = 0;
     for (BaseCouplingScheme::DataMap::value_type& dataMap : getSendData()) {
-      reader.read(dataMap.second->oldValues);
+      importOldValues(prefix + ":send:" + std::to_string(index++), checkpoint, *dataMap.second);
     }
+    index = 0;
     for (BaseCouplingScheme::DataMap::value_type& dataMap : getReceiveData()) {
-      reader.read(dataMap.second->oldValues);
-      reader.read(dataMap.second->oldValues);
+      importOldValues(prefix + ":receive:" + std::to_string(index++), checkpoint, *dataMap.second);
     }
     if (_postProcessing.get() != nullptr){
-      _postProcessing->importState(reader);
+      _postProcessing->importState(prefix + ":postprocessing", checkpoint);
     }
   }
 }
 
+void BaseCouplingScheme:: importOldValues
+(
+  const std::string&    name,
+  const io::Checkpoint& checkpoint,
+  CouplingData&         data )
+{
+  Eigen::MatrixXd oldValues;
+  checkpoint.get(name, oldValues);
+  CHECK(oldValues.rows() == data.oldValues.rows() && oldValues.cols() == data.oldValues.cols(),
+        "Old values of coupling data in the checkpoint have " << oldValues.rows() << " x "
+        << oldValues.cols() << " entries, but " << data.oldValues.rows() << " x "
+        << data.oldValues.cols() << " are expected!");
+  data.oldValues = oldValues;
+}
+
 
 void BaseCouplingScheme:: updateTimeAndIterations
 (
@@ -266,9 +266,9 @@ public:
   /// @brief Set a coupling iteration post-processing technique.
   void setIterationPostProcessing ( impl::PtrPostProcessing postProcessing );
 
-  virtual void exportState(const std::string& filenamePrefix) const;
+  virtual void exportState(const std::string& prefix, io::Checkpoint& checkpoint) const;
 
-  virtual void importState(const std::string& filenamePrefix);
+  virtual void importState(const std::string& prefix, const io::Checkpoint& checkpoint);
 
 protected:
 
@@ -296,9 +296,28 @@ protected:
     return _doesFirstStep;
   }
 
-  /// @brief Sends data sendDataIDs given in mapCouplingData with communication.
+  /**
+   * @brief Sends data sendDataIDs given in mapCouplingData with communication.
+   *
+   * The sends are only started, such that the transfer overlaps with the
+   * following computations. They are completed at the next call or in finalize().
+   */
   std::vector<int> sendData ( m2n::M2N::SharedPointer m2n );
 
+  /**
+   * @brief Starts to send the values of data, completed by waitForPendingSends().
+   *
+   * All data on the same mesh is sent in one batch, i.e., with one message per
+   * remote rank for a point-to-point communication.
+   */
+  void startSend ( m2n::M2N::SharedPointer m2n, DataMap& data );
+
+  /// @brief Receives the values of data, sent by startSend() of the remote participant.
+  void receive ( m2n::M2N::SharedPointer m2n, DataMap& data );
+
+  /// @brief Waits until all sends started by startSend() have completed.
+  void waitForPendingSends();
+
   /// @brief Receives data receiveDataIDs given in mapCouplingData with communication.
   std::vector<int> receiveData ( m2n::M2N::SharedPointer m2n );
 
@@ -455,6 +474,15 @@ protected:
   bool measureConvergenceCoarseModelOptimization(
       std::map<int, Eigen::VectorXd>& designSpecification);
 
+  /**
+   * @brief Performs the measurements of all fine or all coarse model convergence measures.
+   *
+   * The squared norms of all measures are summed up over all ranks with one allreduce.
+   */
+  void evaluateConvergenceMeasures(
+      std::map<int, Eigen::VectorXd>& designSpecification,
+      bool                            coarseModelOptimization);
+
   /**
    * @brief Sets up _dataStorage to store data values of last timestep.
    *
@@ -473,6 +501,9 @@ protected:
 
   void advanceTXTWriters();
 
+  /// Sets the old values of data to those of the checkpoint entry name.
+  static void importOldValues(const std::string& name, const io::Checkpoint& checkpoint, CouplingData& data);
+
   void updateTimeAndIterations(bool convergence, bool convergenceCoarseOptimization = true);
 
 
@@ -569,6 +600,9 @@ private:
   /// Map from data ID -> all receive data with that ID
   DataMap _receiveData;
 
+  /// Requests of sends started by startSend(), which might not have completed yet.
+  std::vector<com::Request::SharedPointer> _pendingSends;
+
   /// Responsible for monitoring iteration count over timesteps.
   io::TXTTableWriter _iterationsWriter;
 
@@ -577,6 +611,9 @@ private:
 
   int getVertexOffset(std::map<int,int>& vertexDistribution, int rank, int dim);
 
+  /// Returns the coupling data per mesh ID, in the order of the data IDs.
+  static std::map<int,std::vector<CouplingData*>> groupByMesh ( DataMap& data );
+
 
 };
 
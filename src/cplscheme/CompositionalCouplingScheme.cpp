@@ -390,28 +390,30 @@ std::string CompositionalCouplingScheme:: printCouplingState() const
 
 void CompositionalCouplingScheme:: exportState
 (
-  const std::string& filenamePrefix ) const
+  const std::string& prefix,
+  io::Checkpoint&    checkpoint ) const
 {
   preciceTrace("exportState()");
   int enumerator = 0;
   for (Scheme scheme : _couplingSchemes) {
     std::ostringstream stream;
-    stream << filenamePrefix << "_" << enumerator;
-    scheme.scheme->exportState(stream.str());
+    stream << prefix << "_" << enumerator;
+    scheme.scheme->exportState(stream.str(), checkpoint);
     enumerator++;
   }
 }
 
 void CompositionalCouplingScheme:: importState
 (
-  const std::string& filenamePrefix )
+  const std::string&    prefix,
+  const io::Checkpoint& checkpoint )
 {
   preciceTrace("importState()");
   int enumerator = 0;
   for (Scheme scheme : _couplingSchemes) {
     std::ostringstream stream;
-    stream << filenamePrefix << "_" << enumerator;
-    scheme.scheme->importState(stream.str());
+    stream << prefix << "_" << enumerator;
+    scheme.scheme->importState(stream.str(), checkpoint);
     enumerator++;
   }
 }
@@ -267,18 +267,18 @@ public:
   virtual std::string printCouplingState() const;
 
   /**
-   * @brief Exports the state of the coupling scheme to file/s.
+   * @brief Adds the states of all coupling schemes to checkpoint.
    *
    * Used for checkpointing.
    */
-  virtual void exportState(const std::string& filenamePrefix) const;
+  virtual void exportState(const std::string& prefix, io::Checkpoint& checkpoint) const;
 
   /**
-   * @brief Imports the state of the coupling scheme from file/s.
+   * @brief Restores the states of all coupling schemes from checkpoint.
    *
    * Used for checkpointing.
    */
-  virtual void importState(const std::string& filenamePrefix);
+  virtual void importState(const std::string& prefix, const io::Checkpoint& checkpoint);
 
   /**
    * @brief Send the state of the coupling scheme to another remote scheme.
@@ -9,6 +9,12 @@
 #include <vector>
 #include <map>
 
+namespace precice {
+  namespace io {
+    class Checkpoint;
+  }
+}
+
 namespace precice {
 namespace cplscheme {
 
@@ -199,18 +205,18 @@ public:
   virtual std::string printCouplingState() const =0;
 
   /**
-   * @brief Exports the state of the coupling scheme to file/s.
+   * @brief Adds the state of the coupling scheme to checkpoint.
    *
-   * Used for checkpointing.
+   * The names of all added entries start with prefix.
    */
-  virtual void exportState(const std::string& filenamePrefix) const =0;
+  virtual void exportState(const std::string& prefix, io::Checkpoint& checkpoint) const =0;
 
   /**
-   * @brief Imports the state of the coupling scheme from file/s.
+   * @brief Restores the state of the coupling scheme added by exportState().
    *
    * Used for checkpointing.
    */
-  virtual void importState(const std::string& filenamePrefix) =0;
+  virtual void importState(const std::string& prefix, const io::Checkpoint& checkpoint) =0;
 
   /**
    * @brief Send the state of the coupling scheme to another remote scheme.
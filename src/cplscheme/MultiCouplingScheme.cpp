@@ -264,16 +264,18 @@ void MultiCouplingScheme:: sendData()
 {
   TRACE();
 
+  waitForPendingSends();
   for(size_t i=0;i<_communications.size();i++){
     assertion(_communications[i].get() != nullptr);
     assertion(_communications[i]->isConnected());
 
+    DataMap nonEmptyData;
     for (DataMap::value_type& pair : _sendDataVector[i]) {
-      int size = pair.second->values->size();
-      if (size > 0) {
-        _communications[i]->send(pair.second->values->data(), size, pair.second->mesh->getID(), pair.second->dimension);
+      if (pair.second->values->size() > 0) {
+        nonEmptyData.insert(pair);
       }
     }
+    startSend(_communications[i], nonEmptyData);
   }
 }
 
@@ -285,12 +287,13 @@ void MultiCouplingScheme:: receiveData()
     assertion(_communications[i].get() != nullptr);
     assertion(_communications[i]->isConnected());
 
+    DataMap nonEmptyData;
     for (DataMap::value_type& pair : _receiveDataVector[i]) {
-      int size = pair.second->values->size();
-      if (size > 0) {
-        _communications[i]->receive(pair.second->values->data(), size, pair.second->mesh->getID(), pair.second->dimension);
+      if (pair.second->values->size() > 0) {
+        nonEmptyData.insert(pair);
       }
     }
+    receive(_communications[i], nonEmptyData);
   }
 }
 
@@ -71,9 +71,9 @@ public:
 
   virtual std::string printCouplingState() const;
 
-  virtual void exportState(const std::string& filenamePrefix) const {}
+  virtual void exportState(const std::string& prefix, io::Checkpoint& checkpoint) const {}
 
-  virtual void importState(const std::string& filenamePrefix) {}
+  virtual void importState(const std::string& prefix, const io::Checkpoint& checkpoint) {}
 
 private:
 
@@ -59,6 +59,7 @@ PostProcessingConfiguration:: PostProcessingConfiguration
   ATTR_IMVJCHUNKSIZE("chunk-size"),
   ATTR_RSLS_REUSEDTSTEPS("reused-timesteps-at-restart"),
   ATTR_RSSVD_TRUNCATIONEPS("truncation-threshold"),
+  ATTR_MAXSTOREDCOLS("max-stored-columns"),
   ATTR_PRECOND_NONCONST_TIMESTEPS("freeze-after"),
   VALUE_CONSTANT("constant"),
   VALUE_AITKEN ("aitken"),
@@ -79,6 +80,7 @@ PostProcessingConfiguration:: PostProcessingConfiguration
   VALUE_SVD_RESTART("RS-SVD"),
   VALUE_SLIDE_RESTART("RS-SLIDE"),
   VALUE_NO_RESTART("no-restart"),
+  VALUE_MATRIXFREE("matrix-free"),
   //_isValid(false),
   _meshConfig(meshConfig),
   _postProcessing(),
@@ -259,6 +261,14 @@ void PostProcessingConfiguration:: xmlTagCallback
       _config.imvjRestartType = impl::MVQNPostProcessing::RS_SVD;
     }else if (f == VALUE_SLIDE_RESTART){
       _config.imvjRestartType = impl::MVQNPostProcessing::RS_SLIDE;
+    }else if (f == VALUE_MATRIXFREE){
+      _config.imvjRSSVD_truncationEps = callingTag.getDoubleAttributeValue(ATTR_RSSVD_TRUNCATIONEPS);
+      _config.imvjMaxStoredColumns = callingTag.getIntAttributeValue(ATTR_MAXSTOREDCOLS);
+      // the rank of the SVD is capped at half of the stored columns, a cap of 0 would mean no cap
+      if(_config.imvjMaxStoredColumns < 2)
+        preciceError("xmlTagCallback()", "IMVJ restart-mode matrix-free requires max-stored-columns of at least 2, but "
+                     << _config.imvjMaxStoredColumns << " is given.");
+      _config.imvjRestartType = impl::MVQNPostProcessing::MATRIX_FREE;
     }else {
       _config.imvjChunkSize = 0;
       assertion(false);
@@ -354,7 +364,8 @@ void PostProcessingConfiguration:: xmlEndTagCallback
 			  _config.imvjRestartType,
 			  _config.imvjChunkSize,
 			  _config.imvjRSLS_reustedTimesteps,
-			  _config.imvjRSSVD_truncationEps) );
+			  _config.imvjRSSVD_truncationEps,
+			  _config.imvjMaxStoredColumns) );
 		#else
       	  preciceError("xmlEndTagCallback()", "Post processing IQN-IMVJ only works if preCICE is compiled with MPI");
     #endif
@@ -538,7 +549,8 @@ void PostProcessingConfiguration:: addTypeSpecificSubtags
     ValidatorEquals<std::string> validRS_LS(VALUE_LS_RESTART );
     ValidatorEquals<std::string> validRS_SVD(VALUE_SVD_RESTART );
     ValidatorEquals<std::string> validRS_SLIDE(VALUE_SLIDE_RESTART );
-    attrRestartName.setValidator (validNO_RS || validRS_ZERO || validRS_LS ||validRS_SVD || validRS_SLIDE);
+    ValidatorEquals<std::string> validMATRIXFREE(VALUE_MATRIXFREE );
+    attrRestartName.setValidator (validNO_RS || validRS_ZERO || validRS_LS ||validRS_SVD || validRS_SLIDE || validMATRIXFREE);
     attrRestartName.setDefaultValue(VALUE_SVD_RESTART);
     tagIMVJRESTART.addAttribute(attrRestartName);
     tagIMVJRESTART.setDocumentation("Type of IMVJ restart mode that is used\n"
@@ -547,6 +559,8 @@ void PostProcessingConfiguration:: addTypeSpecificSubtags
               "  RS-LS:      IMVJ runs in restart mode. After M time steps a IQN-LS like approximation for the initial guess of the Jacobian is computed.\n"
               "  RS-SVD:     IMVJ runs in restart mode. After M time steps a truncated SVD of the Jacobian is updated.\n"
               "  RS-SLIDE:   IMVJ runs in sliding window restart mode.\n"
+              "  matrix-free: IMVJ never builds the Jacobian, but keeps the updates of all time steps. If they exceed\n"
+              "               the given number of columns, they are merged into a truncated SVD of the Jacobian.\n"
               );
     XMLAttribute<int> attrChunkSize(ATTR_IMVJCHUNKSIZE);
     attrChunkSize.setDocumentation("Specifies the number of time steps M after which the IMVJ restarts, if run in restart-mode. Defaul value is M=8.");
@@ -557,9 +571,14 @@ void PostProcessingConfiguration:: addTypeSpecificSubtags
     XMLAttribute<double> attrRSSVD_truncationEps(ATTR_RSSVD_TRUNCATIONEPS);
     attrRSSVD_truncationEps.setDocumentation("If IMVJ restart-mode=RS-SVD, the truncation threshold for the updated SVD can be set.");
     attrRSSVD_truncationEps.setDefaultValue(1e-4);
+    XMLAttribute<int> attrMaxStoredCols(ATTR_MAXSTOREDCOLS);
+    attrMaxStoredCols.setDocumentation("If IMVJ restart-mode=matrix-free, the maximal number of stored columns of all time steps can be set. "
+                                       "The memory for the Jacobian is then bounded by twice this number of vectors of the local size.");
+    attrMaxStoredCols.setDefaultValue(100);
     tagIMVJRESTART.addAttribute(attrChunkSize);
     tagIMVJRESTART.addAttribute(attrReusedTimeStepsAtRestart);
     tagIMVJRESTART.addAttribute(attrRSSVD_truncationEps);
+    tagIMVJRESTART.addAttribute(attrMaxStoredCols);
     tag.addSubtag(tagIMVJRESTART);
 
     XMLTag tagMaxUsedIter(*this, TAG_MAX_USED_ITERATIONS, XMLTag::OCCUR_ONCE );
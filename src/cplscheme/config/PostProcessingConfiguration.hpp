@@ -100,6 +100,7 @@ private:
    const std::string ATTR_IMVJCHUNKSIZE;
    const std::string ATTR_RSLS_REUSEDTSTEPS;
    const std::string ATTR_RSSVD_TRUNCATIONEPS;
+   const std::string ATTR_MAXSTOREDCOLS;
    const std::string ATTR_PRECOND_NONCONST_TIMESTEPS;
 
    const std::string VALUE_CONSTANT;
@@ -121,6 +122,7 @@ private:
    const std::string VALUE_SVD_RESTART;
    const std::string VALUE_SLIDE_RESTART;
    const std::string VALUE_NO_RESTART;
+   const std::string VALUE_MATRIXFREE;
 
    //bool _isValid;
 
@@ -151,6 +153,7 @@ private:
       int imvjRestartType;
       int imvjChunkSize;
       int imvjRSLS_reustedTimesteps;
+      int imvjMaxStoredColumns;
       int precond_nbNonConstTSteps;
       double singularityLimit;
       double imvjRSSVD_truncationEps;
@@ -171,6 +174,7 @@ private:
          imvjRestartType( 0 ), // NO-RESTART
          imvjChunkSize ( 0 ),
          imvjRSLS_reustedTimesteps( 0 ),
+         imvjMaxStoredColumns( 0 ),
          precond_nbNonConstTSteps( -1),
          singularityLimit ( 0.0 ),
          imvjRSSVD_truncationEps( 0.0 ),
@@ -5,6 +5,7 @@
 #include "utils/Helpers.hpp"
 #include "logging/Logger.hpp"
 #include "utils/MasterSlave.hpp"
+#include <cmath>
 
 namespace precice {
    namespace cplscheme {
@@ -43,17 +44,24 @@ public:
       _isConvergence = false;
    }
 
-   virtual void measure (
+   virtual int getNumberOfSquaredNorms() const
+   {
+      return 1;
+   }
+
+   virtual void computeSquaredNorms (
       const Eigen::VectorXd& oldValues,
       const Eigen::VectorXd& newValues,
-      const Eigen::VectorXd& designSpecification)
+      const Eigen::VectorXd& designSpecification,
+      double*                squaredNorms) const
+   {
+      squaredNorms[0] = ((newValues - oldValues) - designSpecification).squaredNorm();
+   }
+
+   virtual void evaluate ( const double* squaredNorms )
    {
-      _normDiff = utils::MasterSlave::l2norm((newValues - oldValues) - designSpecification);
+      _normDiff = std::sqrt(squaredNorms[0]);
       _isConvergence = _normDiff <= _convergenceLimit;
-//      preciceInfo ( "measure()", "Absolute convergence measure: "
-//                     << "two-norm differences = " << normDiff
-//                     << ", convergence limit = " << _convergenceLimit
-//                     << ", convergence = " << _isConvergence );
    }
 
    virtual bool isConvergence () const
@@ -7,6 +7,7 @@
 #include "utils/MasterSlave.hpp"
 #include "utils/EventTimings.hpp"
 #include "utils/EigenHelperFunctions.hpp"
+#include "io/Checkpoint.hpp"
 #include <sstream>
 //#include "utils/NumericalCompare.hpp"
 
@@ -268,7 +269,8 @@ void BaseQNPostProcessing::updateDifferenceMatrices
     DataMap& cplData)
 {
   preciceTrace("updateDiffernceMatrices()");
-  Event e("Base-QN_updateDifferenceMatrices()", true, true); // time measurement, barrier
+  static const int eventID = utils::EventRegistry::getID("Base-QN_updateDifferenceMatrices()");
+  Event e(eventID, true, true); // time measurement, barrier
 
   // Compute current residual: vertex-data - oldData
   _residuals = _values;
@@ -299,8 +301,8 @@ void BaseQNPostProcessing::updateDifferenceMatrices
       bool overdetermined = getLSSystemCols() <= getLSSystemRows();
       if (not columnLimitReached && overdetermined) {
 
-        utils::appendFront(_matrixV, deltaR);
-        utils::appendFront(_matrixW, deltaXTilde);
+        _matrixV.appendFront(deltaR);
+        _matrixW.appendFront(deltaXTilde);
 
         // insert column deltaR = _residuals - _oldResiduals at pos. 0 (front) into the
         // QR decomposition and update decomposition
@@ -312,8 +314,8 @@ void BaseQNPostProcessing::updateDifferenceMatrices
         _matrixCols.front()++;
         }
       else {
-        utils::shiftSetFirst(_matrixV, deltaR);
-        utils::shiftSetFirst(_matrixW, deltaXTilde);
+        _matrixV.shiftSetFirst(deltaR);
+        _matrixW.shiftSetFirst(deltaXTilde);
 
         // inserts column deltaR at pos. 0 to the QR decomposition and deletes the last column
         // the QR decomposition of V is updated
@@ -346,7 +348,8 @@ void BaseQNPostProcessing::performPostProcessing
     DataMap& cplData)
 {
   preciceTrace("performPostProcessing()", _dataIDs.size(), cplData.size());
-  Event e("Base-QN_performPostProcessing()", true, true); // time measurement, barrier
+  static const int eventID = utils::EventRegistry::getID("Base-QN_performPostProcessing()");
+  Event e(eventID, true, true); // time measurement, barrier
 
   assertion(_oldResiduals.size() == _oldXTilde.size(),_oldResiduals.size(), _oldXTilde.size());
   assertion(_values.size() == _oldXTilde.size(),_values.size(), _oldXTilde.size());
@@ -407,9 +410,9 @@ void BaseQNPostProcessing::performPostProcessing
       // re-computation of QR decomposition from _matrixV = _matrixVBackup
       // this occurs very rarely, to be precise, it occurs only if the coupling terminates
       // after the first iteration and the matrix data from time step t-2 has to be used
-      _preconditioner->apply(_matrixV);
-      _qrV.reset(_matrixV, getLSSystemRows());
-      _preconditioner->revert(_matrixV);
+      _preconditioner->apply(_matrixV.matrix());
+      _qrV.reset(_matrixV.matrix(), getLSSystemRows());
+      _preconditioner->revert(_matrixV.matrix());
       _resetLS = true; // need to recompute _Wtil, Q, R (only for IMVJ efficient update)
     }
 
@@ -429,11 +432,11 @@ void BaseQNPostProcessing::performPostProcessing
 
     _preconditioner->update(false, _values, _residuals);
     // apply scaling to V, V' := P * V (only needed to reset the QR-dec of V)
-    _preconditioner->apply(_matrixV);
+    _preconditioner->apply(_matrixV.matrix());
 
     if(_preconditioner->requireNewQR()){
       if(not (_filter==PostProcessing::QR2FILTER)){ //for QR2 filter, there is no need to do this twice
-        _qrV.reset(_matrixV, getLSSystemRows());
+        _qrV.reset(_matrixV.matrix(), getLSSystemRows());
       }
       _preconditioner->newQRfulfilled();
     }
@@ -442,7 +445,7 @@ void BaseQNPostProcessing::performPostProcessing
     applyFilter();
 
     // revert scaling of V, in computeQNUpdate all data objects are unscaled.
-    _preconditioner->revert(_matrixV);
+    _preconditioner->revert(_matrixV.matrix());
 
     /**
      * compute quasi-Newton update
@@ -474,8 +477,8 @@ void BaseQNPostProcessing::performPostProcessing
       // QN-step in the first iteration (idea: rather perform QN-step with information from last converged
       // time step instead of doing a underrelaxation)
       if (not _firstTimeStep) {
-        _matrixV.resize(0,0);
-        _matrixW.resize(0,0);
+        _matrixV.clear();
+        _matrixW.clear();
         _matrixCols.clear();
         _matrixCols.push_front(0); // vital after clear()
         _qrV.reset();
@@ -515,14 +518,15 @@ void BaseQNPostProcessing::performPostProcessing
 void BaseQNPostProcessing::applyFilter()
 {
   preciceTrace(__func__,_filter);
-  Event e("Base-QN_applyFilter()", true, true); // time measurement, barrier
+  static const int eventID = utils::EventRegistry::getID("Base-QN_applyFilter()");
+  Event e(eventID, true, true); // time measurement, barrier
 
   if (_filter == PostProcessing::NOFILTER) {
     // do nothing
   } else {
     // do: filtering of least-squares system to maintain good conditioning
     std::vector<int> delIndices(0);
-    _qrV.applyFilter(_singularityLimit, delIndices, _matrixV);
+    _qrV.applyFilter(_singularityLimit, delIndices, _matrixV.matrix());
     // start with largest index (as V,W matrices are shrinked and shifted
     for (int i = delIndices.size() - 1; i >= 0; i--) {
 
@@ -591,7 +595,8 @@ void BaseQNPostProcessing::iterationsConverged
     DataMap & cplData)
 {
   preciceTrace(__func__);
-  Event e("Base-QN_iterationsConvegred()", true, true); // time measurement, barrier
+  static const int eventID = utils::EventRegistry::getID("Base-QN_iterationsConvegred()");
+  Event e(eventID, true, true); // time measurement, barrier
 
   if (utils::MasterSlave::_masterMode || (not utils::MasterSlave::_masterMode && not utils::MasterSlave::_slaveMode))
     _infostringstream<<"# time step "<<tSteps<<" converged #\n iterations: "<<its
@@ -641,8 +646,8 @@ void BaseQNPostProcessing::iterationsConverged
   if (_timestepsReused == 0) {
     if (_forceInitialRelaxation)
     {
-      _matrixV.resize(0,0);
-      _matrixW.resize(0,0);
+      _matrixV.clear();
+      _matrixW.clear();
       _qrV.reset();
       // set the number of global rows in the QRFactorization. This is essential for the correctness in master-slave mode!
       _qrV.setGlobalRows(getLSSystemRows());
@@ -664,8 +669,8 @@ void BaseQNPostProcessing::iterationsConverged
 
     // remove columns
     for (int i = 0; i < toRemove; i++) {
-      utils::removeColumnFromMatrix(_matrixV, _matrixV.cols() - 1);
-      utils::removeColumnFromMatrix(_matrixW, _matrixW.cols() - 1);
+      _matrixV.removeColumn(_matrixV.cols() - 1);
+      _matrixW.removeColumn(_matrixW.cols() - 1);
       // also remove the corresponding columns from the dynamic QR-descomposition of _matrixV
       _qrV.popBack();
     }
@@ -693,8 +698,8 @@ void BaseQNPostProcessing::removeMatrixColumn
   _nbDelCols++;
 
   assertion(_matrixV.cols() > 1);
-  utils::removeColumnFromMatrix(_matrixV, columnIndex);
-  utils::removeColumnFromMatrix(_matrixW, columnIndex);
+  _matrixV.removeColumn(columnIndex);
+  _matrixW.removeColumn(columnIndex);
 
   // Reduce column count
   std::deque<int>::iterator iter = _matrixCols.begin();
@@ -714,13 +719,64 @@ void BaseQNPostProcessing::removeMatrixColumn
 }
 
 void BaseQNPostProcessing::exportState(
-    io::TXTWriter& writer)
+    const std::string& prefix,
+    io::Checkpoint&    checkpoint) const
 {
+  TRACE(prefix);
+  checkpoint.add(prefix + ":V", _matrixV.matrix());
+  checkpoint.add(prefix + ":W", _matrixW.matrix());
+  checkpoint.add(prefix + ":cols", std::vector<int>(_matrixCols.begin(), _matrixCols.end()));
+  checkpoint.add(prefix + ":VBackup", _matrixVBackup.matrix());
+  checkpoint.add(prefix + ":WBackup", _matrixWBackup.matrix());
+  checkpoint.add(prefix + ":colsBackup",
+                 std::vector<int>(_matrixColsBackup.begin(), _matrixColsBackup.end()));
+  checkpoint.add(prefix + ":firstTimeStep", (long int) _firstTimeStep);
+  checkpoint.add(prefix + ":resetLS", (long int) _resetLS);
 }
 
 void BaseQNPostProcessing::importState(
-    io::TXTReader& reader)
+    const std::string&    prefix,
+    const io::Checkpoint& checkpoint)
 {
+  TRACE(prefix);
+  Eigen::MatrixXd matrix;
+  std::vector<int> cols;
+  checkpoint.get(prefix + ":V", matrix);
+  _matrixV = matrix;
+  checkpoint.get(prefix + ":W", matrix);
+  _matrixW = matrix;
+  checkpoint.get(prefix + ":cols", cols);
+  _matrixCols.assign(cols.begin(), cols.end());
+  checkpoint.get(prefix + ":VBackup", matrix);
+  _matrixVBackup = matrix;
+  checkpoint.get(prefix + ":WBackup", matrix);
+  _matrixWBackup = matrix;
+  checkpoint.get(prefix + ":colsBackup", cols);
+  _matrixColsBackup.assign(cols.begin(), cols.end());
+  long int firstTimeStep = 0;
+  checkpoint.get(prefix + ":firstTimeStep", firstTimeStep);
+  _firstTimeStep = firstTimeStep != 0;
+  _firstIteration = true;
+
+  // the QR decomposition is not stored, but recomputed from the preconditioned V
+  _qrV.reset();
+  _qrV.setGlobalRows(getLSSystemRows());
+  if (getLSSystemCols() > 0) {
+    _preconditioner->apply(_matrixV.matrix());
+    _qrV.reset(_matrixV.matrix(), getLSSystemRows());
+    _preconditioner->revert(_matrixV.matrix());
+  }
+  // with timestepsReused = 0, the first iteration after convergence still uses the _Wtil
+  // of the last time step, hence it must not be recomputed from the restored Jacobian.
+  // Checkpoints written without the flag rebuild the least-squares system instead.
+  if (checkpoint.contains(prefix + ":resetLS")){
+    long int resetLS = 0;
+    checkpoint.get(prefix + ":resetLS", resetLS);
+    _resetLS = resetLS != 0;
+  }
+  else {
+    _resetLS = true; // need to recompute _Wtil, Q, R (only for IMVJ efficient update)
+  }
 }
 
 int BaseQNPostProcessing::getDeletedColumns()
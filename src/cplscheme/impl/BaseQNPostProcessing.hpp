@@ -6,6 +6,7 @@
 #include "logging/Logger.hpp"
 #include "QRFactorization.hpp"
 #include "Preconditioner.hpp"
+#include "utils/ColumnBuffer.hpp"
 #include <Eigen/Dense>
 #include <deque>
 #include <fstream>
@@ -136,16 +137,16 @@ public:
 
 
    /**
-    * @brief Exports the current state of the post-processing to a file.
+    * @brief Adds the least-squares system of the reused iterations to checkpoint.
     */
-   virtual void exportState(io::TXTWriter& writer);
+   virtual void exportState(const std::string& prefix, io::Checkpoint& checkpoint) const;
 
    /**
-    * @brief Imports the last exported state of the post-processing from file.
+    * @brief Restores the least-squares system from checkpoint and recomputes its QR decomposition.
     *
-    * Is empty at the moment!!!
+    * The weights of the preconditioner are not restored.
     */
-   virtual void importState(io::TXTReader& reader);
+   virtual void importState(const std::string& prefix, const io::Checkpoint& checkpoint);
    
    // delete this:
    virtual int getDeletedColumns();
@@ -208,10 +209,10 @@ protected:
    std::map<int,Eigen::VectorXd> _secondaryResiduals;
 
    /// @brief Stores residual deltas.
-   Eigen::MatrixXd _matrixV;
+   utils::ColumnBuffer _matrixV;
 
    /// @brief Stores x tilde deltas, where x tilde are values computed by solvers.
-   Eigen::MatrixXd _matrixW;
+   utils::ColumnBuffer _matrixW;
    
    /// @brief Stores the current QR decomposition ov _matrixV, can be updated via deletion/insertion of columns
    QRFactorization _qrV;
@@ -317,8 +318,8 @@ private:
    *  initial relaxation, if previous time step converged within one iteration i.e., V and W
    *  are empty -- in this case restore V and W with time step t-2.
    */
-  Eigen::MatrixXd _matrixVBackup;
-  Eigen::MatrixXd _matrixWBackup;
+  utils::ColumnBuffer _matrixVBackup;
+  utils::ColumnBuffer _matrixWBackup;
   std::deque<int> _matrixColsBackup;
 
   /// @ brief additional debugging info, is not important for computation:
@@ -3,7 +3,9 @@
 
 #include "cplscheme/CouplingData.hpp"
 #include "utils/Helpers.hpp"
+#include "utils/MasterSlave.hpp"
 #include <Eigen/Dense>
+#include <vector>
 
 namespace precice {
 namespace cplscheme {
@@ -21,6 +23,12 @@ namespace impl {
  * -# call newMeasurementSeries() for one set of iterations
  * -# call measure() for convergence measurement
  * -# retrieve the convergence status via isConvergence()
+ *
+ * The norms needed by a measurement are sums over all ranks in master-slave
+ * mode. To measure several data sets with a single allreduce, measure() can
+ * be split into computeSquaredNorms(), which adds up the local parts of the
+ * squared norms, and evaluate(), which takes the squared norms summed over all
+ * ranks.
  */
 class ConvergenceMeasure
 {
@@ -39,13 +47,46 @@ public:
   /**
    * @brief Performs convergence measurement.
    *
+   * Costs one allreduce in master-slave mode, if the measure needs norms.
+   *
    * @param[in] oldValues Old iterate values.
    * @param[in] newValues New iterate values.
    */
   virtual void measure (
     const Eigen::VectorXd& oldValues,
     const Eigen::VectorXd& newValues,
-    const Eigen::VectorXd& designSpecification) =0;
+    const Eigen::VectorXd& designSpecification)
+  {
+    std::vector<double> squaredNorms(getNumberOfSquaredNorms(), 0.0);
+    computeSquaredNorms(oldValues, newValues, designSpecification, squaredNorms.data());
+    utils::MasterSlave::allreduceSum(squaredNorms);
+    evaluate(squaredNorms.data());
+  }
+
+  /// Returns the number of squared l2-norms the measurement needs.
+  virtual int getNumberOfSquaredNorms() const
+  {
+    return 0;
+  }
+
+  /**
+   * @brief Computes the local parts of the squared l2-norms the measurement needs.
+   *
+   * @param[out] squaredNorms Array of size getNumberOfSquaredNorms().
+   */
+  virtual void computeSquaredNorms (
+    const Eigen::VectorXd& oldValues,
+    const Eigen::VectorXd& newValues,
+    const Eigen::VectorXd& designSpecification,
+    double*                squaredNorms) const
+  {}
+
+  /**
+   * @brief Completes the convergence measurement.
+   *
+   * @param[in] squaredNorms Squared norms from computeSquaredNorms(), summed over all ranks.
+   */
+  virtual void evaluate ( const double* squaredNorms ) =0;
 
   /**
    * @brief Returns true, if the last measurement indicates convergence.
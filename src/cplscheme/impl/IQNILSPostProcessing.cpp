@@ -3,8 +3,7 @@
 #include "utils/Globals.hpp"
 #include "mesh/Mesh.hpp"
 #include "mesh/Vertex.hpp"
-#include "io/TXTWriter.hpp"
-#include "io/TXTReader.hpp"
+#include "io/Checkpoint.hpp"
 #include "utils/MasterSlave.hpp"
 #include "utils/EventTimings.hpp"
 #include "utils/EigenHelperFunctions.hpp"
@@ -46,7 +45,8 @@ void IQNILSPostProcessing::initialize
 (
   DataMap& cplData )
 {
-  Event e("initialize()", true, true); // time measurement, barrier
+  static const int eventID = utils::EventRegistry::getID("initialize()");
+  Event e(eventID, true, true); // time measurement, barrier
 
   // do common QN post processing initialization
   BaseQNPostProcessing::initialize(cplData);
@@ -66,7 +66,8 @@ void IQNILSPostProcessing::updateDifferenceMatrices
 (
   DataMap& cplData)
 {
-  Event e("IQNILSPostProcessing::updateDifferenceMatrices", true, true); // time measurement, barrier
+  static const int eventID = utils::EventRegistry::getID("IQNILSPostProcessing::updateDifferenceMatrices");
+  Event e(eventID, true, true); // time measurement, barrier
 	// Compute residuals of secondary data
 	for (int id: _secondaryDataIDs){
 		Eigen::VectorXd& secResiduals = _secondaryResiduals[id];
@@ -87,19 +88,19 @@ void IQNILSPostProcessing::updateDifferenceMatrices
 
 				// Append column for secondary W matrices
 				for (int id: _secondaryDataIDs) {
-				  utils::appendFront(_secondaryMatricesW[id], _secondaryResiduals[id]);
+				  _secondaryMatricesW[id].appendFront(_secondaryResiduals[id]);
 				}
 			}
 			else {
 				// Shift column for secondary W matrices
 				for (int id: _secondaryDataIDs) {
-				  utils::shiftSetFirst(_secondaryMatricesW[id], _secondaryResiduals[id]);
+				  _secondaryMatricesW[id].shiftSetFirst(_secondaryResiduals[id]);
 				}
 			}
 
 			// Compute delta_x_tilde for secondary data
 			for (int id: _secondaryDataIDs) {
-				Eigen::MatrixXd& secW = _secondaryMatricesW[id];
+				utils::ColumnBuffer& secW = _secondaryMatricesW[id];
 				assertion(secW.rows() == cplData[id]->values->size(), secW.rows(), cplData[id]->values->size());
 				secW.col(0) = *(cplData[id]->values);
 				secW.col(0) -= _secondaryOldXTildes[id];
@@ -148,7 +149,8 @@ void IQNILSPostProcessing::computeQNUpdate
 (PostProcessing::DataMap& cplData, Eigen::VectorXd& xUpdate)
 {
 	preciceTrace("computeQNUpdate()");
-  Event e("computeNewtonUpdate", true, true); // time measurement, barrier
+  static const int eventID = utils::EventRegistry::getID("computeNewtonUpdate");
+  Event e(eventID, true, true); // time measurement, barrier
 
   DEBUG("   Compute Newton factors");
 
@@ -169,7 +171,8 @@ void IQNILSPostProcessing::computeQNUpdate
 	Eigen::VectorXd _local_b = Eigen::VectorXd::Zero(_qrV.cols());
 	Eigen::VectorXd _global_b;
 
-	Event e_qrsolve("solve: R alpha = -Q^T r", true, true); // time measurement, barrier
+	static const int e_qrsolveID = utils::EventRegistry::getID("solve: R alpha = -Q^T r");
+	Event e_qrsolve(e_qrsolveID, true, true); // time measurement, barrier
 
 	// need to scale the residual to compensate for the scaling in c = R^-1 * Q^T * P^-1 * residual'
 	// it is also possible to apply the inverse scaling weights from the right to the vector c
@@ -212,7 +215,7 @@ void IQNILSPostProcessing::computeQNUpdate
 
 	DEBUG("   Apply Newton factors");
 	// compute x updates from W and coefficients c, i.e, xUpdate = c*W
-	xUpdate = _matrixW * c;
+	xUpdate = _matrixW.matrix() * c;
 
 	//DEBUG("c = " << c);
 
@@ -233,7 +236,7 @@ void IQNILSPostProcessing::computeQNUpdate
 	  PtrCouplingData data = cplData[id];
 	  auto& values = *(data->values);
 	  assertion(_secondaryMatricesW[id].cols() == c.size(), _secondaryMatricesW[id].cols(), c.size());
-	  values = _secondaryMatricesW[id] * c;
+	  values = _secondaryMatricesW[id].matrix() * c;
 	  assertion(values.size() == data->oldValues.col(0).size(), values.size(), data->oldValues.col(0).size());
 	  values += data->oldValues.col(0);
 	  assertion(values.size() == _secondaryResiduals[id].size(), values.size(), _secondaryResiduals[id].size());
@@ -248,7 +251,7 @@ void IQNILSPostProcessing::computeQNUpdate
 			_secondaryMatricesWBackup = _secondaryMatricesW;
 		}
 		for (int id: _secondaryDataIDs){
-			_secondaryMatricesW[id].resize(0,0);
+			_secondaryMatricesW[id].clear();
 		}
 	}
 //	e.stop(true);
@@ -260,7 +263,8 @@ void IQNILSPostProcessing:: specializedIterationsConverged
 (
    DataMap & cplData)
 {
-  Event e(__func__, true, true); // time measurement, barrier
+  static const int eventID = utils::EventRegistry::getID(__func__);
+  Event e(eventID, true, true); // time measurement, barrier
 
   if (_matrixCols.front() == 0){ // Did only one iteration
     _matrixCols.pop_front(); 
@@ -270,7 +274,7 @@ void IQNILSPostProcessing:: specializedIterationsConverged
     if (_forceInitialRelaxation)
     {
       for (int id: _secondaryDataIDs) {
-        _secondaryMatricesW[id].resize(0,0);
+        _secondaryMatricesW[id].clear();
       }
     } else {
       /**
@@ -283,10 +287,10 @@ void IQNILSPostProcessing:: specializedIterationsConverged
   else if ((int)_matrixCols.size() > _timestepsReused){
     int toRemove = _matrixCols.back();
     for (int id: _secondaryDataIDs){
-      Eigen::MatrixXd& secW = _secondaryMatricesW[id];
-      assertion(secW.cols() > toRemove, secW, toRemove, id);
+      utils::ColumnBuffer& secW = _secondaryMatricesW[id];
+      assertion(secW.cols() > toRemove, secW.cols(), toRemove, id);
       for (int i=0; i < toRemove; i++){
-        utils::removeColumnFromMatrix(secW, secW.cols() - 1);
+        secW.removeColumn(secW.cols() - 1);
       }
     }
   }
@@ -301,10 +305,51 @@ void IQNILSPostProcessing:: removeMatrixColumn
   assertion(_matrixV.cols() > 1);
   // remove column from secondary Data Matrix W
   for (int id: _secondaryDataIDs){
-    utils::removeColumnFromMatrix(_secondaryMatricesW[id], columnIndex);
+    _secondaryMatricesW[id].removeColumn(columnIndex);
    }
 
 	BaseQNPostProcessing::removeMatrixColumn(columnIndex);
 }
 
+void IQNILSPostProcessing:: exportState
+(
+  const std::string& prefix,
+  io::Checkpoint&    checkpoint) const
+{
+  BaseQNPostProcessing::exportState(prefix, checkpoint);
+  for (size_t i=0; i < _secondaryDataIDs.size(); i++){
+    int id = _secondaryDataIDs[i];
+    std::string name = prefix + ":secondaryW:" + std::to_string(i);
+    auto iter = _secondaryMatricesW.find(id);
+    if (iter != _secondaryMatricesW.end()){
+      checkpoint.add(name, iter->second.matrix());
+    }
+    iter = _secondaryMatricesWBackup.find(id);
+    if (iter != _secondaryMatricesWBackup.end()){
+      checkpoint.add(name + ":backup", iter->second.matrix());
+    }
+  }
+}
+
+void IQNILSPostProcessing:: importState
+(
+  const std::string&    prefix,
+  const io::Checkpoint& checkpoint)
+{
+  BaseQNPostProcessing::importState(prefix, checkpoint);
+  Eigen::MatrixXd matrix;
+  for (size_t i=0; i < _secondaryDataIDs.size(); i++){
+    int id = _secondaryDataIDs[i];
+    std::string name = prefix + ":secondaryW:" + std::to_string(i);
+    if (checkpoint.contains(name)){
+      checkpoint.get(name, matrix);
+      _secondaryMatricesW[id] = matrix;
+    }
+    if (checkpoint.contains(name + ":backup")){
+      checkpoint.get(name + ":backup", matrix);
+      _secondaryMatricesWBackup[id] = matrix;
+    }
+  }
+}
+
 }}} // namespace precice, cplscheme, impl
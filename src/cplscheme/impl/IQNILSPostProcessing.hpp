@@ -61,6 +61,12 @@ public:
     */
    virtual void specializedIterationsConverged(DataMap& cplData);
 
+   /// @brief Adds the least-squares system and the matrices of the secondary data to checkpoint.
+   virtual void exportState(const std::string& prefix, io::Checkpoint& checkpoint) const;
+
+   /// @brief Restores the least-squares system and the matrices of the secondary data.
+   virtual void importState(const std::string& prefix, const io::Checkpoint& checkpoint);
+
 private:
 
    // @brief Secondary data solver output from last iteration.
@@ -70,8 +76,8 @@ private:
    // @brief Secondary data x-tilde deltas.
    //
    // Stores x-tilde deltas for data not involved in least-squares computation.
-   std::map<int,Eigen::MatrixXd> _secondaryMatricesW;
-   std::map<int,Eigen::MatrixXd> _secondaryMatricesWBackup;
+   std::map<int,utils::ColumnBuffer> _secondaryMatricesW;
+   std::map<int,utils::ColumnBuffer> _secondaryMatricesWBackup;
    
    // @brief updates the V, W matrices (as well as the matrices for the secondary data)
    virtual void updateDifferenceMatrices(DataMap & cplData);
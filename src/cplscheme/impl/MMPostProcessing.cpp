@@ -350,14 +350,14 @@ void MMPostProcessing::updateDifferenceMatrices(
     bool overdetermined = getLSSystemCols() <= getLSSystemRows();
     if (not columnLimitReached && overdetermined) {
 
-      utils::appendFront(_matrixF, colF);
-      utils::appendFront(_matrixC, colC);
+      _matrixF.appendFront(colF);
+      _matrixC.appendFront(colC);
 
       _matrixCols.front()++;
       }
     else {
-      utils::shiftSetFirst(_matrixF, colF);
-      utils::shiftSetFirst(_matrixC, colC);
+      _matrixF.shiftSetFirst(colF);
+      _matrixC.shiftSetFirst(colC);
 
       _matrixCols.front()++;
       _matrixCols.back()--;
@@ -432,8 +432,8 @@ void MMPostProcessing::performPostProcessing(
     _preconditioner->update(false, _outputFineModel, objective);
     // TODO: evaluate whether the pure residual should be used for updating the preconditioner or residual - design specification
     if (getLSSystemCols() > 0){
-      _preconditioner->apply(_matrixF);
-      _preconditioner->apply(_matrixC);
+      _preconditioner->apply(_matrixF.matrix());
+      _preconditioner->apply(_matrixC.matrix());
     }
     _preconditioner->apply(_fineResiduals);
     _preconditioner->apply(_coarseResiduals);
@@ -465,8 +465,8 @@ void MMPostProcessing::performPostProcessing(
     }
 
     if (getLSSystemCols() > 0){
-      _preconditioner->revert(_matrixF);
-      _preconditioner->revert(_matrixC);
+      _preconditioner->revert(_matrixF.matrix());
+      _preconditioner->revert(_matrixC.matrix());
     }
     _preconditioner->revert(_fineResiduals);
     _preconditioner->revert(_coarseResiduals);
@@ -583,7 +583,7 @@ void MMPostProcessing::computeCoarseModelDesignSpecifiaction()
         break;
 
       // Calculate singular value decomposition with Eigen
-      Eigen::JacobiSVD < Eigen::MatrixXd > svd(_matrixF, Eigen::ComputeThinU | Eigen::ComputeThinV);
+      Eigen::JacobiSVD < Eigen::MatrixXd > svd(_matrixF.matrix(), Eigen::ComputeThinU | Eigen::ComputeThinV);
       Eigen::VectorXd singularValues = svd.singularValues();
 
       for (int i = 0; i < singularValues.rows(); i++) {
@@ -604,8 +604,8 @@ void MMPostProcessing::computeCoarseModelDesignSpecifiaction()
     if (getLSSystemCols() > 0)
     {
       // Calculate singular value decomposition with Eigen
-      Eigen::JacobiSVD < Eigen::MatrixXd > svd_C(_matrixC, Eigen::ComputeThinU | Eigen::ComputeThinV);
-      Eigen::JacobiSVD < Eigen::MatrixXd > svd_F(_matrixF, Eigen::ComputeThinU | Eigen::ComputeThinV);
+      Eigen::JacobiSVD < Eigen::MatrixXd > svd_C(_matrixC.matrix(), Eigen::ComputeThinU | Eigen::ComputeThinV);
+      Eigen::JacobiSVD < Eigen::MatrixXd > svd_F(_matrixF.matrix(), Eigen::ComputeThinU | Eigen::ComputeThinV);
 
       Eigen::MatrixXd pseudoSigma_F = svd_F.singularValues().asDiagonal();
 
@@ -624,7 +624,7 @@ void MMPostProcessing::computeCoarseModelDesignSpecifiaction()
         Eigen::VectorXd beta = U_F * (U_F.transpose() * alpha);
 
         _coarseModel_designSpecification -= alpha;
-        _coarseModel_designSpecification -= _matrixC * (pseudoMatrixF * alpha);
+        _coarseModel_designSpecification -= _matrixC.matrix() * (pseudoMatrixF * alpha);
         _coarseModel_designSpecification += U_C * (U_C.transpose() * (alpha - beta));
         _coarseModel_designSpecification += beta;
       }
@@ -638,11 +638,11 @@ void MMPostProcessing::computeCoarseModelDesignSpecifiaction()
 
         // if previous Jacobian exists, i.e., no re-scaling and not first estimation
         if (_MMMappingMatrix_prev.rows() == getLSSystemRows()) {
-          _MMMappingMatrix = _MMMappingMatrix_prev + (_matrixC - _MMMappingMatrix_prev * _matrixF) * pseudoMatrixF;
+          _MMMappingMatrix = _MMMappingMatrix_prev + (_matrixC.matrix() - _MMMappingMatrix_prev * _matrixF.matrix()) * pseudoMatrixF;
 
           // if no previous Jacobian exists, set up Jacobian with IQN-ILS update rule + stabilization term
         } else {
-          _MMMappingMatrix = _matrixC * pseudoMatrixF + (I - U_C * U_C.transpose()) * (I - U_F * U_F.transpose());
+          _MMMappingMatrix = _matrixC.matrix() * pseudoMatrixF + (I - U_C * U_C.transpose()) * (I - U_F * U_F.transpose());
         }
 
         // compute new design specification for coarse model optimization: qk = c(x) - Tk( f(x) - q )
@@ -784,8 +784,8 @@ void MMPostProcessing::iterationsConverged
 # endif // Debug
 
   if (_timestepsReused == 0) {
-    _matrixF.resize(0, 0);
-    _matrixC.resize(0, 0);
+    _matrixF.clear();
+    _matrixC.clear();
     _matrixCols.clear();
   }
   else if ((int) _matrixCols.size() > _timestepsReused) {
@@ -797,8 +797,8 @@ void MMPostProcessing::iterationsConverged
 
     // remove columns
     for (int i = 0; i < toRemove; i++) {
-      utils::removeColumnFromMatrix(_matrixF, _matrixF.cols() - 1);
-      utils::removeColumnFromMatrix(_matrixC, _matrixC.cols() - 1);
+      _matrixF.removeColumn(_matrixF.cols() - 1);
+      _matrixC.removeColumn(_matrixC.cols() - 1);
     }
     _matrixCols.pop_back();
   }
@@ -823,8 +823,8 @@ void MMPostProcessing::removeMatrixColumn
   deletedColumns++;
 
   assertion(_matrixF.cols() > 1);
-  utils::removeColumnFromMatrix(_matrixF, columnIndex);
-  utils::removeColumnFromMatrix(_matrixC, columnIndex);
+  _matrixF.removeColumn(columnIndex);
+  _matrixC.removeColumn(columnIndex);
 
   // Reduce column count
   std::deque<int>::iterator iter = _matrixCols.begin();
@@ -845,12 +845,14 @@ void MMPostProcessing::removeMatrixColumn
 
 
 void MMPostProcessing::exportState(
-    io::TXTWriter& writer)
+    const std::string& prefix,
+    io::Checkpoint&    checkpoint) const
 {
 }
 
 void MMPostProcessing::importState(
-    io::TXTReader& reader)
+    const std::string&    prefix,
+    const io::Checkpoint& checkpoint)
 {
 }
 
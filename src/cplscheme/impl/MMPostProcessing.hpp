@@ -7,6 +7,7 @@
 #include "logging/Logger.hpp"
 #include "QRFactorization.hpp"
 #include "Preconditioner.hpp"
+#include "utils/ColumnBuffer.hpp"
 #include <Eigen/Dense>
 #include <deque>
 #include <fstream>
@@ -114,18 +115,22 @@ public:
   }
 
   /**
-   * @brief Exports the current state of the post-processing to a file.
+   * @brief Adds the current state of the post-processing to checkpoint.
+   *
+   * Is empty at the moment!!!
    */
   virtual void exportState(
-      io::TXTWriter& writer);
+      const std::string& prefix,
+      io::Checkpoint&    checkpoint) const;
 
   /**
-   * @brief Imports the last exported state of the post-processing from file.
+   * @brief Imports the last exported state of the post-processing from checkpoint.
    *
    * Is empty at the moment!!!
    */
   virtual void importState(
-      io::TXTReader& reader);
+      const std::string&    prefix,
+      const io::Checkpoint& checkpoint);
 
   // delete this:
   virtual int getDeletedColumns();
@@ -232,10 +237,10 @@ private:
   //Eigen::VectorXd _coarseScaledOldValues;
 
   /// @brief Stores residual deltas for the fine model response
-  Eigen::MatrixXd _matrixF;
+  utils::ColumnBuffer _matrixF;
 
   /// @brief Stores residual deltas for the coarse model response
-  Eigen::MatrixXd _matrixC;
+  utils::ColumnBuffer _matrixC;
 
   /** @brief The pseudo inverse of the manifold mapping matrix, only stored and updated
    *        if _estimateJacobian is set to true.
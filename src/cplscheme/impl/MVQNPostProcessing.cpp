@@ -9,6 +9,7 @@
 #include "utils/EventTimings.hpp"
 #include "utils/EigenHelperFunctions.hpp"
 #include "utils/Publisher.hpp"
+#include "io/Checkpoint.hpp"
 #include "com/MPIPortsCommunication.hpp"
 #include "com/SocketCommunication.hpp"
 #include "com/Communication.hpp"
@@ -42,7 +43,8 @@ MVQNPostProcessing:: MVQNPostProcessing
   int    imvjRestartType,
   int    chunkSize,
   int    RSLSreusedTimesteps,
-  double RSSVDtruncationEps)
+  double RSSVDtruncationEps,
+  int    maxStoredColumns)
 :
   BaseQNPostProcessing(initialRelaxation, forceInitialRelaxation, maxIterationsUsed, timestepsReused,
 		       filter, singularityLimit, dataIDs, preconditioner),
@@ -64,6 +66,7 @@ MVQNPostProcessing:: MVQNPostProcessing
   _imvjRestart(false),
   _chunkSize(chunkSize),
   _RSLSreusedTimesteps(RSLSreusedTimesteps),
+  _maxStoredColumns(maxStoredColumns),
   _usedColumnsPerTstep(5),
   _nbRestarts(0),
   //_info2(),
@@ -98,7 +101,8 @@ void MVQNPostProcessing:: initialize
   DataMap& cplData )
 {
   preciceTrace(__func__);
-  Event e("MVQNPostProcessing::initialize", true, true); // time measurement, barrier
+  static const int eventID = utils::EventRegistry::getID("MVQNPostProcessing::initialize");
+  Event e(eventID, true, true); // time measurement, barrier
 
   // do common QN post processing initialization
   BaseQNPostProcessing::initialize(cplData);
@@ -165,6 +169,11 @@ void MVQNPostProcessing:: initialize
   _parMatrixOps = impl::PtrParMatrixOps(new impl::ParallelMatrixOperations());
   _parMatrixOps->initialize(_cyclicCommLeft, _cyclicCommRight, not _imvjRestart);
   _svdJ.initialize(_parMatrixOps, getLSSystemRows());
+  if(_imvjRestartType == MATRIX_FREE){
+    // leave room for new columns after the stored matrices are merged into the SVD
+    assertion(_maxStoredColumns >= 2, _maxStoredColumns);
+    _svdJ.setMaxRank(_maxStoredColumns / 2);
+  }
 
   int entries = _residuals.size();
   int global_n = 0;
@@ -190,7 +199,7 @@ void MVQNPostProcessing:: initialize
 
 
   if (utils::MasterSlave::_masterMode || (not utils::MasterSlave::_masterMode && not utils::MasterSlave::_slaveMode))
-    _infostringstream<<" IMVJ restart mode: "<<_imvjRestart<<"\n chunk size: "<<_chunkSize<<"\n trunc eps: "<<_svdJ.getThreshold()<<"\n R_RS: "<<_RSLSreusedTimesteps<<"\n--------\n"<<std::endl;
+    _infostringstream<<" IMVJ restart mode: "<<_imvjRestart<<"\n chunk size: "<<_chunkSize<<"\n trunc eps: "<<_svdJ.getThreshold()<<"\n R_RS: "<<_RSLSreusedTimesteps<<"\n max stored cols: "<<_maxStoredColumns<<"\n--------\n"<<std::endl;
 
   //e.stop(true);
 }
@@ -223,7 +232,8 @@ void MVQNPostProcessing::updateDifferenceMatrices
    */
 
   preciceTrace(__func__);
-  Event e("MVQNPostProcessing::updateDifferenceMatrices", true, true); // time measurement, barrier
+  static const int eventID = utils::EventRegistry::getID("MVQNPostProcessing::updateDifferenceMatrices");
+  Event e(eventID, true, true); // time measurement, barrier
 
   // call the base method for common update of V, W matrices
   // important that base method is called before updating _Wtil
@@ -283,9 +293,9 @@ void MVQNPostProcessing::updateDifferenceMatrices
         wtil += w;
 
         if (not columnLimitReached && overdetermined) {
-          utils::appendFront(_Wtil, wtil);
+          _Wtil.appendFront(wtil);
         }else {
-          utils::shiftSetFirst(_Wtil, wtil);
+          _Wtil.shiftSetFirst(wtil);
         }
       }
     }
@@ -339,7 +349,8 @@ void MVQNPostProcessing::pseudoInverse(
   assertion(pseudoInverse.rows() == _qrV.cols(), pseudoInverse.rows(), _qrV.cols());
   assertion(pseudoInverse.cols() == _qrV.rows(), pseudoInverse.cols(), _qrV.rows());
 
-  Event e("computePseudoInverse()", true, true); // time measurement, barrier
+  static const int eventID = utils::EventRegistry::getID("computePseudoInverse()");
+  Event e(eventID, true, true); // time measurement, barrier
   Eigen::VectorXd yVec(pseudoInverse.rows());
 
   // assertions for the case of processors with no vertices
@@ -367,11 +378,12 @@ void MVQNPostProcessing::buildWtil()
    * PRECONDITION: Assumes that V, W, J_prev are already preconditioned,
    */
   preciceTrace(__func__);
-  Event e("buildWtil()", true, true); // time measurement, barrier
+  static const int eventID = utils::EventRegistry::getID("buildWtil()");
+  Event e(eventID, true, true); // time measurement, barrier
 
   assertion(_matrixV.rows() == _qrV.rows(), _matrixV.rows(), _qrV.rows());  assertion(getLSSystemCols() == _qrV.cols(), getLSSystemCols(), _qrV.cols());
 
-  _Wtil = Eigen::MatrixXd::Zero(_qrV.rows(), _qrV.cols());
+  Eigen::MatrixXd Wtil = Eigen::MatrixXd::Zero(_qrV.rows(), _qrV.cols());
 
   // imvj restart mode: re-compute Wtil: Wtil = W - sum_q [ Wtil^q * (Z^q*V) ]
   //                                                      |--- J_prev ---|
@@ -382,21 +394,22 @@ void MVQNPostProcessing::buildWtil()
       assertion(colsLSSystemBackThen == _WtilChunk[i].cols(), colsLSSystemBackThen, _WtilChunk[i].cols());
       Eigen::MatrixXd ZV = Eigen::MatrixXd::Zero(colsLSSystemBackThen, _qrV.cols());
       // multiply: ZV := Z^q * V of size (m x m) with m=#cols, stored on each proc.
-      _parMatrixOps->multiply(_pseudoInverseChunk[i], _matrixV, ZV, colsLSSystemBackThen, getLSSystemRows(), _qrV.cols());
+      _parMatrixOps->multiply(_pseudoInverseChunk[i], _matrixV.matrix(), ZV, colsLSSystemBackThen, getLSSystemRows(), _qrV.cols());
       // multiply: Wtil^q * ZV  dimensions: (n x m) * (m x m), fully local and embarrassingly parallel
-      _Wtil += _WtilChunk[i] * ZV;
+      Wtil += _WtilChunk[i] * ZV;
     }
 
   // imvj without restart is used, i.e., recompute Wtil: Wtil = W - J_prev * V
   }else{
     // multiply J_prev * V = W_til of dimension: (n x n) * (n x m) = (n x m),
     //                                    parallel:  (n_global x n_local) * (n_local x m) = (n_local x m)
-    _parMatrixOps->multiply(_oldInvJacobian, _matrixV, _Wtil, _dimOffsets, getLSSystemRows(), getLSSystemRows(), getLSSystemCols(), false);
+    _parMatrixOps->multiply(_oldInvJacobian, _matrixV.matrix(), Wtil, _dimOffsets, getLSSystemRows(), getLSSystemRows(), getLSSystemCols(), false);
   }
 
   // W_til = (W-J_inv_n*V) = (W-V_tilde)
-  _Wtil *= -1.;
-  _Wtil = _Wtil + _matrixW;
+  Wtil *= -1.;
+  Wtil += _matrixW.matrix();
+  _Wtil = Wtil;
 
   _resetLS = false;
 //  e.stop(true);
@@ -406,7 +419,8 @@ void MVQNPostProcessing::buildWtil()
 void MVQNPostProcessing::buildJacobian()
 {
   preciceTrace(__func__);
-  Event e("buildJacobian()", true, true); // time measurement, barrier
+  static const int eventID = utils::EventRegistry::getID("buildJacobian()");
+  Event e(eventID, true, true); // time measurement, barrier
   /**      --- compute inverse Jacobian ---
   *
   * J_inv = J_inv_n + (W - J_inv_n*V)*(V^T*V)^-1*V^T
@@ -434,7 +448,7 @@ void MVQNPostProcessing::buildJacobian()
   *  where Z = (V^T*V)^-1*V^T via QR-dec and back-substitution       dimension: (n x n) * (n x m) = (n x m),
   *  and W_til = (W - J_inv_n*V)                                     parallel:  (n_global x n_local) * (n_local x m) = (n_local x m)
   */
-  _parMatrixOps->multiply(_Wtil, Z, _invJacobian, _dimOffsets, getLSSystemRows(), getLSSystemCols(), getLSSystemRows());
+  _parMatrixOps->multiply(_Wtil.matrix(), Z, _invJacobian, _dimOffsets, getLSSystemRows(), getLSSystemCols(), getLSSystemRows());
                                 // --------
 
   // update Jacobian
@@ -448,7 +462,8 @@ void MVQNPostProcessing::computeNewtonUpdateEfficient(
     Eigen::VectorXd& xUpdate)
 {
   preciceTrace(__func__);
-  Event e(__func__, true, true); // time measurement, barrier
+  static const int eventID = utils::EventRegistry::getID(__func__);
+  Event e(eventID, true, true); // time measurement, barrier
 
 
   /**      --- update inverse Jacobian efficient, ---
@@ -509,7 +524,7 @@ void MVQNPostProcessing::computeNewtonUpdateEfficient(
    */
   Eigen::VectorXd xUptmp(_residuals.size());
   xUpdate = Eigen::VectorXd::Zero(_residuals.size());
-  xUptmp = _Wtil * r_til;                      // local product, result is naturally distributed.
+  xUptmp = _Wtil.matrix() * r_til;                      // local product, result is naturally distributed.
 
   /**
    *  (5) xUp = J_prev * (-res) + Wtil*Z*(-res)
@@ -538,7 +553,7 @@ void MVQNPostProcessing::computeNewtonUpdateEfficient(
 
   // pending deletion: delete Wtil
   if (_firstIteration && _timestepsReused == 0 && not _forceInitialRelaxation) {
-    _Wtil.conservativeResize(0,0);
+    _Wtil.clear();
     _resetLS = true;
   }
 //  e.stop(true);
@@ -549,7 +564,8 @@ void MVQNPostProcessing::computeNewtonUpdate
 (PostProcessing::DataMap& cplData, Eigen::VectorXd& xUpdate)
 {
 	preciceTrace(__func__);
-	Event e(__func__, true, true); // time measurement, barrier
+	static const int eventID = utils::EventRegistry::getID(__func__);
+	Event e(eventID, true, true); // time measurement, barrier
 
 	/**      --- update inverse Jacobian ---
 	*
@@ -570,7 +586,7 @@ void MVQNPostProcessing::computeNewtonUpdate
 	*  where Z = (V^T*V)^-1*V^T via QR-dec and back-substitution             dimension: (n x n) * (n x m) = (n x m),
 	*  and W_til = (W - J_inv_n*V)                                           parallel:  (n_global x n_local) * (n_local x m) = (n_local x m)
 	*/
-	_parMatrixOps->multiply(_Wtil, Z, _invJacobian, _dimOffsets, getLSSystemRows(), getLSSystemCols(), getLSSystemRows());                                // --------
+	_parMatrixOps->multiply(_Wtil.matrix(), Z, _invJacobian, _dimOffsets, getLSSystemRows(), getLSSystemCols(), getLSSystemRows());                                // --------
 
 	// update Jacobian
 	_invJacobian = _invJacobian + _oldInvJacobian;
@@ -588,12 +604,13 @@ void MVQNPostProcessing::computeNewtonUpdate
 void MVQNPostProcessing::restartIMVJ()
 {
   preciceTrace(__func__);
-  Event e(__func__, true, true); // time measurement, barrier
+  static const int eventID = utils::EventRegistry::getID(__func__);
+  Event e(eventID, true, true); // time measurement, barrier
 
   //int used_storage = 0;
   //int theoreticalJ_storage = 2*getLSSystemRows()*_residuals.size() + 3*_residuals.size()*getLSSystemCols() + _residuals.size()*_residuals.size();
   //               ------------ RESTART SVD ------------
-  if(_imvjRestartType == MVQNPostProcessing::RS_SVD)
+  if(_imvjRestartType == MVQNPostProcessing::RS_SVD || _imvjRestartType == MVQNPostProcessing::MATRIX_FREE)
   {
 
     // we need to compute the updated SVD of the scaled Jacobian matrix
@@ -751,7 +768,7 @@ void MVQNPostProcessing::restartIMVJ()
       assertion(colsLSSystemBackThen == _WtilChunk.front().cols(), colsLSSystemBackThen, _WtilChunk.front().cols());
       Eigen::MatrixXd ZV = Eigen::MatrixXd::Zero(colsLSSystemBackThen, _qrV.cols());
       // multiply: ZV := Z^q * V of size (m x m) with m=#cols, stored on each proc.
-      _parMatrixOps->multiply(_pseudoInverseChunk.front(), _matrixV, ZV, colsLSSystemBackThen, getLSSystemRows(), _qrV.cols());
+      _parMatrixOps->multiply(_pseudoInverseChunk.front(), _matrixV.matrix(), ZV, colsLSSystemBackThen, getLSSystemRows(), _qrV.cols());
       // multiply: Wtil^0 * (Z_0*V)  dimensions: (n x m) * (m x m), fully local and embarrassingly parallel
       Eigen::MatrixXd tmp = Eigen::MatrixXd::Zero(_qrV.rows(), _qrV.cols());
       tmp = _WtilChunk.front() * ZV;
@@ -778,7 +795,8 @@ void MVQNPostProcessing:: specializedIterationsConverged
    DataMap & cplData)
 {
   preciceTrace(__func__);
-  Event e(__func__, true, true); // time measurement, barrier
+  static const int eventID = utils::EventRegistry::getID(__func__);
+  Event e(eventID, true, true); // time measurement, barrier
 
   // truncate V_RSLS and W_RSLS matrices according to _RSLSreusedTimesteps
   if(_imvjRestartType == RS_LS){
@@ -814,18 +832,18 @@ void MVQNPostProcessing:: specializedIterationsConverged
 
     // |= REBUILD QR-dec if needed     ============|
     // apply scaling to V, V' := P * V (only needed to reset the QR-dec of V)
-    _preconditioner->apply(_matrixV);
+    _preconditioner->apply(_matrixV.matrix());
 
     if(_preconditioner->requireNewQR()){
       if(not (_filter==PostProcessing::QR2FILTER)){ //for QR2 filter, there is no need to do this twice
-        _qrV.reset(_matrixV, getLSSystemRows());
+        _qrV.reset(_matrixV.matrix(), getLSSystemRows());
       }
       _preconditioner->newQRfulfilled();
     }
     // apply the configured filter to the LS system
     // as it changed in BaseQNPostProcessing::iterationsConverged()
     BaseQNPostProcessing::applyFilter();
-    _preconditioner->revert(_matrixV);
+    _preconditioner->revert(_matrixV.matrix());
     // |===================          ============|
 
 
@@ -842,13 +860,18 @@ void MVQNPostProcessing:: specializedIterationsConverged
 
       // push back unscaled pseudo Inverse, Wtil is also unscaled.
       // all objects in Wtil chunk and Z chunk are NOT PRECONDITIONED
-      _WtilChunk.push_back(_Wtil);
+      _WtilChunk.push_back(_Wtil.matrix());
       _pseudoInverseChunk.push_back(Z);
 
       /**
-       *  Restart the IMVJ according to restart type
+       *  Restart the IMVJ according to restart type, in matrix-free mode only
+       *  if the stored matrices exceed the memory budget
        */
-      if ((int)_WtilChunk.size() >= _chunkSize+1){
+      bool restart = (int)_WtilChunk.size() >= _chunkSize+1;
+      if(_imvjRestartType == MATRIX_FREE){
+        restart = getStoredColumns() > _maxStoredColumns;
+      }
+      if (restart){
 
         // < RESTART >
         _nbRestarts++;
@@ -881,6 +904,93 @@ void MVQNPostProcessing:: specializedIterationsConverged
 //  e.stop(true);
 }
 
+// ==================================================================================
+void MVQNPostProcessing:: exportState
+(
+  const std::string& prefix,
+  io::Checkpoint&    checkpoint) const
+{
+  BaseQNPostProcessing::exportState(prefix, checkpoint);
+  checkpoint.add(prefix + ":Wtil", _Wtil.matrix());
+  if(not _imvjRestart){
+    checkpoint.add(prefix + ":oldInvJacobian", _oldInvJacobian);
+  }
+  else {
+    // the inverse Jacobian is represented by the stored matrices Wtil and Z
+    checkpoint.add(prefix + ":chunks", (long int) _WtilChunk.size());
+    for(int i = 0; i < (int)_WtilChunk.size(); i++){
+      checkpoint.add(prefix + ":WtilChunk" + std::to_string(i), _WtilChunk[i]);
+      checkpoint.add(prefix + ":pseudoInverseChunk" + std::to_string(i), _pseudoInverseChunk[i]);
+    }
+    checkpoint.add(prefix + ":restarts", (long int) _nbRestarts);
+    if(_imvjRestartType == RS_LS){
+      checkpoint.add(prefix + ":V_RSLS", _matrixV_RSLS);
+      checkpoint.add(prefix + ":W_RSLS", _matrixW_RSLS);
+      checkpoint.add(prefix + ":cols_RSLS", std::vector<int>(_matrixCols_RSLS.begin(), _matrixCols_RSLS.end()));
+    }
+    if(_imvjRestartType == RS_SVD || _imvjRestartType == MATRIX_FREE){
+      _svdJ.exportState(prefix + ":svdJ", checkpoint);
+    }
+  }
+}
+
+// ==================================================================================
+void MVQNPostProcessing:: importState
+(
+  const std::string&    prefix,
+  const io::Checkpoint& checkpoint)
+{
+  BaseQNPostProcessing::importState(prefix, checkpoint);
+  // without Wtil in the checkpoint, the base class requests to rebuild it
+  if (checkpoint.contains(prefix + ":Wtil")){
+    Eigen::MatrixXd Wtil;
+    checkpoint.get(prefix + ":Wtil", Wtil);
+    _Wtil = Wtil;
+  }
+  if(not _imvjRestart){
+    Eigen::MatrixXd oldInvJacobian;
+    checkpoint.get(prefix + ":oldInvJacobian", oldInvJacobian);
+    CHECK(oldInvJacobian.rows() == _oldInvJacobian.rows() && oldInvJacobian.cols() == _oldInvJacobian.cols(),
+          "The inverse Jacobian in the checkpoint has " << oldInvJacobian.rows() << " x " << oldInvJacobian.cols()
+          << " entries, but " << _oldInvJacobian.rows() << " x " << _oldInvJacobian.cols() << " are expected!");
+    _oldInvJacobian = oldInvJacobian;
+  }
+  else {
+    long int chunks = 0;
+    checkpoint.get(prefix + ":chunks", chunks);
+    _WtilChunk.resize(chunks);
+    _pseudoInverseChunk.resize(chunks);
+    for(int i = 0; i < (int)chunks; i++){
+      checkpoint.get(prefix + ":WtilChunk" + std::to_string(i), _WtilChunk[i]);
+      checkpoint.get(prefix + ":pseudoInverseChunk" + std::to_string(i), _pseudoInverseChunk[i]);
+      CHECK(_WtilChunk[i].rows() == _residuals.size() && _pseudoInverseChunk[i].cols() == _residuals.size(),
+            "The stored Jacobian in the checkpoint has " << _WtilChunk[i].rows()
+            << " rows, but " << _residuals.size() << " are expected!");
+    }
+    checkpoint.get(prefix + ":restarts", _nbRestarts);
+    if(_imvjRestartType == RS_LS){
+      std::vector<int> cols;
+      checkpoint.get(prefix + ":V_RSLS", _matrixV_RSLS);
+      checkpoint.get(prefix + ":W_RSLS", _matrixW_RSLS);
+      checkpoint.get(prefix + ":cols_RSLS", cols);
+      _matrixCols_RSLS.assign(cols.begin(), cols.end());
+    }
+    if(_imvjRestartType == RS_SVD || _imvjRestartType == MATRIX_FREE){
+      _svdJ.importState(prefix + ":svdJ", checkpoint);
+    }
+  }
+}
+
+// ==================================================================================
+int MVQNPostProcessing:: getStoredColumns()
+{
+  int cols = 0;
+  for(const Eigen::MatrixXd& Wtil : _WtilChunk){
+    cols += Wtil.cols();
+  }
+  return cols;
+}
+
 // ==================================================================================
 void MVQNPostProcessing:: removeMatrixColumn
 (
@@ -892,7 +1002,7 @@ void MVQNPostProcessing:: removeMatrixColumn
 
   // remove column from matrix _Wtil
   if(not _resetLS && not _alwaysBuildJacobian)
-    utils::removeColumnFromMatrix(_Wtil, columnIndex);
+    _Wtil.removeColumn(columnIndex);
 
   BaseQNPostProcessing::removeMatrixColumn(columnIndex);
 }
@@ -40,6 +40,7 @@ public:
   static const int RS_LS = 2;
   static const int RS_SVD = 3;
   static const int RS_SLIDE = 4;
+  static const int MATRIX_FREE = 5;
 
   /**
    * @brief Constructor.
@@ -57,7 +58,8 @@ public:
       int    imvjRestartType,
       int    chunkSize,
       int    RSLSreusedTimesteps,
-      double RSSVDtruncationEps);
+      double RSSVDtruncationEps,
+      int    maxStoredColumns);
 
    /**
     * @brief Destructor, empty.
@@ -78,7 +80,19 @@ public:
     * handles the postprocessing sepcific action after the convergence of one iteration
     */
    virtual void specializedIterationsConverged(DataMap& cplData);
-  
+
+   /**
+    * @brief Adds the least-squares system and the inverse Jacobian of the last time step to checkpoint.
+    *
+    * In the restart modes, the inverse Jacobian is stored as the matrices Wtil and Z
+    * of the current chunk, together with the truncated SVD or the least-squares
+    * system of the past time steps used for the next restart.
+    */
+   virtual void exportState(const std::string& prefix, io::Checkpoint& checkpoint) const;
+
+   /// @brief Restores the least-squares system and the inverse Jacobian of the last time step.
+   virtual void importState(const std::string& prefix, const io::Checkpoint& checkpoint);
+
 private:
 
    /// @brief: stores the approximation of the inverse Jacobian of the system at current time step.
@@ -88,7 +102,7 @@ private:
    Eigen::MatrixXd _oldInvJacobian;
 
    /// @brief: stores the sub result (W-J_prev*V) for the current iteration
-   Eigen::MatrixXd _Wtil;
+   utils::ColumnBuffer _Wtil;
 
    /// @brief: stores all Wtil matrices within the current chunk of the imvj restart mode, disabled if _imvjRestart = false.
    std::vector< Eigen::MatrixXd > _WtilChunk;
@@ -128,6 +142,9 @@ private:
     *  - RS-ZERO:    imvj is run in restart-mode. After M time steps all stored matrices are dropped
     *  - RS-LS:      imvj in restart-mode. After M time steps restart with LS approximation for initial Jacobian
     *  - RS-SVD:     imvj in restart mode. After M time steps, update of an truncated SVD of the Jacobian.
+    *  - MATRIX_FREE: imvj never builds the Jacobian, but keeps the matrices Wtil and Z of all time steps.
+    *                 Only if they exceed #_maxStoredColumns columns, they are merged into a truncated SVD
+    *                 of the Jacobian of rank #_maxStoredColumns/2 at most.
     */
    int _imvjRestartType;
 
@@ -144,6 +161,13 @@ private:
    /// @brief: Number of reused time steps at restart if restart-mode = RS-LS
    int _RSLSreusedTimesteps;
 
+   /** @brief: Maximal number of columns of all stored matrices Wtil, if restart-mode = MATRIX_FREE.
+    *
+    *  Bounds the memory for the Jacobian to 2 * #_maxStoredColumns vectors of the local size,
+    *  as each column of Wtil comes with one row of Z.
+    */
+   int _maxStoredColumns;
+
    /// @brief: Number of used columns per time step. Always the first _usedColumnsPerTstep are used.
    int _usedColumnsPerTstep;
 
@@ -206,6 +230,9 @@ private:
     */
    void restartIMVJ();
 
+   /// @brief: returns the total number of columns of the stored matrices Wtil in _WtilChunk
+   int getStoredColumns();
+
    /// @brief: Removes one iteration from V,W matrices and adapts _matrixCols.
    virtual void removeMatrixColumn(int columnIndex);
 
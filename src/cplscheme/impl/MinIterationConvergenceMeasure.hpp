@@ -19,10 +19,7 @@ public:
 
    virtual void newMeasurementSeries();
 
-   virtual void measure (
-      const Eigen::VectorXd& oldValues,
-      const Eigen::VectorXd& newValues,
-      const Eigen::VectorXd& designSpecification)
+   virtual void evaluate ( const double* squaredNorms )
    {
      TRACE();
      _currentIteration++;
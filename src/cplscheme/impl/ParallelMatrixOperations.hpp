@@ -36,11 +36,16 @@ public:
 		   	   	   com::Communication::SharedPointer rightComm,
 		   	   	   bool needcyclicComm);
 
-   template<typename Derived1, typename Derived2>
+   /** @brief Multiplies distributed matrices, see _multiplyNN(), _multiplyNM_dotProduct() and _multiplyNM_block().
+    *
+    * The factors are taken by reference, such that blocks of larger matrices, e.g. of
+    * utils::ColumnBuffer, and vectors are multiplied without a copy.
+    */
+   template<typename Derived>
    void multiply(
-       Eigen::PlainObjectBase<Derived1>& leftMatrix,
-		   Eigen::PlainObjectBase<Derived2>& rightMatrix,
-		   Eigen::PlainObjectBase<Derived2>& result,
+       const Eigen::Ref<const Eigen::MatrixXd>& leftMatrix,
+		   const Eigen::Ref<const Eigen::MatrixXd>& rightMatrix,
+		   Eigen::PlainObjectBase<Derived>& result,
    		 const std::vector<int>& offsets,
    		 int p, int q, int r,
    		 bool dotProductComputation = true)
@@ -122,11 +127,11 @@ private:
    static logging::Logger _log;
 
   // @brief multiplies matrices based on a cyclic communication and block-wise matrix multiplication with a quadratic result matrix
-   template<typename Derived1, typename Derived2>
+   template<typename Derived>
    void _multiplyNN(
-       Eigen::PlainObjectBase<Derived1>& leftMatrix,
-		   Eigen::PlainObjectBase<Derived2>& rightMatrix,
-		   Eigen::PlainObjectBase<Derived2>& result,
+       const Eigen::Ref<const Eigen::MatrixXd>& leftMatrix,
+		   const Eigen::Ref<const Eigen::MatrixXd>& rightMatrix,
+		   Eigen::PlainObjectBase<Derived>& result,
 		   const std::vector<int>& offsets,
 		   int p, int q, int r)
    {
@@ -157,8 +162,10 @@ private:
 		com::Request::SharedPointer requestRcv;
 
 		// initiate asynchronous send operation of leftMatrix (W_til) --> nextProc (this data is needed in cycle 1)    dim: n_local x cols
+		// the columns of leftMatrix are contiguous, and aSend does not modify them
+		assertion(leftMatrix.outerStride() == leftMatrix.rows(), leftMatrix.outerStride(), leftMatrix.rows());
 		if(leftMatrix.size() > 0)
-			requestSend = _cyclicCommRight->aSend(leftMatrix.data(), leftMatrix.size(), 0);
+			requestSend = _cyclicCommRight->aSend(const_cast<double*>(leftMatrix.data()), leftMatrix.size(), 0);
 
 		// initiate asynchronous receive operation for leftMatrix (W_til) from previous processor --> W_til      dim: rows_rcv x cols
 		if(leftMatrix_rcv.size() > 0)
@@ -227,11 +234,11 @@ private:
 
 
    // @brief multiplies matrices based on a dot-product computation with a rectangular result matrix
-   template<typename Derived1, typename Derived2>
+   template<typename Derived>
    void _multiplyNM_dotProduct(
-       Eigen::PlainObjectBase<Derived1>& leftMatrix,
-		   Eigen::PlainObjectBase<Derived2>& rightMatrix,
-		   Eigen::PlainObjectBase<Derived2>& result,
+       const Eigen::Ref<const Eigen::MatrixXd>& leftMatrix,
+		   const Eigen::Ref<const Eigen::MatrixXd>& rightMatrix,
+		   Eigen::PlainObjectBase<Derived>& result,
 		   const std::vector<int>& offsets,
 		   int p, int q, int r)
    {
@@ -264,11 +271,11 @@ private:
    }
 
 	// @brief multiplies matrices based on a SAXPY-like block-wise computation with a rectangular result matrix of dimension n x m
-	template<typename Derived1, typename Derived2>
+	template<typename Derived>
 	void _multiplyNM_block(
-	    Eigen::PlainObjectBase<Derived1>& leftMatrix,
-			Eigen::PlainObjectBase<Derived2>& rightMatrix,
-		  Eigen::PlainObjectBase<Derived2>& result,
+	    const Eigen::Ref<const Eigen::MatrixXd>& leftMatrix,
+			const Eigen::Ref<const Eigen::MatrixXd>& rightMatrix,
+		  Eigen::PlainObjectBase<Derived>& result,
 			const std::vector<int>& offsets,
 			int p, int q, int r)
 	{
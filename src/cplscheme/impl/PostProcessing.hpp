@@ -13,8 +13,7 @@ namespace precice {
       class BaseCouplingScheme;
    }
    namespace io {
-     class TXTWriter;
-     class TXTReader;
+     class Checkpoint;
    }
 }
 
@@ -76,9 +75,11 @@ public:
    */
   virtual void setCoarseModelOptimizationActive(bool* coarseOptimizationActive) {};
 
-  virtual void exportState(io::TXTWriter& writer) {}
+  /// Adds the state of the post-processing to checkpoint, the entry names start with prefix.
+  virtual void exportState(const std::string& prefix, io::Checkpoint& checkpoint) const {}
 
-  virtual void importState(io::TXTReader& reader) {}
+  /// Restores the state of the post-processing added by exportState().
+  virtual void importState(const std::string& prefix, const io::Checkpoint& checkpoint) {}
 
   /**
    * @brief performs one optimization step of the optimization problem
@@ -66,7 +66,7 @@ public:
    * @brief Apply preconditioner to matrix
    * @param transpose: false = from left, true = from right
    */
-  void apply(Eigen::MatrixXd& M, bool transpose){
+  void apply(Eigen::Ref<Eigen::MatrixXd> M, bool transpose){
     preciceTrace(__func__);
     if(transpose){
       assertion(M.cols()==(int)_weights.size(), M.cols(), _weights.size());
@@ -90,7 +90,7 @@ public:
    * @brief Apply inverse preconditioner to matrix
    * @param transpose: false = from left, true = from right
    */
-  void revert(Eigen::MatrixXd& M, bool transpose){
+  void revert(Eigen::Ref<Eigen::MatrixXd> M, bool transpose){
     TRACE();
     //assertion(_needsGlobalWeights);
     if (transpose) {
@@ -114,7 +114,7 @@ public:
   /**
    * @brief To transform physical values to balanced values. Matrix version
    */
-    void apply(Eigen::MatrixXd& M){
+    void apply(Eigen::Ref<Eigen::MatrixXd> M){
       TRACE();
       assertion(M.rows()==(int)_weights.size(), M.rows(), (int)_weights.size());
 
@@ -143,7 +143,7 @@ public:
     /**
      * @brief To transform balanced values back to physical values. Matrix version
      */
-    void revert(Eigen::MatrixXd& M){
+    void revert(Eigen::Ref<Eigen::MatrixXd> M){
       TRACE();
 
       assertion(M.rows()==(int)_weights.size());
@@ -241,6 +241,23 @@ protected:
   bool _freezed;
 
 
+  /**
+   * @brief Returns the squared l2-norms of all sub-vectors of values.
+   *
+   * The norms of all sub-vectors are summed up over all ranks with a single allreduce.
+   */
+  std::vector<double> computeSquaredSubVectorNorms(const Eigen::VectorXd& values)
+  {
+    std::vector<double> squaredNorms(_subVectorSizes.size(), 0.0);
+    int offset = 0;
+    for(size_t k=0; k<_subVectorSizes.size(); k++){
+      squaredNorms[k] = values.segment(offset, _subVectorSizes[k]).squaredNorm();
+      offset += _subVectorSizes[k];
+    }
+    utils::MasterSlave::allreduceSum(squaredNorms);
+    return squaredNorms;
+  }
+
   /**
    * @brief Update the scaling after every FSI iteration and require a new QR decomposition (if necessary)
    *
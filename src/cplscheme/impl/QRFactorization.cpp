@@ -106,7 +106,7 @@ QRFactorization::QRFactorization(
 {}
 
       
-void QRFactorization::applyFilter(double singularityLimit, std::vector<int>& delIndices, Eigen::MatrixXd& V)
+void QRFactorization::applyFilter(double singularityLimit, std::vector<int>& delIndices, const Eigen::MatrixXd& V)
 {
 	preciceTrace("applyFilter()");
 	delIndices.resize(0);
@@ -234,9 +234,8 @@ bool QRFactorization::insertColumn(int k, const Eigen::VectorXd& vec, double sin
   // orthogonalize v to columns of Q
   Eigen::VectorXd u(_cols);
   double rho_orth = 0., rho0 = 0.;
-  if(applyFilter) rho0 = utils::MasterSlave::l2norm(v);
 
-  int err = orthogonalize(v, u, rho_orth, _cols-1);
+  int err = orthogonalize(v, u, rho_orth, rho0, _cols-1);
 
   // on of the following is true
   // - either ||v_orth|| / ||v|| <= 0.7 was true and the re-orthogonalization process failed 4 times
@@ -330,6 +329,7 @@ int QRFactorization::orthogonalize(
   Eigen::VectorXd& v,
   Eigen::VectorXd& r,
   double& rho,
+  double& rhoInit,
   int colNum)
 {
    preciceTrace(__func__);
@@ -343,42 +343,30 @@ int QRFactorization::orthogonalize(
    bool null = false;
    bool termination = false;
    double rho0 = 0., rho1 = 0.;
-   Eigen::VectorXd u = Eigen::VectorXd::Zero(_rows);
-   Eigen::VectorXd s = Eigen::VectorXd::Zero(colNum);
+   Eigen::VectorXd s;
    r = Eigen::VectorXd::Zero(_cols);
 
-   rho = utils::MasterSlave::l2norm(v); // distributed l2norm
+   // the Fourier coefficients of the first iteration come with the norm of v
+   project(v, colNum, s, rho);
+   rhoInit = rho;
    rho0 = rho;
    int k = 0;
   while (!termination) {
 
-    // take a gram-schmidt iteration
-    u = Eigen::VectorXd::Zero(_rows);
-    for (int j = 0; j < colNum; j++) {
-
-      // dot-product <_Q(:,j), v >
-      Eigen::VectorXd Qc = _Q.col(j);
-
-      // dot product <_Q(:,j), v> =: r_ij
-      double r_ij = utils::MasterSlave::dot(Qc, v);
-      // save r_ij in s(j) = column of R
-      s(j) = r_ij;
-      // u is the sum of projections r_ij * _Q(:,j) =  _Q(:,j) * <_Q(:,j), v>
-      u += _Q.col(j) * r_ij;
-    }
+    // take a classical gram-schmidt iteration with the coefficients s = _Q^T v
     // add the furier coefficients over all orthogonalize iterations
-    for (int j = 0; j < colNum; j++) {
-      r(j) = r(j) + s(j);
-    }
+    r.head(colNum) += s;
     // subtract projections from v, v is now orthogonal to columns of _Q
-    for (int i = 0; i < _rows; i++) {
-      v(i) = v(i) - u(i);
+    if (colNum > 0) {
+      v.noalias() -= _Q.leftCols(colNum) * s;
     }
-    // rho1 = norm of orthogonalized new column v_tilde (though not normalized)
-    rho1 = utils::MasterSlave::l2norm(v); // distributed l2norm
 
-    // t = norm of r_(:,j) with j = colNum-1
-    double norm_coefficients = utils::MasterSlave::l2norm(s); // distributed l2norm
+    // t = norm of r_(:,j) with j = colNum-1, s is the same on all ranks
+    double norm_coefficients = s.norm();
+
+    // rho1 = norm of orthogonalized new column v_tilde (though not normalized),
+    // s are the coefficients of a possible re-orthogonalization
+    project(v, colNum, s, rho1);
     k++;
 
     // treat the special case m=n
@@ -474,24 +462,13 @@ int QRFactorization::orthogonalize_stable(
    rho0 = rho;
    int k = 0;
 	while (!termination) {
-		// take a gram-schmidt iteration, ignoring r on later steps if previous v was null
+		// take a classical gram-schmidt iteration, ignoring r on later steps if previous v was null
+		// s = _Q^T v, i.e., s(j) = r_ij = <_Q(:,j), v>, the norm of v is not needed here
+		project(v, colNum, s, t);
+		// u is the sum of projections r_ij * _Q(i,:) =  _Q(i,:) * <_Q(:,j), v>
 		u = Eigen::VectorXd::Zero(_rows);
-		for (int j = 0; j < colNum; j++) {
-
-			/*
-			 * dot-product <_Q(:,j), v >
-			 */
-			Eigen::VectorXd Qc = _Q.col(j);
-
-			// dot product <_Q(:,j), v> =: r_ij
-			double ss = utils::MasterSlave::dot(Qc, v);
-			t = ss;
-			// save r_ij in s(j) = column of R
-			s(j) = t;
-			// u is the sum of projections r_ij * _Q(i,:) =  _Q(i,:) * <_Q(:,j), v>
-			for (int i = 0; i < _rows; i++) {
-				u(i) = u(i) + _Q(i, j) * t;
-			}
+		if (colNum > 0) {
+			u.noalias() = _Q.leftCols(colNum) * s;
 		}
 		if (!null) {
 			// add over all runs: r_ij = r_ij_prev + r_ij
@@ -506,8 +483,8 @@ int QRFactorization::orthogonalize_stable(
 		// rho1 = norm of orthogonalized new column v_tilde (though not normalized)
 		rho1 = utils::MasterSlave::l2norm(v); // distributed l2norm
 
-		// t = norm of r_(:,j) with j = colNum-1
-		t = utils::MasterSlave::l2norm(s); // distributed l2norm
+		// t = norm of r_(:,j) with j = colNum-1, s is the same on all ranks
+		t = s.norm();
 		k++;
 
 		// treat the special case m=n
@@ -634,6 +611,26 @@ int QRFactorization::orthogonalize_stable(
    
       
 
+void QRFactorization::project(
+  const Eigen::VectorXd& v,
+  int colNum,
+  Eigen::VectorXd& s,
+  double& norm)
+{
+  preciceTrace(__func__, colNum);
+  // local parts of s = _Q(:,0:colNum-1)^T v and of ||v||^2, summed up with a single allreduce
+  std::vector<double> sums(colNum + 1, 0.0);
+  Eigen::Map<Eigen::VectorXd> localS(sums.data(), colNum);
+  if (colNum > 0) {
+    localS.noalias() = _Q.leftCols(colNum).transpose() * v;
+  }
+  sums[colNum] = v.squaredNorm();
+  utils::MasterSlave::allreduceSum(sums);
+  s = localS;
+  norm = std::sqrt(sums[colNum]);
+}
+
+
 /**
  * @short computes parameters for givens matrix G for which  (x,y)G = (z,0). replaces (x,y) by (z,0)
  */
@@ -760,15 +757,23 @@ void QRFactorization::reset(
   _globalRows = globalRows;
   
   int m = A.cols();
-  int col = 0, k = 0;
-  for (; col<m; k++, col++)
-  {
-     Eigen::VectorXd v = A.col(col);
-     bool inserted = insertColumn(k,v);
-     if(not inserted){
-       k--;
-       DEBUG("column "<<col<<" has not been inserted in the QR-factorization, failed to orthogonalize.");
-     }
+  if(computeTSQR(A)){
+    DEBUG("QR-dec of " << m << " columns computed as TSQR");
+  }
+  else{
+    _Q.resize(0,0);
+    _R.resize(0,0);
+    _cols = 0;
+    int col = 0, k = 0;
+    for (; col<m; k++, col++)
+    {
+       Eigen::VectorXd v = A.col(col);
+       bool inserted = insertColumn(k,v);
+       if(not inserted){
+         k--;
+         DEBUG("column "<<col<<" has not been inserted in the QR-factorization, failed to orthogonalize.");
+       }
+    }
   }
   assertion(_R.rows() == _cols, _R.rows(), _cols);
   assertion(_R.cols() == _cols, _R.cols(), _cols);
@@ -778,6 +783,85 @@ void QRFactorization::reset(
 }
 
 
+bool QRFactorization::computeTSQR(
+  Eigen::MatrixXd const& A)
+{
+  preciceTrace(__func__, A.cols());
+  int m = A.cols();
+
+  // a quadratic system cannot be orthogonalized, see orthogonalize()
+  if(m == 0 || m >= _globalRows) return false;
+
+  // local Householder QR A_p = Q_p R_p, with R_p (m x m) padded with zero rows if _rows < m
+  Eigen::MatrixXd localQ = Eigen::MatrixXd::Zero(_rows, m);
+  Eigen::MatrixXd localR = Eigen::MatrixXd::Zero(m, m);
+  if(_rows > 0){
+    Eigen::HouseholderQR<Eigen::MatrixXd> localQR(A);
+    int localCols = std::min(_rows, m);
+    localR.topRows(localCols) = localQR.matrixQR().topRows(localCols).triangularView<Eigen::Upper>();
+    localQ = localQR.householderQ() * Eigen::MatrixXd::Identity(_rows, m);
+  }
+
+  // QR of the stacked local factors [R_0; R_1; ...] = Q_c R on the master, which sends
+  // each rank its block of Q_c together with R. Then Q_p = Q_p Q_c(p).
+  // The master receives the local factors one after the other, i.e., P messages of m x m,
+  // as the master-slave communication connects the slaves to the master only.
+  Eigen::MatrixXd blockR(2*m, m);
+  if(not utils::MasterSlave::_masterMode && not utils::MasterSlave::_slaveMode){
+    blockR.topRows(m) = Eigen::MatrixXd::Identity(m, m);
+    blockR.bottomRows(m) = localR;
+  }
+  else if(utils::MasterSlave::_slaveMode){
+    utils::MasterSlave::_communication->send(localR.data(), m*m, 0);
+    utils::MasterSlave::_communication->receive(blockR.data(), 2*m*m, 0);
+  }
+  else{
+    int size = utils::MasterSlave::_size;
+    Eigen::MatrixXd stackedR(size*m, m);
+    stackedR.topRows(m) = localR;
+    for(int rankSlave = 1; rankSlave < size; rankSlave++){
+      utils::MasterSlave::_communication->receive(localR.data(), m*m, rankSlave);
+      stackedR.middleRows(rankSlave*m, m) = localR;
+    }
+    Eigen::HouseholderQR<Eigen::MatrixXd> stackedQR(stackedR);
+    Eigen::MatrixXd stackedQ = stackedQR.householderQ() * Eigen::MatrixXd::Identity(size*m, m);
+    blockR.bottomRows(m) = stackedQR.matrixQR().topRows(m).triangularView<Eigen::Upper>();
+    for(int rankSlave = 1; rankSlave < size; rankSlave++){
+      blockR.topRows(m) = stackedQ.middleRows(rankSlave*m, m);
+      utils::MasterSlave::_communication->send(blockR.data(), 2*m*m, rankSlave);
+    }
+    blockR.topRows(m) = stackedQ.topRows(m);
+  }
+
+  _Q = localQ * blockR.topRows(m);
+  _R = blockR.bottomRows(m);
+  _cols = m;
+
+  // positive diagonal of R, as computed by orthogonalize()
+  for(int k=0; k<m; k++){
+    if(_R(k,k) < 0.){
+      _R.row(k) *= -1.;
+      _Q.col(k) *= -1.;
+    }
+  }
+
+  // The column insertion discards a column, if it cannot be orthogonalized within four
+  // Gram-Schmidt passes. A column is certainly inserted, if the first pass already passes
+  // the re-orthogonalization test of orthogonalize(), with rho0 = ||v||, rho1 = ||v_orth||
+  // and t = ||Q^T v||. Otherwise, the caller falls back to the insertion, which decides
+  // on discarding as before. R is the same on all ranks.
+  for(int k=0; k<m; k++){
+    double rho0 = _R.col(k).head(k+1).norm();
+    double rho1 = _R(k,k);
+    double norm_coefficients = _R.col(k).head(k).norm();
+    if(rho1 <= std::numeric_limits<double>::min() || rho1 * _theta <= rho0 + _omega * norm_coefficients){
+      DEBUG("column "<<k<<" needs re-orthogonalization, TSQR is discarded.");
+      return false;
+    }
+  }
+  return true;
+}
+
 void QRFactorization::pushFront(const Eigen::VectorXd& v)
 {
   insertColumn(0, v);
@@ -20,7 +20,8 @@ namespace impl {
 /**
  * @brief Class that provides functionality for a dynamic QR-decomposition, that can be updated 
  * in O(mn) flops if a column is inserted or deleted. 
- * The new colmn is orthogonalized to the existing columns in Q using a modified GramSchmidt algorithm.
+ * The new colmn is orthogonalized to the existing columns in Q using a classical GramSchmidt algorithm
+ * with re-orthogonalization, which needs one allreduce per iteration in master-slave mode.
  * The zero-elements are generated using suitable givens-roatations.
  * The Interface provides fnctions such as insertColumn, deleteColumn at arbitrary position an push or pull 
  * column at front or back, resp. 
@@ -91,6 +92,10 @@ public:
    
    /**
     * @brief resets the QR factorization to be the factorization of A = QR
+    *
+    * The factorization is computed as TSQR, i.e., by a QR of the local rows and a
+    * QR of the stacked local R factors on the master. If a column of A cannot be
+    * orthogonalized to the previous ones, the columns are inserted one after another.
     */
    void reset(
 	Eigen::MatrixXd const& A,
@@ -144,7 +149,7 @@ public:
     * to the defined filter technique. This is done to ensure good conditioning
     * @param [out] delIndices - a vector of indices of deleted columns from the LS-system
     */
-   void applyFilter(double singularityLimit, std::vector<int>& delIndices, Eigen::MatrixXd& V);
+   void applyFilter(double singularityLimit, std::vector<int>& delIndices, const Eigen::MatrixXd& V);
 
    /**
     * @brief returns a matrix representation of the orthogonal matrix Q
@@ -201,9 +206,26 @@ private:
   *
   *   Difference to the method orthogonalize_stable():
   *   if ||v_orth||/||v|| approx 0, no unit vector is inserted.
+  *
+  *   Each iteration computes all Fourier coefficients together with the norm of v,
+  *   i.e., costs a single allreduce in master-slave mode (see project()).
+  *   rhoInit returns the norm of v before the orthogonalization.
+   */
+  int orthogonalize(Eigen::VectorXd& v, Eigen::VectorXd& r, double &rho, double &rhoInit, int colNum);
+
+  /**
+   * @short computes the Fourier coefficients s = Q(:,1:colNum)^T v and the norm of v.
+   *   In master-slave mode, both are summed up over all ranks with a single allreduce.
    */
-  int orthogonalize(Eigen::VectorXd& v, Eigen::VectorXd& r, double &rho, int colNum);
+  void project(const Eigen::VectorXd& v, int colNum, Eigen::VectorXd& s, double &norm);
   
+  /**
+   * @short computes the factorization A = QR of all columns at once as TSQR.
+   *   Returns false, if inserting a column of A one by one would need a
+   *   re-orthogonalization, and hence could discard the column.
+   */
+  bool computeTSQR(Eigen::MatrixXd const& A);
+
   /**
   * @short computes parameters for givens matrix G for which  (x,y)G = (z,0). replaces (x,y) by (z,0)
   */
@@ -5,6 +5,7 @@
 #include "utils/Helpers.hpp"
 #include "logging/Logger.hpp"
 #include "utils/MasterSlave.hpp"
+#include <cmath>
 #include "math/math.hpp"
 
 namespace precice {
@@ -52,27 +53,26 @@ public:
       _isConvergence = false;
    }
 
-   virtual void measure (
-      const  Eigen::VectorXd& oldValues,
-      const  Eigen::VectorXd& newValues,
-      const  Eigen::VectorXd& designSpecification)
+   virtual int getNumberOfSquaredNorms() const
    {
-/*
-     std::cout<<"\n-------"<<std::endl;
-     std::cout<<"   old val: \n"<<oldValues<<std::endl;
-     std::cout<<"   new val: \n"<<newValues<<"\n"<<std::endl;
-     std::cout<<"   design spec: \n"<<designSpecification<<"\n"<<std::endl;
-     std::cout<<"-------\n"<<std::endl;
-*/
-
-     _normDiff = utils::MasterSlave::l2norm((newValues - oldValues) - designSpecification);
-     _norm = utils::MasterSlave::l2norm(newValues + designSpecification);
-     _isConvergence = _normDiff <= _norm * _convergenceLimitPercent;
-//      preciceInfo ( "measure()", "Relative convergence measure: "
-//                    << "two-norm differences = " << normDiff
-//                    << ", convergence limit = "
-//                    << normNew * _convergenceLimitPercent
-//                    << ", convergence = " << _isConvergence );
+      return 2;
+   }
+
+   virtual void computeSquaredNorms (
+      const Eigen::VectorXd& oldValues,
+      const Eigen::VectorXd& newValues,
+      const Eigen::VectorXd& designSpecification,
+      double*                squaredNorms) const
+   {
+      squaredNorms[0] = ((newValues - oldValues) - designSpecification).squaredNorm();
+      squaredNorms[1] = (newValues + designSpecification).squaredNorm();
+   }
+
+   virtual void evaluate ( const double* squaredNorms )
+   {
+      _normDiff = std::sqrt(squaredNorms[0]);
+      _norm = std::sqrt(squaredNorms[1]);
+      _isConvergence = _normDiff <= _norm * _convergenceLimitPercent;
    }
 
    virtual bool isConvergence () const
@@ -7,6 +7,7 @@
 #include "logging/Logger.hpp"
 #include <limits>
 #include "utils/MasterSlave.hpp"
+#include <cmath>
 
 namespace precice {
    namespace cplscheme {
@@ -55,22 +56,28 @@ public:
       _normFirstResidual = std::numeric_limits<double>::max ();
    }
 
-   virtual void measure (
+   virtual int getNumberOfSquaredNorms() const
+   {
+      return 1;
+   }
+
+   virtual void computeSquaredNorms (
       const Eigen::VectorXd& oldValues,
       const Eigen::VectorXd& newValues,
-      const Eigen::VectorXd& designSpecification)
+      const Eigen::VectorXd& designSpecification,
+      double*                squaredNorms) const
+   {
+      squaredNorms[0] = ((newValues - oldValues) - designSpecification).squaredNorm();
+   }
+
+   virtual void evaluate ( const double* squaredNorms )
    {
-      _normDiff = utils::MasterSlave::l2norm((newValues - oldValues) - designSpecification);
+      _normDiff = std::sqrt(squaredNorms[0]);
       if ( _isFirstIteration ) {
          _normFirstResidual = _normDiff;
          _isFirstIteration = false;
       }
       _isConvergence = _normDiff < _normFirstResidual * _convergenceLimitPercent;
-//      preciceInfo ( "measure()", "Residual Relative convergence measure: "
-//                    << "two-norm differences = " << normDiff
-//                    << ", convergence limit = "
-//                    << _normFirstResidual * _convergenceLimitPercent
-//                    << ", convergence = " << _isConvergence );
    }
 
    virtual bool isConvergence () const
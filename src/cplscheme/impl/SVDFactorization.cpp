@@ -5,6 +5,7 @@
 #include "utils/MasterSlave.hpp"
 #include "utils/EventTimings.hpp"
 #include "utils/EigenHelperFunctions.hpp"
+#include "io/Checkpoint.hpp"
 
 using precice::utils::Event;
 
@@ -30,6 +31,7 @@ SVDFactorization::SVDFactorization(
   _globalRows(0),
   _waste(0),
   _truncationEps(eps),
+  _maxRank(0),
   _epsQR2(1e-3),
   _preconditionerApplied(false),
   _initialized(false),
@@ -289,6 +291,39 @@ bool SVDFactorization::isSVDinitialized(){
   return _initialSVD;
 }
 
+void SVDFactorization::exportState(
+    const std::string& prefix,
+    io::Checkpoint&    checkpoint) const
+{
+  checkpoint.add(prefix + ":initialized", (long int) _initialSVD);
+  if(_initialSVD){
+    checkpoint.add(prefix + ":psi", _psi);
+    checkpoint.add(prefix + ":sigma", _sigma);
+    checkpoint.add(prefix + ":phi", _phi);
+  }
+}
+
+void SVDFactorization::importState(
+    const std::string&    prefix,
+    const io::Checkpoint& checkpoint)
+{
+  long int initialized = 0;
+  checkpoint.get(prefix + ":initialized", initialized);
+  _initialSVD = initialized != 0;
+  if(_initialSVD){
+    checkpoint.get(prefix + ":psi", _psi);
+    checkpoint.get(prefix + ":sigma", _sigma);
+    checkpoint.get(prefix + ":phi", _phi);
+    _rows = _psi.rows();
+    _cols = _sigma.size();
+  }
+  else {
+    _psi.resize(0,0);
+    _phi.resize(0,0);
+    _sigma.resize(0);
+  }
+}
+
 void SVDFactorization::setThreshold(double eps)
 {
   _truncationEps = eps;
@@ -299,6 +334,11 @@ double SVDFactorization::getThreshold()
   return _truncationEps;
 }
 
+void SVDFactorization::setMaxRank(int maxRank)
+{
+  _maxRank = maxRank;
+}
+
 int SVDFactorization::getWaste()
 {
   int r = _waste;
@@ -25,6 +25,12 @@
 
 using precice::utils::Event;
 
+namespace precice {
+  namespace io {
+    class Checkpoint;
+  }
+}
+
 // ------- CLASS DEFINITION
 
 namespace precice {
@@ -168,14 +174,17 @@ public:
       */
      _cols = _sigma.size();
 
-     int waste = 0;
      for(int i = 0; i < (int)_sigma.size(); i++){
        if(_sigma(i) < (int)_sigma(0) * _truncationEps){
          _cols = i;
-         waste = _sigma.size()-i;
          break;
        }
      }
+     // keep at most _maxRank modes, if the rank is limited
+     if(_maxRank > 0 && _cols > _maxRank){
+       _cols = _maxRank;
+     }
+     int waste = _sigma.size() - _cols;
      _waste += waste;
 
      _psi.conservativeResize(_rows, _cols);
@@ -231,6 +240,9 @@ public:
    /// @brief: returns the truncation threshold for the SVD
    double getThreshold();
 
+   /// @brief: limits the rank of the truncated SVD to maxRank modes, no limit if maxRank <= 0
+   void setMaxRank(int maxRank);
+
    /// @brief: applies the preconditioner to the factorized and truncated representation of the Jacobian matrix
    //void applyPreconditioner();
 
@@ -246,6 +258,12 @@ public:
 
    bool isSVDinitialized();
 
+   /// @brief: adds the truncated SVD factorization to checkpoint.
+   void exportState(const std::string& prefix, io::Checkpoint& checkpoint) const;
+
+   /// @brief: restores the truncated SVD factorization added by exportState().
+   void importState(const std::string& prefix, const io::Checkpoint& checkpoint);
+
    // @brief optional file-stream for logging output
    void setfstream(std::fstream* stream);
 
@@ -294,6 +312,9 @@ private:
   ///@brief: Truncation parameter for the updated SVD decomposition
   double _truncationEps;
 
+  /// @brief: maximal rank of the truncated SVD, no limit if <= 0
+  int _maxRank;
+
   /// @brief threshold for the QR2 filter for the QR decomposition.
   double _epsQR2;
 
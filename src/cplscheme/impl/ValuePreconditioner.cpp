@@ -1,5 +1,6 @@
 #include "ValuePreconditioner.hpp"
 #include "utils/MasterSlave.hpp"
+#include <cmath>
 
 namespace precice {
 namespace cplscheme {
@@ -22,20 +23,13 @@ void ValuePreconditioner::_update_(bool timestepComplete, const Eigen::VectorXd&
 {
   if(timestepComplete || _firstTimestep){
 
-    std::vector<double> norms(_subVectorSizes.size(),0.0);
-
-    int offset = 0;
+    std::vector<double> norms = computeSquaredSubVectorNorms(oldValues);
     for(size_t k=0; k<_subVectorSizes.size(); k++){
-      Eigen::VectorXd part = Eigen::VectorXd::Zero(_subVectorSizes[k]);
-      for(size_t i=0; i<_subVectorSizes[k]; i++){
-        part(i) = oldValues(i+offset);
-      }
-      norms[k] = utils::MasterSlave::l2norm(part);
-      offset += _subVectorSizes[k];
+      norms[k] = std::sqrt(norms[k]);
       assertion(norms[k]>0.0);
     }
 
-    offset = 0;
+    int offset = 0;
     for(size_t k=0; k<_subVectorSizes.size(); k++){
       for(size_t i=0; i<_subVectorSizes[k]; i++){
         _weights[i+offset] = 1.0 / norms[k];
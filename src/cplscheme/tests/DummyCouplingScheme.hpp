@@ -161,12 +161,12 @@ public:
   /**
    * @brief Empty.
    */
-  virtual void exportState(const std::string& filenamePrefix) const {}
+  virtual void exportState(const std::string& prefix, io::Checkpoint& checkpoint) const {}
 
   /**
    * @brief Empty.
    */
-  virtual void importState(const std::string& filenamePrefix) {}
+  virtual void importState(const std::string& prefix, const io::Checkpoint& checkpoint) {}
 
   /**
    * @brief Empty.
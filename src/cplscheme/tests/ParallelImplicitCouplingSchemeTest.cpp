@@ -58,6 +58,7 @@ void ParallelImplicitCouplingSchemeTest:: run ()
   PRECICE_MASTER_ONLY {
     testMethod(testParseConfigurationWithRelaxation);
     testMethod(testMVQNPP);
+    testMethod(testMVQNPPMatrixFree);
     testMethod(testVIQNPP);
   }
   typedef utils::Parallel Par;
@@ -353,6 +354,7 @@ void ParallelImplicitCouplingSchemeTest:: testMVQNPP()
   int restartType = impl::MVQNPostProcessing::NO_RESTART;
   double singularityLimit = 1e-10;
   double svdTruncationEps = 0.0;
+  int maxStoredColumns = 0;
   bool enforceInitialRelaxation = false;
   bool alwaysBuildJacobian = false;
   std::vector<int> dataIDs;
@@ -366,7 +368,7 @@ void ParallelImplicitCouplingSchemeTest:: testMVQNPP()
   
   cplscheme::impl::MVQNPostProcessing pp(initialRelaxation, enforceInitialRelaxation, maxIterationsUsed,
                                          timestepsReused, filter, singularityLimit, dataIDs, prec, alwaysBuildJacobian,
-                                         restartType, chunkSize, reusedTimestepsAtRestart, svdTruncationEps);
+                                         restartType, chunkSize, reusedTimestepsAtRestart, svdTruncationEps, maxStoredColumns);
   
   Eigen::VectorXd dvalues;
   Eigen::VectorXd dcol1;
@@ -445,6 +447,77 @@ void ParallelImplicitCouplingSchemeTest:: testMVQNPP()
 
 }
 
+void ParallelImplicitCouplingSchemeTest:: testMVQNPPMatrixFree()
+{
+  preciceTrace("testMVQNPPMatrixFree()");
+
+  // Solves the linear fixed-point equation x = A*x + b for several time steps,
+  // with b changing between the time steps.
+  int n = 10;
+  Eigen::MatrixXd A(n, n);
+  for (int i=0; i < n; i++){
+    for (int j=0; j < n; j++){
+      A(i,j) = 0.3 * std::cos(i + 2.0*j) / n;
+    }
+    A(i,i) += 0.5;
+  }
+
+  std::vector<int> dataIDs;
+  dataIDs.push_back(0);
+  std::vector<double> factors(1, 1.0);
+  mesh::PtrMesh dummyMesh ( new mesh::Mesh("dummyMesh", 3, false) );
+
+  // explicit Jacobian, matrix-free with unbounded and with small memory budget
+  int restartTypes[3] = { impl::MVQNPostProcessing::NO_RESTART,
+                          impl::MVQNPostProcessing::MATRIX_FREE,
+                          impl::MVQNPostProcessing::MATRIX_FREE };
+  int maxStoredColumns[3] = { 0, 1000, 4 };
+  std::vector<Eigen::VectorXd> iterates[3];
+
+  for (int run=0; run < 3; run++){
+    impl::PtrPreconditioner prec(new impl::ConstantPreconditioner(factors));
+    impl::MVQNPostProcessing pp(0.1, false, 50, 0, impl::BaseQNPostProcessing::QR1FILTER, 1e-10,
+                                dataIDs, prec, false, restartTypes[run], 0, 0, 0.0, maxStoredColumns[run]);
+    Eigen::VectorXd values = Eigen::VectorXd::Zero(n);
+    PtrCouplingData data(new CouplingData(&values, dummyMesh, false, 1));
+    DataMap dataMap;
+    dataMap.insert(std::make_pair(0, data));
+    pp.initialize(dataMap);
+
+    for (int timestep=0; timestep < 6; timestep++){
+      Eigen::VectorXd b = Eigen::VectorXd::Constant(n, 1.0 + timestep);
+      b(0) = -timestep;
+      for (int iteration=0; iteration < 30; iteration++){
+        values = A * data->oldValues.col(0) + b;
+        double residual = (values - data->oldValues.col(0)).norm();
+        // fixed number of iterations for comparable iterates
+        bool converged = (run < 2) ? iteration == 4 : residual < 1e-10;
+        if (converged){
+          pp.iterationsConverged(dataMap);
+          data->oldValues.col(0) = values;
+          break;
+        }
+        validate(iteration < 29);
+        pp.performPostProcessing(dataMap);
+        data->oldValues.col(0) = values;
+        iterates[run].push_back(values);
+      }
+    }
+    if (run == 2){
+      // the solution of the last time step is reached despite the truncated Jacobian
+      Eigen::VectorXd b = Eigen::VectorXd::Constant(n, 6.0);
+      b(0) = -5.0;
+      Eigen::VectorXd x = (Eigen::MatrixXd::Identity(n, n) - A).lu().solve(b);
+      validate(math::equals(values, x, 1e-8));
+    }
+  }
+
+  validateEquals(iterates[0].size(), iterates[1].size());
+  for (size_t i=0; i < iterates[0].size(); i++){
+    validateWithParams1(math::equals(iterates[0][i], iterates[1][i], 1e-8), i);
+  }
+}
+
 #endif // not PRECICE_NO_MPI
 
 }}}// namespace precice, cplscheme, tests
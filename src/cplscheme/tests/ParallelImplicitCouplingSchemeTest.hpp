@@ -88,6 +88,11 @@ private:
    */
   void testMVQNPP();
 
+  /**
+   * @brief Tests that the matrix-free IMVJ yields the iterates of the IMVJ with explicit Jacobian
+   */
+  void testMVQNPPMatrixFree();
+
   void connect (
       const std::string&     participant0,
       const std::string&     participant1,
@@ -22,6 +22,9 @@
 #include "com/MPIDirectCommunication.hpp"
 #include "com/MPIPortsCommunication.hpp"
 #include "utils/EigenHelperFunctions.hpp"
+#include "io/Checkpoint.hpp"
+#include <cmath>
+#include <sstream>
 
 #include "tarch/tests/TestCaseFactory.h"
 registerTest(precice::cplscheme::tests::PostProcessingMasterSlaveTest)
@@ -65,6 +68,12 @@ void PostProcessingMasterSlaveTest:: run ()
       testMethod(testIMVJ_effUpdate_pp);
       Par::setGlobalCommunicator(Par::getCommunicatorWorld());
     }
+    comm = Par::getRestrictedCommunicator(ranksWanted2);
+    if (Par::getProcessRank() <= 2){
+      Par::setGlobalCommunicator(comm);
+      testMethod(testIMVJRestartCheckpoint);
+      Par::setGlobalCommunicator(Par::getCommunicatorWorld());
+    }
   }
 }
 
@@ -469,6 +478,7 @@ void PostProcessingMasterSlaveTest::testVIQNIMVJpp()
 	int reusedTimeStepsAtRestart = 0;
 	double singularityLimit = 1e-10;
 	double svdTruncationEps = 0.0;
+	int maxStoredColumns = 0;
 	bool enforceInitialRelaxation = false;
 	bool alwaysBuildJacobian = false;
 
@@ -485,7 +495,7 @@ void PostProcessingMasterSlaveTest::testVIQNIMVJpp()
 
 	cplscheme::impl::MVQNPostProcessing pp(initialRelaxation, enforceInitialRelaxation, maxIterationsUsed,
 									   timestepsReused, filter, singularityLimit, dataIDs, prec, alwaysBuildJacobian,
-									   restartType, chunkSize, reusedTimeStepsAtRestart, svdTruncationEps);
+									   restartType, chunkSize, reusedTimeStepsAtRestart, svdTruncationEps, maxStoredColumns);
 
 	Eigen::VectorXd dvalues;
 	Eigen::VectorXd dcol1;
@@ -814,6 +824,7 @@ void PostProcessingMasterSlaveTest::testIMVJ_effUpdate_pp()
   int reusedTimeStepsAtRestart = 0;
   double singularityLimit = 1e-2;
   double svdTruncationEps = 0.0;
+  int maxStoredColumns = 0;
   bool enforceInitialRelaxation = false;
   bool alwaysBuildJacobian = false;
 
@@ -828,7 +839,7 @@ void PostProcessingMasterSlaveTest::testIMVJ_effUpdate_pp()
 
   cplscheme::impl::MVQNPostProcessing pp(initialRelaxation, enforceInitialRelaxation, maxIterationsUsed,
                      timestepsReused, filter, singularityLimit, dataIDs, _preconditioner, alwaysBuildJacobian,
-                     restartType, chunkSize, reusedTimeStepsAtRestart, svdTruncationEps);
+                     restartType, chunkSize, reusedTimeStepsAtRestart, svdTruncationEps, maxStoredColumns);
 
   Eigen::VectorXd dvalues;
   Eigen::VectorXd doldValues;
@@ -1276,6 +1287,118 @@ void PostProcessingMasterSlaveTest::testIMVJ_effUpdate_pp()
 }
 
 
+void PostProcessingMasterSlaveTest::testIMVJRestartCheckpoint()
+{
+  TRACE(); assertion ( utils::Parallel::getCommunicatorSize() == 3 );
+
+  com::Communication::SharedPointer masterSlaveCom = com::Communication::SharedPointer(new com::MPIDirectCommunication());
+  utils::MasterSlave::_communication = masterSlaveCom;
+
+  utils::Parallel::synchronizeProcesses();
+
+  int rank = utils::Parallel::getProcessRank();
+  if (rank == 0) { //Master
+    utils::Parallel::splitCommunicator("SOLIDZMaster");
+    masterSlaveCom->acceptConnection("SOLIDZMaster", "SOLIDZSlaves", 0, 1);
+    masterSlaveCom->setRankOffset(1);
+  } else { //Slaves
+    utils::Parallel::splitCommunicator("SOLIDZSlaves");
+    masterSlaveCom->requestConnection("SOLIDZMaster", "SOLIDZSlaves", rank-1, 2);
+  }
+  utils::MasterSlave::_rank = rank;
+  utils::MasterSlave::_size = 3;
+  utils::MasterSlave::_slaveMode = rank != 0;
+  utils::MasterSlave::_masterMode = rank == 0;
+
+  std::vector<int> dataIDs {4, 5};
+  std::vector<int> vertexOffsets {2, 5, 8};
+  mesh::PtrMesh dummyMesh ( new mesh::Mesh("dummyMesh", 2, false) );
+  dummyMesh->setVertexOffsets(vertexOffsets);
+  int size = 2 * (vertexOffsets[rank] - (rank == 0 ? 0 : vertexOffsets[rank-1]));
+
+  auto initialize = [&](impl::MVQNPostProcessing& pp, Eigen::VectorXd& dvalues,
+                        Eigen::VectorXd& fvalues, DataMap& data)
+  {
+    dvalues = Eigen::VectorXd::Zero(size);
+    fvalues = Eigen::VectorXd::Zero(size);
+    data[4] = PtrCouplingData(new CouplingData(&dvalues, dummyMesh, false, 2));
+    data[5] = PtrCouplingData(new CouplingData(&fvalues, dummyMesh, false, 2));
+    pp.initialize(data);
+  };
+
+  // solves a linear model problem changing in time, converges after a fixed number of iterations
+  auto timestep = [&](impl::MVQNPostProcessing& pp, DataMap& data, int t)
+  {
+    for (int it = 0; it < 4; it++) {
+      data[4]->oldValues.col(0) = *data[4]->values;
+      data[5]->oldValues.col(0) = *data[5]->values;
+      Eigen::VectorXd d = *data[4]->values;
+      Eigen::VectorXd f = *data[5]->values;
+      for (int i = 0; i < size; i++) {
+        double source = std::sin(0.3 * t + 0.7 * i + rank);
+        (*data[4]->values)(i) = 0.5 * f(i) + 0.1 * d((i+1) % size) + source;
+        (*data[5]->values)(i) = -0.4 * d(i) + 0.2 * f(i) + 0.5 * source;
+      }
+      if (it < 3) {
+        pp.performPostProcessing(data);
+      } else {
+        pp.iterationsConverged(data);
+      }
+    }
+  };
+
+  std::vector<int> restartTypes {impl::MVQNPostProcessing::RS_LS, impl::MVQNPostProcessing::RS_SVD};
+  for (int restartType : restartTypes) {
+    // chunks of 2 time steps, i.e., the first restart happens after the third time step
+    std::vector<double> factors {1.0, 1.0};
+    impl::PtrPreconditioner prec(new impl::ConstantPreconditioner(factors));
+    impl::MVQNPostProcessing pp(0.1, false, 30, 0, impl::BaseQNPostProcessing::QR2FILTER, 1e-2, dataIDs,
+                                prec, false, restartType, 2, 2, 1e-3, 0);
+    Eigen::VectorXd dvalues, fvalues;
+    DataMap data;
+    initialize(pp, dvalues, fvalues, data);
+    for (int t = 0; t < 5; t++) {
+      timestep(pp, data, t);
+    }
+
+    std::ostringstream fileName;
+    fileName << "cplscheme-PostProcessingMasterSlaveTest-testIMVJRestartCheckpoint-" << rank << ".ckpt";
+    io::Checkpoint checkpoint;
+    pp.exportState("pp", checkpoint);
+    checkpoint.writeFile(fileName.str());
+    io::Checkpoint restart;
+    restart.readFile(fileName.str());
+
+    impl::PtrPreconditioner restartPrec(new impl::ConstantPreconditioner(factors));
+    impl::MVQNPostProcessing restartPP(0.1, false, 30, 0, impl::BaseQNPostProcessing::QR2FILTER, 1e-2, dataIDs,
+                                       restartPrec, false, restartType, 2, 2, 1e-3, 0);
+    Eigen::VectorXd restartDValues, restartFValues;
+    DataMap restartData;
+    initialize(restartPP, restartDValues, restartFValues, restartData);
+    restartPP.importState("pp", restart);
+    restartDValues = dvalues;
+    restartFValues = fvalues;
+
+    // both continue through another restart
+    for (int t = 5; t < 9; t++) {
+      timestep(pp, data, t);
+      timestep(restartPP, restartData, t);
+      for (int i = 0; i < size; i++) {
+        validateWithParams4(math::equals(restartDValues(i), dvalues(i), 1e-10),
+                            restartType, t, restartDValues(i), dvalues(i));
+        validateWithParams4(math::equals(restartFValues(i), fvalues(i), 1e-10),
+                            restartType, t, restartFValues(i), fvalues(i));
+      }
+    }
+  }
+
+  utils::MasterSlave::_communication->closeConnection();
+  utils::MasterSlave::_slaveMode = false;
+  utils::MasterSlave::_masterMode = false;
+  utils::Parallel::clearGroups();
+  utils::MasterSlave::_communication = nullptr;
+}
+
 }}} // namespace precice, geometry, tests
 
 #endif // PRECICE_NO_MPI
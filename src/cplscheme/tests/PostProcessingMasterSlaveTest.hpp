@@ -61,6 +61,11 @@ private:
 
    void testIMVJ_effUpdate_pp();
 
+   /**
+    * @brief Tests that IMVJ in restart mode continues identically after a checkpoint round trip
+    */
+   void testIMVJRestartCheckpoint();
+
 # endif // not PRECICE_NO_MPI
 };
 
@@ -23,6 +23,7 @@ QRFactorizationTest::QRFactorizationTest ()
 void QRFactorizationTest::run ()
 {
   testMethod (testQRFactorization);
+  testMethod (testResetWithMatrix);
 }
 
 void QRFactorizationTest::testQRFactorization ()
@@ -168,6 +169,50 @@ void QRFactorizationTest::testQRFactorization ()
 }
 
 
+void QRFactorizationTest::testResetWithMatrix ()
+{
+  int m = 6, n = 8;
+  int filter = impl::BaseQNPostProcessing::QR1FILTER;
+  Eigen::MatrixXd A(n,m);
+  for (int i=0; i < n; i++) {
+     for (int j=0; j < m; j++) {
+        A(i,j) = 1.0 / static_cast<double>(i + j + 1);
+     }
+  }
+
+  // factorization of all columns at once equals the one of successive inserting
+  impl::QRFactorization qr_1(A, filter);
+  impl::QRFactorization qr_2(filter);
+  qr_2.reset(A, A.rows());
+  validateEquals(qr_2.cols(), m);
+  testQTQequalsIdentity(qr_2.matrixQ());
+  testQRequalsA(qr_2.matrixQ(), qr_2.matrixR(), A);
+  for (int i=0; i < m; i++) {
+    for (int j=0; j < m; j++) {
+      validate (math::equals(qr_2.matrixR()(i,j), qr_1.matrixR()(i,j), 1e-8));
+    }
+  }
+
+  // nearly orthogonal columns, which are inserted without re-orthogonalization
+  Eigen::MatrixXd B = Eigen::MatrixXd::Identity(n,m);
+  for (int i=0; i < n; i++) {
+     for (int j=0; j < m; j++) {
+        B(i,j) += 0.1 / static_cast<double>(i + j + 1);
+     }
+  }
+  impl::QRFactorization qr_3(B, filter);
+  impl::QRFactorization qr_4(filter);
+  qr_4.reset(B, B.rows());
+  validateEquals(qr_4.cols(), m);
+  testQTQequalsIdentity(qr_4.matrixQ());
+  testQRequalsA(qr_4.matrixQ(), qr_4.matrixR(), B);
+  for (int i=0; i < m; i++) {
+    for (int j=0; j < m; j++) {
+      validate (math::equals(qr_4.matrixR()(i,j), qr_3.matrixR()(i,j), 1e-12));
+    }
+  }
+}
+
 void QRFactorizationTest::testQRequalsA(
   Eigen::MatrixXd& Q, 
   Eigen::MatrixXd& R, 
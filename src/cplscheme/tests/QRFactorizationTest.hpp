@@ -23,6 +23,11 @@ private:
    * Tests constructors.
    */
   void testQRFactorization ();
+
+  /**
+   * Tests that reset() with a matrix gives the factorization of the column insertion.
+   */
+  void testResetWithMatrix ();
   
   void testQTQequalsIdentity(Eigen::MatrixXd& Q);
 
@@ -22,6 +22,7 @@ void RelativeConvergenceMeasureTest:: run ()
 {
   PRECICE_MASTER_ONLY {
     testMethod ( testMeasureData );
+    testMethod ( testMeasureSquaredNorms );
   }
 }
 
@@ -49,4 +50,35 @@ void RelativeConvergenceMeasureTest:: testMeasureData ()
   validate ( measure.isConvergence() );
 }
 
+void RelativeConvergenceMeasureTest:: testMeasureSquaredNorms ()
+{
+  TRACE();
+  impl::RelativeConvergenceMeasure measure ( 0.1 );
+  validateEquals ( measure.getNumberOfSquaredNorms(), 2 );
+
+  Eigen::VectorXd oldValues(4);
+  Eigen::VectorXd newValues(4);
+  Eigen::VectorXd designSpec = Eigen::VectorXd::Zero(4);
+  oldValues << 2.9, 2.9, 1.0, 1.0;
+  newValues << 3.0, 3.0, 1.0, 1.0;
+
+  // Sum up the squared norms of two partitions, as done by an allreduce
+  double squaredNorms[2] = { 0.0, 0.0 };
+  double partialSquaredNorms[2];
+  for (int offset=0; offset < 4; offset += 2){
+    measure.computeSquaredNorms ( oldValues.segment(offset, 2), newValues.segment(offset, 2),
+                                  designSpec.segment(offset, 2), partialSquaredNorms );
+    squaredNorms[0] += partialSquaredNorms[0];
+    squaredNorms[1] += partialSquaredNorms[1];
+  }
+  measure.evaluate ( squaredNorms );
+  validate ( measure.isConvergence() );
+  double splitResidual = measure.getNormResidual();
+
+  measure.measure ( oldValues, newValues, designSpec );
+  validate ( measure.isConvergence() );
+  validateNumericalEquals ( measure.getNormResidual(), splitResidual );
+  validateNumericalEquals ( splitResidual, std::sqrt(0.02) / std::sqrt(20.0) );
+}
+
 }}} // namespace precice, cplscheme, tests
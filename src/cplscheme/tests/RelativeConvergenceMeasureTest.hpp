@@ -45,6 +45,11 @@ private:
     */
    void testMeasureData ();
 
+   /**
+    * @brief Tests measurement from squared norms summed up over partitions of the data.
+    */
+   void testMeasureSquaredNorms ();
+
    /**
     * @brief Tests convergence measurement with double datasets.
     */
@@ -0,0 +1,114 @@
+// Driver of precice-bench, the micro-benchmarks of mesh construction, mappings,
+// post-processing and M2N communication. Build with "scons precice-bench".
+//
+// Usage: mpirun -np 4 ./precice-bench [--benchmarks mesh mapping post-processing m2n]
+//                                     [--sizes 1000 10000] [--columns 10 50] ...
+//
+// Mesh, mapping and post-processing benchmarks run on rank 0, with the threads
+// given by --threads (default 1). The M2N benchmarks split the (even) ranks into
+// two participants and need at least 4 processes. All random numbers are drawn
+// from a fixed seed. Rank 0 prints one line per result and writes all results as
+// JSON to the output file, see benchmarks::Report::write().
+
+#include "benchmarks/Benchmark.hpp"
+#include "logging/LogConfiguration.hpp"
+#include "utils/Parallel.hpp"
+#include "utils/Petsc.hpp"
+#include "utils/Threads.hpp"
+#include <boost/program_options.hpp>
+#include <algorithm>
+#include <fstream>
+#include <iostream>
+
+#if !defined(PRECICE_NO_PETSC) && !defined(PRECICE_NO_MPI)
+#include "petscsys.h"
+#endif
+
+namespace po = boost::program_options;
+
+int main ( int argc, char** argv )
+{
+  using namespace precice;
+  benchmarks::Options options;
+  std::vector<std::string> selected {"mesh", "mapping", "post-processing", "m2n"};
+  std::string outputFile;
+
+  po::options_description description("Options of precice-bench");
+  description.add_options()
+    ("help", "Prints this help")
+    ("benchmarks", po::value(&selected)->multitoken(),
+     "Benchmarks to run, out of mesh, mapping, post-processing and m2n (default all)")
+    ("sizes", po::value(&options.sizes)->multitoken(),
+     "Mesh vertices of mesh and mapping, unknowns n of post-processing (default 1000 10000)")
+    ("exchange-sizes", po::value(&options.exchangeSizes)->multitoken(),
+     "Vertices exchanged by m2n (default 10000 100000)")
+    ("columns", po::value(&options.columns)->multitoken(),
+     "Columns m of post-processing (default 10 50)")
+    ("repetitions", po::value(&options.repetitions), "Timed runs per case (default 5)")
+    ("seed", po::value(&options.seed), "Seed of the random numbers (default 1)")
+    ("dense-limit", po::value(&options.denseLimit),
+     "Maximal size of dense RBF mappings and the explicit IMVJ (default 2000)")
+    ("threads", po::value(&options.threads),
+     "Threads of mesh, mapping and post-processing, 0 for one per core (default 1)")
+    ("output", po::value(&outputFile)->default_value("precice-bench.json"), "JSON output file");
+
+  po::variables_map arguments;
+  try {
+    po::store(po::parse_command_line(argc, argv, description), arguments);
+    po::notify(arguments);
+  }
+  catch (const po::error& error) {
+    std::cerr << error.what() << std::endl << description << std::endl;
+    return 1;
+  }
+  if (arguments.count("help")){
+    std::cout << description << std::endl;
+    return 0;
+  }
+  auto isSelected = [&](const std::string& name){
+    return std::find(selected.begin(), selected.end(), name) != selected.end();
+  };
+
+  logging::setupLogging();
+  utils::Parallel::initializeMPI(&argc, &argv);
+  logging::setMPIRank(utils::Parallel::getProcessRank());
+# if !defined(PRECICE_NO_PETSC) && !defined(PRECICE_NO_MPI)
+  // The PETSc RBF mappings run serially on rank 0 as all other mappings
+  PETSC_COMM_WORLD = MPI_COMM_SELF;
+# endif
+  utils::Petsc::initialize(&argc, &argv);
+  utils::Threads::setNumberOfThreads(options.threads);
+
+  bool isMaster = utils::Parallel::getProcessRank() == 0;
+  std::ostream* out = isMaster ? &std::cout : nullptr;
+  benchmarks::Report report;
+  if (isMaster){
+    if (isSelected("mesh")){
+      benchmarks::runMeshBenchmarks(options, report, out);
+    }
+    if (isSelected("mapping")){
+      benchmarks::runMappingBenchmarks(options, report, out);
+    }
+    if (isSelected("post-processing")){
+      benchmarks::runPostProcessingBenchmarks(options, report, out);
+    }
+  }
+  utils::Parallel::synchronizeProcesses();
+  if (isSelected("m2n")){
+    benchmarks::runM2NBenchmarks(options, report, out);
+  }
+
+  int status = 0;
+  if (isMaster){
+    std::ofstream outFile(outputFile);
+    report.write(outFile, options, utils::Parallel::getCommunicatorSize());
+    if (not outFile){
+      std::cerr << "Writing the results to " << outputFile << " failed" << std::endl;
+      status = 1;
+    }
+  }
+  utils::Parallel::synchronizeProcesses();
+  utils::Petsc::finalize();
+  utils::Parallel::finalizeMPI();
+  return status;
+}
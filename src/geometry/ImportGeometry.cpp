@@ -1,6 +1,7 @@
 #include "ImportGeometry.hpp"
 #include "io/Import.hpp"
 #include "io/ImportVRML.hpp"
+#include "io/Checkpoint.hpp"
 #include "mesh/Mesh.hpp"
 #include "mesh/SharedPointer.hpp"
 #include "utils/Globals.hpp"
@@ -36,6 +37,12 @@ void ImportGeometry:: specializedCreate
       import.doImport ( _fileName, seed );
     }
   }
+  else if ( _fileType == CHECKPOINT_FILE ){
+    assertion ( _importCheckpoint );
+    io::Checkpoint checkpoint;
+    checkpoint.readFile ( _fileName );
+    checkpoint.restoreMesh ( seed, _createMesh );
+  }
 }
 
 void ImportGeometry:: allocateDataValues
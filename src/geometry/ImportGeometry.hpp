@@ -19,7 +19,9 @@ public:
    * @brief Possible file types to be imported.
    */
   enum FileType {
-   VRML_1_FILE
+   VRML_1_FILE,
+   // Binary checkpoint written by io::Checkpoint
+   CHECKPOINT_FILE
   };
 
   /**
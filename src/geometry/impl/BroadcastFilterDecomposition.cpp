@@ -45,7 +45,8 @@ void BroadcastFilterDecomposition:: broadcast(
 {
   preciceTrace ( "broadcast()", utils::MasterSlave::_rank );
   preciceInfo("broadcast()", "Broadcast mesh " << seed.getName() );
-  Event e("broadcast mesh");
+  static const int eventID = utils::EventRegistry::getID("broadcast mesh");
+  Event e(eventID);
 
 
   if (utils::MasterSlave::_slaveMode) {
@@ -64,7 +65,8 @@ void BroadcastFilterDecomposition:: filter(
 {
   preciceTrace ( "filter()", utils::MasterSlave::_rank );
   preciceInfo("filter()", "Filter mesh " << seed.getName() );
-  Event e("filter mesh");
+  static const int eventID = utils::EventRegistry::getID("filter mesh");
+  Event e(eventID);
 
   // first, bounding box filter
   DEBUG("First Filter BB, #vertices " << seed.vertices().size());
@@ -144,8 +144,7 @@ bool Decomposition:: doesVertexContribute(
     }
     return exit;
   }
-  else if((_boundingToMapping.use_count() > 0 && not _boundingToMapping->isProjectionMapping()) ||
-          (_boundingFromMapping.use_count() > 0 && not _boundingFromMapping->isProjectionMapping())){
+  else if(not isFilteringByBoundingBox()){
     //if we have at least one non-projection mapping (i.e. RBF mapping), we should not filter here
     return true;
   }
@@ -159,4 +158,11 @@ bool Decomposition:: doesVertexContribute(
   }
 }
 
+bool Decomposition:: isFilteringByBoundingBox() const
+{
+  return not _filterByMapping
+         && not (_boundingToMapping.use_count() > 0 && not _boundingToMapping->isProjectionMapping())
+         && not (_boundingFromMapping.use_count() > 0 && not _boundingFromMapping->isProjectionMapping());
+}
+
 }}} // namespace precice, geometry, impl
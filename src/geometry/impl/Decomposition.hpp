@@ -70,6 +70,9 @@ protected:
   /// Returns true if a vertex contributes. If false, the vertex can be erased.
   bool doesVertexContribute(const mesh::Vertex& vertex);
 
+  /// Returns true if doesVertexContribute() filters by the bounding box _bb and the safety gap.
+  bool isFilteringByBoundingBox() const;
+
   void mergeBoundingBoxes(mesh::Mesh::BoundingBox& bb);
 
   /**
@@ -7,9 +7,12 @@
 #include "mesh/Edge.hpp"
 #include "mesh/Triangle.hpp"
 #include "mesh/SharedPointer.hpp"
+#include "query/VertexIndex.hpp"
 #include "utils/Globals.hpp"
 #include "utils/Helpers.hpp"
 #include "utils/EventTimings.hpp"
+#include <algorithm>
+#include <numeric>
 
 using precice::utils::Event;
 
@@ -48,7 +51,8 @@ void PreFilterPostFilterDecomposition:: preFilter(
 {
   preciceTrace ( "preFilter()", utils::MasterSlave::_rank );
   preciceInfo("preFilter()", "Pre-filter mesh " << seed.getName() );
-  Event e("pre-filter mesh");
+  static const int eventID = utils::EventRegistry::getID("pre-filter mesh");
+  Event e(eventID);
 
   assertion(not _filterByMapping);
 
@@ -63,6 +67,13 @@ void PreFilterPostFilterDecomposition:: preFilter(
     assertion(utils::MasterSlave::_rank==0);
     assertion(utils::MasterSlave::_size>1);
 
+    bool byBoundingBox = isFilteringByBoundingBox();
+    // The index does not own the seed mesh and is built on the first query
+    query::VertexIndex index(mesh::PtrMesh(&seed, [](mesh::Mesh*){}));
+    if (byBoundingBox) {
+      computeAdjacency(seed);
+    }
+
     for (int rankSlave = 1; rankSlave < utils::MasterSlave::_size; rankSlave++) {
       _bb = mesh::Mesh::BoundingBox (_dimensions, std::make_pair(0.0,0.0));
       com::CommunicateMesh(utils::MasterSlave::_communication).receiveBoundingBox ( _bb, rankSlave);
@@ -77,7 +88,9 @@ void PreFilterPostFilterDecomposition:: preFilter(
       DEBUG("From slave " << rankSlave << ", bounding mesh: " << _bb[0].first
                    << ", " << _bb[0].second << " and " << _bb[1].first << ", " << _bb[1].second);
       mesh::Mesh slaveMesh("SlaveMesh", _dimensions, seed.isFlipNormals());
-      boundingVertexDistribution[rankSlave] = filterMesh(seed, slaveMesh);
+      boundingVertexDistribution[rankSlave] = byBoundingBox
+          ? filterMeshInBoundingBox(seed, slaveMesh, index)
+          : filterMesh(seed, slaveMesh);
       com::CommunicateMesh(utils::MasterSlave::_communication).sendMesh ( slaveMesh, rankSlave );
     }
 
@@ -91,20 +104,147 @@ void PreFilterPostFilterDecomposition:: preFilter(
     }
     _safetyGap *= _safetyFactor;
     mesh::Mesh filteredMesh("FilteredMesh", _dimensions, seed.isFlipNormals());
-    boundingVertexDistribution[0] = filterMesh(seed, filteredMesh);
+    boundingVertexDistribution[0] = byBoundingBox
+        ? filterMeshInBoundingBox(seed, filteredMesh, index)
+        : filterMesh(seed, filteredMesh);
+    _vertexEdgeOffsets.clear();
+    _vertexEdges.clear();
+    _edgeTriangleOffsets.clear();
+    _edgeTriangles.clear();
+    _filteredVertices.clear();
+    _filteredEdges.clear();
     seed.clear(); //clear global mesh on master
     seed.addMesh(filteredMesh);
     DEBUG("Master mesh after filtering, #vertices " << seed.vertices().size());
   }
 }
 
+void PreFilterPostFilterDecomposition:: computeAdjacency(
+  mesh::Mesh& seed)
+{
+  preciceTrace("computeAdjacency()", seed.vertices().size(), seed.edges().size());
+  int vertexCount = seed.vertices().size();
+  int edgeCount = seed.edges().size();
+
+  _vertexEdgeOffsets.assign(vertexCount + 1, 0);
+  for (mesh::Edge& edge : seed.edges()) {
+    assertion(edge.getID() < edgeCount, edge.getID(), edgeCount);
+    _vertexEdgeOffsets[edge.vertex(0).getID() + 1]++;
+    if (edge.vertex(1).getID() != edge.vertex(0).getID()) {
+      _vertexEdgeOffsets[edge.vertex(1).getID() + 1]++;
+    }
+  }
+  std::partial_sum(_vertexEdgeOffsets.begin(), _vertexEdgeOffsets.end(), _vertexEdgeOffsets.begin());
+  _vertexEdges.resize(_vertexEdgeOffsets.back());
+  std::vector<int> next(_vertexEdgeOffsets.begin(), _vertexEdgeOffsets.end() - 1);
+  for (int i=0; i < edgeCount; i++) {
+    mesh::Edge& edge = seed.edges()[i];
+    _vertexEdges[next[edge.vertex(0).getID()]++] = i;
+    if (edge.vertex(1).getID() != edge.vertex(0).getID()) {
+      _vertexEdges[next[edge.vertex(1).getID()]++] = i;
+    }
+  }
+
+  _edgeTriangleOffsets.assign(edgeCount + 1, 0);
+  if (_dimensions == 3) {
+    for (mesh::Triangle& triangle : seed.triangles()) {
+      _edgeTriangleOffsets[triangle.edge(0).getID() + 1]++;
+    }
+    std::partial_sum(_edgeTriangleOffsets.begin(), _edgeTriangleOffsets.end(), _edgeTriangleOffsets.begin());
+    _edgeTriangles.resize(_edgeTriangleOffsets.back());
+    next.assign(_edgeTriangleOffsets.begin(), _edgeTriangleOffsets.end() - 1);
+    for (int i=0; i < (int) seed.triangles().size(); i++) {
+      _edgeTriangles[next[seed.triangles()[i].edge(0).getID()]++] = i;
+    }
+  }
+
+  _filteredVertices.assign(vertexCount, nullptr);
+  _filteredEdges.assign(edgeCount, nullptr);
+}
+
+std::vector<int> PreFilterPostFilterDecomposition:: filterMeshInBoundingBox(
+  mesh::Mesh&         seed,
+  mesh::Mesh&         filteredMesh,
+  query::VertexIndex& index)
+{
+  preciceTrace("filterMeshInBoundingBox()", utils::MasterSlave::_rank);
+  assertion(isFilteringByBoundingBox());
+  Eigen::VectorXd lower(_dimensions);
+  Eigen::VectorXd upper(_dimensions);
+  for (int d=0; d < _dimensions; d++) {
+    lower[d] = _bb[d].first - _safetyGap;
+    upper[d] = _bb[d].second + _safetyGap;
+  }
+  std::vector<int> vertexPositions;
+  index.getVerticesInBox(lower, upper, vertexPositions);
+
+  filteredMesh.reserveVertices(vertexPositions.size());
+  for (int position : vertexPositions) {
+    assertion(seed.vertices()[position].getID() == position, seed.vertices()[position].getID(), position);
+    _filteredVertices[position] = &filteredMesh.createVertex(seed.vertices()[position].getCoords());
+  }
+
+  // Edges formed by the contributing vertices, visited from their first vertex
+  std::vector<int> edgePositions;
+  for (int position : vertexPositions) {
+    for (int i=_vertexEdgeOffsets[position]; i < _vertexEdgeOffsets[position+1]; i++) {
+      mesh::Edge& edge = seed.edges()[_vertexEdges[i]];
+      if ((edge.vertex(0).getID() == position) && (_filteredVertices[edge.vertex(1).getID()] != nullptr)) {
+        edgePositions.push_back(_vertexEdges[i]);
+      }
+    }
+  }
+  std::sort(edgePositions.begin(), edgePositions.end());
+  filteredMesh.reserveEdges(edgePositions.size());
+  for (int position : edgePositions) {
+    mesh::Edge& edge = seed.edges()[position];
+    _filteredEdges[position] = &filteredMesh.createEdge(*_filteredVertices[edge.vertex(0).getID()],
+                                                        *_filteredVertices[edge.vertex(1).getID()]);
+  }
+
+  // Triangles formed by the contributing edges, visited from their first edge
+  if (_dimensions == 3) {
+    std::vector<int> trianglePositions;
+    for (int position : edgePositions) {
+      for (int i=_edgeTriangleOffsets[position]; i < _edgeTriangleOffsets[position+1]; i++) {
+        mesh::Triangle& triangle = seed.triangles()[_edgeTriangles[i]];
+        if ((_filteredEdges[triangle.edge(1).getID()] != nullptr) &&
+            (_filteredEdges[triangle.edge(2).getID()] != nullptr)) {
+          trianglePositions.push_back(_edgeTriangles[i]);
+        }
+      }
+    }
+    std::sort(trianglePositions.begin(), trianglePositions.end());
+    filteredMesh.reserveTriangles(trianglePositions.size());
+    for (int position : trianglePositions) {
+      mesh::Triangle& triangle = seed.triangles()[position];
+      filteredMesh.createTriangle(*_filteredEdges[triangle.edge(0).getID()],
+                                  *_filteredEdges[triangle.edge(1).getID()],
+                                  *_filteredEdges[triangle.edge(2).getID()]);
+    }
+  }
+
+  for (int position : vertexPositions) {
+    _filteredVertices[position] = nullptr;
+  }
+  for (int position : edgePositions) {
+    _filteredEdges[position] = nullptr;
+  }
+
+  DEBUG("Filtered mesh. #vertices: " << filteredMesh.vertices().size()
+        << ", #edges: " << filteredMesh.edges().size()
+        << ", #triangles: " << filteredMesh.triangles().size());
+  return vertexPositions;
+}
+
 void PreFilterPostFilterDecomposition:: postFilter(
   mesh::Mesh& seed,
   std::vector<int>& filteredVertexPositions)
 {
   preciceTrace ( "postFilter()", utils::MasterSlave::_rank );
   preciceInfo("postFilter()", "Post-filter mesh " << seed.getName() );
-  Event e("post-filter mesh");
+  static const int eventID = utils::EventRegistry::getID("post-filter mesh");
+  Event e(eventID);
 
   seed.computeState();
   computeBoundingMappings();
@@ -122,7 +262,8 @@ void PreFilterPostFilterDecomposition:: feedback(
 {
   preciceTrace ( "feedback()", utils::MasterSlave::_rank );
   preciceInfo("feedback()", "Feedback mesh " << seed.getName() );
-  Event e("feedback mesh");
+  static const int eventID = utils::EventRegistry::getID("feedback mesh");
+  Event e(eventID);
 
   int numberOfVertices = filteredVertexPositions.size();
 
@@ -7,6 +7,17 @@
 #include <map>
 #include <vector>
 
+namespace precice {
+  namespace query {
+    class VertexIndex;
+  }
+  namespace geometry {
+    namespace tests {
+      class CommunicatedGeometryTest;
+    }
+  }
+}
+
 namespace precice {
 namespace geometry {
 namespace impl {
@@ -14,6 +25,11 @@ namespace impl {
 /**
  * @brief Decomposes a geometry resp. mesh by applying a pre-filter first (bounding box) on the master
  * and a post-filter, afterwards, on each slave.
+ *
+ * When filtering by bounding boxes, the master answers the bounding box of each
+ * slave with a spatial index over the seed mesh and the adjacency of its
+ * vertices, edges, and triangles. The work per slave is then proportional to
+ * the size of its filtered mesh, instead of the size of the seed mesh.
  */
 class PreFilterPostFilterDecomposition : public Decomposition
 {
@@ -27,6 +43,8 @@ public:
 
 private:
 
+  friend class tests::CommunicatedGeometryTest; // For whitebox tests
+
   /**
    * @brief Decomposes the geometry.
    */
@@ -49,8 +67,37 @@ private:
     std::map<int,std::vector<int> >& boundingVertexDistribution,
     std::vector<int>& filteredVertexPositions);
 
+  /// Builds the vertex-edge and edge-triangle adjacency of the seed mesh.
+  void computeAdjacency(
+    mesh::Mesh& seed);
+
+  /**
+   * @brief Filters the seed mesh by the bounding box, gives the same result as filterMesh().
+   *
+   * Only visits the vertices within the bounding box and their edges and triangles.
+   * Requires isFilteringByBoundingBox() and computeAdjacency().
+   */
+  std::vector<int> filterMeshInBoundingBox(
+    mesh::Mesh&         seed,
+    mesh::Mesh&         filteredMesh,
+    query::VertexIndex& index);
+
   /// Logging device.
   static logging::Logger _log;
+
+  /// Edge positions adjacent to each seed vertex, in compressed row storage.
+  std::vector<int> _vertexEdgeOffsets;
+  std::vector<int> _vertexEdges;
+
+  /// Triangle positions adjacent to each seed edge, in compressed row storage.
+  std::vector<int> _edgeTriangleOffsets;
+  std::vector<int> _edgeTriangles;
+
+  /// Filtered copy of each seed vertex while filtering, else NULL.
+  std::vector<mesh::Vertex*> _filteredVertices;
+
+  /// Filtered copy of each seed edge while filtering, else NULL.
+  std::vector<mesh::Edge*> _filteredEdges;
 };
 
 }}} // namespace precice, geometry, filter
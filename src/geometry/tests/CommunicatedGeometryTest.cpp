@@ -8,6 +8,8 @@
 #include "geometry/impl/PreFilterPostFilterDecomposition.hpp"
 #include "geometry/impl/BroadcastFilterDecomposition.hpp"
 #include "mesh/Mesh.hpp"
+#include "mesh/Edge.hpp"
+#include "mesh/Triangle.hpp"
 #include "utils/Parallel.hpp"
 #include "mapping/SharedPointer.hpp"
 #include "mapping/NearestProjectionMapping.hpp"
@@ -17,6 +19,8 @@
 #include "m2n/GatherScatterComFactory.hpp"
 #include "utils/Globals.hpp"
 #include "utils/MasterSlave.hpp"
+#include "query/VertexIndex.hpp"
+#include "math/math.hpp"
 
 #include "tarch/tests/TestCaseFactory.h"
 registerTest(precice::geometry::tests::CommunicatedGeometryTest)
@@ -37,6 +41,9 @@ void CommunicatedGeometryTest:: run ()
 {
   preciceTrace ( "run" );
   typedef utils::Parallel Par;
+  if (Par::getProcessRank() == 0){
+    testMethod ( testFilterMeshInBoundingBox );
+  }
   if (Par::getCommunicatorSize() > 3){
     const std::vector<int> ranksWanted = {0, 1, 2, 3};
     MPI_Comm comm = Par::getRestrictedCommunicator(ranksWanted);
@@ -366,6 +373,85 @@ void CommunicatedGeometryTest:: testGatherMesh ()
 }
 
 
+void CommunicatedGeometryTest:: testFilterMeshInBoundingBox ()
+{
+  preciceTrace ( "testFilterMeshInBoundingBox" );
+  int dim = 3;
+  mesh::PtrMesh seed(new mesh::Mesh("Seed", dim, false));
+
+  // Triangulated grid of n x n vertices on a curved surface
+  int n = 10;
+  std::vector<mesh::Vertex*> vertices;
+  for (int j=0; j < n; j++){
+    for (int i=0; i < n; i++){
+      vertices.push_back(&seed->createVertex(Eigen::Vector3d(0.1*i, 0.1*j, 0.01*i*j)));
+    }
+  }
+  auto vertex = [&](int i, int j) -> mesh::Vertex& { return *vertices[j*n + i]; };
+  for (int j=0; j < n-1; j++){
+    for (int i=0; i < n-1; i++){
+      mesh::Edge& bottom = seed->createEdge(vertex(i,j), vertex(i+1,j));
+      // Edge with the higher vertex ID first
+      mesh::Edge& right = seed->createEdge(vertex(i+1,j+1), vertex(i+1,j));
+      mesh::Edge& diagonal = seed->createEdge(vertex(i,j), vertex(i+1,j+1));
+      seed->createTriangle(bottom, right, diagonal);
+      mesh::Edge& top = seed->createEdge(vertex(i+1,j+1), vertex(i,j+1));
+      mesh::Edge& left = seed->createEdge(vertex(i,j+1), vertex(i,j));
+      seed->createTriangle(diagonal, top, left);
+    }
+  }
+  // Edge without triangle
+  seed->createEdge(vertex(0,0), vertex(n-1,n-1));
+
+  impl::PreFilterPostFilterDecomposition decomposition(dim, 0.0);
+  validate ( decomposition.isFilteringByBoundingBox() );
+  decomposition.computeAdjacency(*seed);
+  query::VertexIndex index(seed);
+
+  // Empty, partial, and complete bounding boxes
+  std::vector<std::pair<Eigen::Vector3d,Eigen::Vector3d>> boxes = {
+    { Eigen::Vector3d(2.0, 2.0, 2.0), Eigen::Vector3d(3.0, 3.0, 3.0) },
+    { Eigen::Vector3d(0.15, 0.25, -1.0), Eigen::Vector3d(0.55, 0.65, 1.0) },
+    { Eigen::Vector3d(-1.0, 0.35, 0.0), Eigen::Vector3d(0.45, 2.0, 0.1) },
+    { Eigen::Vector3d(0.0, 0.0, 0.0), Eigen::Vector3d(0.9, 0.9, 0.81) } };
+  std::vector<double> safetyGaps = { 0.0, 0.05 };
+  for (const auto& box : boxes){
+    for (double safetyGap : safetyGaps){
+      decomposition._bb = mesh::Mesh::BoundingBox(dim);
+      for (int d=0; d < dim; d++){
+        decomposition._bb[d] = std::make_pair(box.first[d], box.second[d]);
+      }
+      decomposition._safetyGap = safetyGap;
+
+      mesh::Mesh expectedMesh("Expected", dim, false);
+      std::vector<int> expectedPositions = decomposition.filterMesh(*seed, expectedMesh);
+      mesh::Mesh filteredMesh("Filtered", dim, false);
+      std::vector<int> positions = decomposition.filterMeshInBoundingBox(*seed, filteredMesh, index);
+
+      validate ( positions == expectedPositions );
+      validateEquals ( filteredMesh.vertices().size(), expectedMesh.vertices().size() );
+      for (size_t i=0; i < filteredMesh.vertices().size(); i++){
+        validate ( math::equals(filteredMesh.vertices()[i].getCoords(),
+                                expectedMesh.vertices()[i].getCoords()) );
+      }
+      validateEquals ( filteredMesh.edges().size(), expectedMesh.edges().size() );
+      for (size_t i=0; i < filteredMesh.edges().size(); i++){
+        for (int k=0; k < 2; k++){
+          validateEquals ( filteredMesh.edges()[i].vertex(k).getID(),
+                           expectedMesh.edges()[i].vertex(k).getID() );
+        }
+      }
+      validateEquals ( filteredMesh.triangles().size(), expectedMesh.triangles().size() );
+      for (size_t i=0; i < filteredMesh.triangles().size(); i++){
+        for (int k=0; k < 3; k++){
+          validateEquals ( filteredMesh.triangles()[i].vertex(k).getID(),
+                           expectedMesh.triangles()[i].vertex(k).getID() );
+        }
+      }
+    }
+  }
+}
+
 }}} // namespace precice, geometry, tests
 
 #endif // PRECICE_NO_MPI
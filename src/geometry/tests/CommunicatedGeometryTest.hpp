@@ -35,6 +35,11 @@ private:
    void testScatterMesh ();
 
    void testGatherMesh ();
+
+   /**
+    * @brief Compares filtering by bounding box through the spatial index with Decomposition::filterMesh().
+    */
+   void testFilterMeshInBoundingBox ();
 };
 
 }}} // namespace precice, geometry, tests
@@ -0,0 +1,79 @@
+#include "BackgroundWriter.hpp"
+#include "utils/Globals.hpp"
+
+namespace precice {
+namespace io {
+
+logging::Logger BackgroundWriter:: _log ( "precice::io::BackgroundWriter" );
+
+BackgroundWriter:: BackgroundWriter
+(
+  int maxPending )
+:
+  _maxPending(maxPending),
+  _queue(),
+  _running(false),
+  _finished(false),
+  _mutex(),
+  _condition(),
+  _thread()
+{
+  assertion(maxPending > 0, maxPending);
+}
+
+BackgroundWriter:: ~BackgroundWriter()
+{
+  if (_thread.joinable()){
+    {
+      std::lock_guard<std::mutex> lock(_mutex);
+      _finished = true;
+    }
+    _condition.notify_all();
+    _thread.join();
+  }
+}
+
+void BackgroundWriter:: post
+(
+  std::function<void()>&& job )
+{
+  {
+    std::unique_lock<std::mutex> lock(_mutex);
+    _condition.wait(lock, [this]() {
+      return (int) _queue.size() + (_running ? 1 : 0) < _maxPending;
+    });
+    _queue.push_back(std::move(job));
+  }
+  if (not _thread.joinable()){
+    _thread = std::thread([this]() { run(); });
+  }
+  _condition.notify_all();
+}
+
+void BackgroundWriter:: wait()
+{
+  TRACE();
+  std::unique_lock<std::mutex> lock(_mutex);
+  _condition.wait(lock, [this]() { return _queue.empty() && not _running; });
+}
+
+void BackgroundWriter:: run()
+{
+  std::unique_lock<std::mutex> lock(_mutex);
+  while (true){
+    _condition.wait(lock, [this]() { return _finished || not _queue.empty(); });
+    if (_queue.empty()){
+      break; // finished and nothing left to run
+    }
+    std::function<void()> job = std::move(_queue.front());
+    _queue.pop_front();
+    _running = true;
+    lock.unlock();
+    job();
+    lock.lock();
+    _running = false;
+    _condition.notify_all();
+  }
+}
+
+}} // namespace precice, io
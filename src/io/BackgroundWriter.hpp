@@ -0,0 +1,67 @@
+#pragma once
+
+#include "logging/Logger.hpp"
+#include <boost/noncopyable.hpp>
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <thread>
+
+namespace precice {
+namespace io {
+
+/**
+ * @brief Runs file writing jobs in a background thread.
+ *
+ * post() only moves the job into a queue and returns, such that the simulation
+ * does not wait for the file system. The jobs are run in the order of the calls
+ * to post(), hence they must only access data owned by the job itself. The
+ * thread is started with the first call to post() and joined on destruction,
+ * after all queued jobs are run.
+ *
+ * At most maxPending jobs are queued or running at a time. If the file system
+ * cannot keep up, post() blocks until a job completes, which bounds the memory
+ * held by the snapshots in the queue.
+ */
+class BackgroundWriter : private boost::noncopyable
+{
+public:
+
+  /// @param maxPending [IN] Number of queued and running jobs, above which post() blocks.
+  explicit BackgroundWriter ( int maxPending = 2 );
+
+  /// Waits until all queued jobs are run.
+  ~BackgroundWriter();
+
+  /// Queues job for running in the background thread, waits while maxPending jobs are pending.
+  void post ( std::function<void()>&& job );
+
+  /// Blocks until all queued jobs are run.
+  void wait();
+
+private:
+
+  static logging::Logger _log;
+
+  const int _maxPending;
+
+  std::deque<std::function<void()>> _queue;
+
+  /// True, while the thread runs the job taken from the queue.
+  bool _running;
+
+  bool _finished;
+
+  std::mutex _mutex;
+
+  /// Notifies the thread of queued jobs and waiting callers of completed ones.
+  std::condition_variable _condition;
+
+  std::thread _thread;
+
+  /// Loop of the background thread.
+  void run();
+};
+
+}} // namespace precice, io
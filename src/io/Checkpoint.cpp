@@ -0,0 +1,396 @@
+#include "Checkpoint.hpp"
+#include "mesh/Mesh.hpp"
+#include "mesh/Vertex.hpp"
+#include "mesh/Edge.hpp"
+#include "mesh/Triangle.hpp"
+#include "mesh/Data.hpp"
+#include "mesh/PropertyContainer.hpp"
+#include "utils/Globals.hpp"
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+
+namespace precice {
+namespace io {
+
+namespace {
+
+const char MAGIC[8] = { 'p', 'r', 'e', 'C', 'I', 'C', 'E', 'c' };
+
+template<typename T>
+void writeValue ( std::ofstream& out, T value )
+{
+  out.write(reinterpret_cast<const char*>(&value), sizeof(T));
+}
+
+template<typename T>
+T readValue ( std::ifstream& in )
+{
+  T value;
+  in.read(reinterpret_cast<char*>(&value), sizeof(T));
+  return value;
+}
+
+/// Adds parent to the parents of element, if it is not yet contained.
+void addParentIfMissing
+(
+  mesh::PropertyContainer& object,
+  mesh::PropertyContainer& parent )
+{
+  for (int i=0; i < object.getParentCount(); i++){
+    if (&object.getParent(i) == &parent){
+      return;
+    }
+  }
+  object.addParent(parent);
+}
+
+}
+
+const std::uint32_t Checkpoint:: VERSION = 1;
+
+logging::Logger Checkpoint:: _log ( "precice::io::Checkpoint" );
+
+void Checkpoint:: add
+(
+  const std::string& name,
+  double             value )
+{
+  Entry& entry = _entries[name];
+  entry.isInteger = false;
+  entry.rows = 1;
+  entry.cols = 1;
+  entry.doubles.assign(1, value);
+  entry.integers.clear();
+}
+
+void Checkpoint:: add
+(
+  const std::string& name,
+  long int           value )
+{
+  Entry& entry = _entries[name];
+  entry.isInteger = true;
+  entry.rows = 1;
+  entry.cols = 1;
+  entry.doubles.clear();
+  entry.integers.assign(1, value);
+}
+
+void Checkpoint:: add
+(
+  const std::string&                           name,
+  const Eigen::Ref<const Eigen::MatrixXd>& matrix )
+{
+  Entry& entry = _entries[name];
+  entry.isInteger = false;
+  entry.rows = matrix.rows();
+  entry.cols = matrix.cols();
+  entry.doubles.resize(matrix.size());
+  Eigen::Map<Eigen::MatrixXd>(entry.doubles.data(), matrix.rows(), matrix.cols()) = matrix;
+  entry.integers.clear();
+}
+
+void Checkpoint:: add
+(
+  const std::string&      name,
+  const std::vector<int>& values )
+{
+  Entry& entry = _entries[name];
+  entry.isInteger = true;
+  entry.rows = values.size();
+  entry.cols = 1;
+  entry.doubles.clear();
+  entry.integers.assign(values.begin(), values.end());
+}
+
+bool Checkpoint:: contains
+(
+  const std::string& name ) const
+{
+  return _entries.count(name) > 0;
+}
+
+void Checkpoint:: get
+(
+  const std::string& name,
+  double&            value ) const
+{
+  const Entry& entry = getEntry(name, false);
+  CHECK(entry.doubles.size() == 1, "Checkpoint entry \"" << name << "\" is not a single value!");
+  value = entry.doubles[0];
+}
+
+void Checkpoint:: get
+(
+  const std::string& name,
+  long int&          value ) const
+{
+  const Entry& entry = getEntry(name, true);
+  CHECK(entry.integers.size() == 1, "Checkpoint entry \"" << name << "\" is not a single value!");
+  value = entry.integers[0];
+}
+
+void Checkpoint:: get
+(
+  const std::string& name,
+  int&               value ) const
+{
+  long int longValue = 0;
+  get(name, longValue);
+  value = (int) longValue;
+}
+
+void Checkpoint:: get
+(
+  const std::string& name,
+  Eigen::MatrixXd&   matrix ) const
+{
+  const Entry& entry = getEntry(name, false);
+  matrix = Eigen::Map<const Eigen::MatrixXd>(entry.doubles.data(), entry.rows, entry.cols);
+}
+
+void Checkpoint:: get
+(
+  const std::string& name,
+  Eigen::VectorXd&   vector ) const
+{
+  const Entry& entry = getEntry(name, false);
+  CHECK(entry.cols == 1 || entry.doubles.empty(),
+        "Checkpoint entry \"" << name << "\" is not a vector!");
+  vector = Eigen::Map<const Eigen::VectorXd>(entry.doubles.data(), entry.doubles.size());
+}
+
+void Checkpoint:: get
+(
+  const std::string& name,
+  std::vector<int>&  values ) const
+{
+  const Entry& entry = getEntry(name, true);
+  values.assign(entry.integers.begin(), entry.integers.end());
+}
+
+void Checkpoint:: addMesh
+(
+  mesh::Mesh& mesh )
+{
+  TRACE(mesh.getName());
+  const std::string& name = mesh.getName();
+  add(name + ":vertices", mesh.vertexCoords());
+
+  std::vector<int> indices;
+  indices.reserve(2 * mesh.edges().size());
+  for (const mesh::Edge& edge : mesh.edges()){
+    indices.push_back(edge.vertex(0).getID());
+    indices.push_back(edge.vertex(1).getID());
+  }
+  add(name + ":edges", indices);
+
+  indices.clear();
+  indices.reserve(3 * mesh.triangles().size());
+  for (const mesh::Triangle& triangle : mesh.triangles()){
+    for (int i=0; i < 3; i++){
+      indices.push_back(triangle.edge(i).getID());
+    }
+  }
+  add(name + ":triangles", indices);
+
+  // Faces of the sub-IDs, edges in 2D and triangles in 3D
+  for (const auto& nameID : mesh.getNameIDPairs()){
+    if (nameID.first == name){
+      continue;
+    }
+    mesh::PropertyContainer& container = mesh.getPropertyContainer(nameID.first);
+    indices.clear();
+    if (mesh.getDimensions() == 2){
+      for (const mesh::Edge& edge : mesh.edges()){
+        for (int i=0; i < edge.getParentCount(); i++){
+          if (&edge.getParent(i) == &container){
+            indices.push_back(edge.getID());
+          }
+        }
+      }
+    }
+    else {
+      for (const mesh::Triangle& triangle : mesh.triangles()){
+        for (int i=0; i < triangle.getParentCount(); i++){
+          if (&triangle.getParent(i) == &container){
+            indices.push_back(triangle.getID());
+          }
+        }
+      }
+    }
+    add(name + ":subid:" + nameID.first, indices);
+  }
+
+  for (const mesh::PtrData& data : mesh.data()){
+    add(name + ":data:" + data->getName(), data->values());
+  }
+}
+
+void Checkpoint:: restoreMesh
+(
+  mesh::Mesh& mesh,
+  bool        createMesh ) const
+{
+  TRACE(mesh.getName(), createMesh);
+  const std::string& name = mesh.getName();
+  Eigen::MatrixXd coords;
+  get(name + ":vertices", coords);
+  CHECK(coords.rows() == mesh.getDimensions(), "Mesh \"" << name << "\" has dimension "
+        << mesh.getDimensions() << ", but " << coords.rows() << " in the checkpoint!");
+
+  if (createMesh){
+    std::vector<int> indices;
+    mesh.reserveVertices(coords.cols());
+    for (int i=0; i < coords.cols(); i++){
+      mesh.createVertex(coords.col(i));
+    }
+    get(name + ":edges", indices);
+    mesh.reserveEdges(indices.size() / 2);
+    for (size_t i=0; i + 1 < indices.size(); i+=2){
+      mesh.createEdge(mesh.vertices()[indices[i]], mesh.vertices()[indices[i+1]]);
+    }
+    get(name + ":triangles", indices);
+    mesh.reserveTriangles(indices.size() / 3);
+    mesh::Mesh::EdgeContainer& edges = mesh.edges();
+    for (size_t i=0; i + 2 < indices.size(); i+=3){
+      mesh.createTriangle(edges[indices[i]], edges[indices[i+1]], edges[indices[i+2]]);
+    }
+  }
+  else {
+    // For provided meshes, the vertices set by the solver have to coincide with the checkpoint
+    CHECK(coords.cols() == (int) mesh.vertices().size(), "For the mesh " << name << ", "
+          << mesh.vertices().size() << " vertices were set, while " << coords.cols()
+          << " vertices are read from the checkpoint for restart.");
+    CHECK(coords == mesh.vertexCoords(), "For mesh " << name << " the vertices that were set"
+          << " do not coincide with those read from the checkpoint.");
+  }
+
+  // Faces of the sub-IDs
+  int dimensions = mesh.getDimensions();
+  for (const auto& nameID : mesh.getNameIDPairs()){
+    if (nameID.first == name){
+      continue;
+    }
+    std::vector<int> faces;
+    get(name + ":subid:" + nameID.first, faces);
+    mesh::PropertyContainer& container = mesh.getPropertyContainer(nameID.first);
+    for (int index : faces){
+      if (dimensions == 2){
+        mesh::Edge& edge = mesh.edges()[index];
+        edge.addParent(container);
+        addParentIfMissing(edge.vertex(0), container);
+        addParentIfMissing(edge.vertex(1), container);
+      }
+      else {
+        mesh::Triangle& triangle = mesh.triangles()[index];
+        triangle.addParent(container);
+        for (int i=0; i < 3; i++){
+          addParentIfMissing(triangle.edge(i), container);
+          addParentIfMissing(triangle.vertex(i), container);
+        }
+      }
+    }
+  }
+
+  mesh.allocateDataValues();
+  for (const mesh::PtrData& data : mesh.data()){
+    Eigen::VectorXd& values = data->values();
+    Eigen::VectorXd checkpointValues;
+    get(name + ":data:" + data->getName(), checkpointValues);
+    CHECK(checkpointValues.size() == values.size(), "Number of data values from the checkpoint ("
+          << checkpointValues.size() << ") does not fit to number of expected data values ("
+          << values.size() << ") for data \"" << data->getName() << "\"!");
+    values = checkpointValues;
+  }
+}
+
+void Checkpoint:: writeFile
+(
+  const std::string& fileName ) const
+{
+  TRACE(fileName, _entries.size());
+  // Write to a temporary file first, such that an interrupted write keeps the previous checkpoint
+  std::string tmpFileName = fileName + ".tmp";
+  std::ofstream out(tmpFileName.c_str(), std::ios::binary);
+  CHECK(out, "Could not open file \"" << tmpFileName << "\" for writing the checkpoint!");
+  out.write(MAGIC, sizeof(MAGIC));
+  writeValue<std::uint32_t>(out, VERSION);
+  writeValue<std::uint32_t>(out, _entries.size());
+  for (const auto& pair : _entries){
+    const Entry& entry = pair.second;
+    writeValue<std::uint32_t>(out, pair.first.size());
+    out.write(pair.first.data(), pair.first.size());
+    writeValue<std::uint8_t>(out, entry.isInteger ? 1 : 0);
+    writeValue<std::int64_t>(out, entry.rows);
+    writeValue<std::int64_t>(out, entry.cols);
+    if (entry.isInteger){
+      out.write(reinterpret_cast<const char*>(entry.integers.data()),
+                entry.integers.size() * sizeof(std::int64_t));
+    }
+    else {
+      out.write(reinterpret_cast<const char*>(entry.doubles.data()),
+                entry.doubles.size() * sizeof(double));
+    }
+  }
+  out.close();
+  CHECK(out, "Writing the checkpoint to file \"" << tmpFileName << "\" failed!");
+  CHECK(std::rename(tmpFileName.c_str(), fileName.c_str()) == 0,
+        "Could not rename checkpoint file \"" << tmpFileName << "\" to \"" << fileName << "\"!");
+}
+
+void Checkpoint:: readFile
+(
+  const std::string& fileName )
+{
+  TRACE(fileName);
+  std::ifstream in(fileName.c_str(), std::ios::binary);
+  CHECK(in, "Could not open checkpoint file \"" << fileName << "\" for restart!");
+  char magic[sizeof(MAGIC)];
+  in.read(magic, sizeof(magic));
+  CHECK(in && std::memcmp(magic, MAGIC, sizeof(MAGIC)) == 0,
+        "File \"" << fileName << "\" is not a preCICE checkpoint!");
+  std::uint32_t version = readValue<std::uint32_t>(in);
+  CHECK(version == VERSION, "Checkpoint file \"" << fileName << "\" has format version "
+        << version << ", but only version " << VERSION << " can be read!");
+
+  _entries.clear();
+  std::uint32_t size = readValue<std::uint32_t>(in);
+  for (std::uint32_t i=0; i < size; i++){
+    std::string name(readValue<std::uint32_t>(in), ' ');
+    in.read(&name[0], name.size());
+    Entry& entry = _entries[name];
+    entry.isInteger = readValue<std::uint8_t>(in) == 1;
+    entry.rows = readValue<std::int64_t>(in);
+    entry.cols = readValue<std::int64_t>(in);
+    CHECK(in && entry.rows >= 0 && entry.cols >= 0,
+          "Checkpoint file \"" << fileName << "\" is corrupted!");
+    if (entry.isInteger){
+      entry.integers.resize(entry.rows * entry.cols);
+      in.read(reinterpret_cast<char*>(entry.integers.data()),
+              entry.integers.size() * sizeof(std::int64_t));
+    }
+    else {
+      entry.doubles.resize(entry.rows * entry.cols);
+      in.read(reinterpret_cast<char*>(entry.doubles.data()),
+              entry.doubles.size() * sizeof(double));
+    }
+    CHECK(in, "Checkpoint file \"" << fileName << "\" is truncated!");
+  }
+  DEBUG("Read " << _entries.size() << " entries");
+}
+
+const Checkpoint::Entry& Checkpoint:: getEntry
+(
+  const std::string& name,
+  bool               isInteger ) const
+{
+  auto iter = _entries.find(name);
+  CHECK(iter != _entries.end(), "Checkpoint has no entry \"" << name << "\"!");
+  CHECK(iter->second.isInteger == isInteger, "Checkpoint entry \"" << name << "\" holds "
+        << (iter->second.isInteger ? "integers" : "doubles") << "!");
+  return iter->second;
+}
+
+}} // namespace precice, io
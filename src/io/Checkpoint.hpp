@@ -0,0 +1,113 @@
+#pragma once
+
+#include "mesh/SharedPointer.hpp"
+#include "logging/Logger.hpp"
+#include <Eigen/Core>
+#include <cstdint>
+#include <map>
+#include <string>
+#include <vector>
+
+// ----------------------------------------------------------- CLASS DEFINITION
+
+namespace precice {
+namespace io {
+
+/**
+ * @brief Snapshot of the simulation state of one rank, written to and read from a binary file.
+ *
+ * A checkpoint is a set of named entries, each a matrix of doubles or of integers.
+ * The entries are copied on add(), hence the checkpoint can be written to file,
+ * e.g. by a CheckpointWriter in the background, while the simulation goes on.
+ *
+ * File format, in the byte order of the writing machine:
+ *
+ *   char[8]  "preCICEc"
+ *   uint32   format version, see VERSION
+ *   uint32   number of entries
+ *   entries: uint32 length of name, name, uint8 type (0 = double, 1 = int64),
+ *            int64 rows, int64 cols, rows * cols values in column-major order
+ */
+class Checkpoint
+{
+public:
+
+  /// Version of the file format, increased with incompatible changes.
+  static const std::uint32_t VERSION;
+
+  /// Adds (or replaces) an entry holding a single value.
+  void add ( const std::string& name, double value );
+
+  /// Adds (or replaces) an entry holding a single value.
+  void add ( const std::string& name, long int value );
+
+  /// Adds (or replaces) an entry holding a copy of matrix, also used for vectors.
+  void add ( const std::string& name, const Eigen::Ref<const Eigen::MatrixXd>& matrix );
+
+  /// Adds (or replaces) an entry holding a copy of values.
+  void add ( const std::string& name, const std::vector<int>& values );
+
+  /// Returns true, if an entry of the given name exists.
+  bool contains ( const std::string& name ) const;
+
+  /// Returns the single value of an entry.
+  void get ( const std::string& name, double& value ) const;
+
+  /// Returns the single value of an entry.
+  void get ( const std::string& name, long int& value ) const;
+
+  /// Returns the single value of an entry.
+  void get ( const std::string& name, int& value ) const;
+
+  /// Returns the values of an entry, resizes matrix.
+  void get ( const std::string& name, Eigen::MatrixXd& matrix ) const;
+
+  /// Returns the values of an entry with one column, resizes vector.
+  void get ( const std::string& name, Eigen::VectorXd& vector ) const;
+
+  /// Returns the values of an entry, resizes values.
+  void get ( const std::string& name, std::vector<int>& values ) const;
+
+  /**
+   * @brief Adds vertices, edges, triangles, sub-ID faces and data values of mesh.
+   *
+   * Vertices, edges and triangles are referenced by their IDs, which are their
+   * positions in the mesh.
+   */
+  void addMesh ( mesh::Mesh& mesh );
+
+  /**
+   * @brief Restores a mesh added by addMesh() and its data values.
+   *
+   * @param[in] createMesh If false, the vertices have been set already and are
+   *            only compared with those of the checkpoint.
+   */
+  void restoreMesh ( mesh::Mesh& mesh, bool createMesh ) const;
+
+  /// Writes all entries to a binary file, replaces the file only once it is complete.
+  void writeFile ( const std::string& fileName ) const;
+
+  /// Replaces all entries by those read from a binary file.
+  void readFile ( const std::string& fileName );
+
+private:
+
+  /// Matrix of doubles or integers stored in a checkpoint.
+  struct Entry
+  {
+    bool isInteger;
+    std::int64_t rows;
+    std::int64_t cols;
+    std::vector<double> doubles;
+    std::vector<std::int64_t> integers;
+  };
+
+  static logging::Logger _log;
+
+  std::map<std::string,Entry> _entries;
+
+  /// Returns the entry of the given name, an error is raised if it is missing or of the wrong type.
+  const Entry& getEntry ( const std::string& name, bool isInteger ) const;
+};
+
+}} // namespace precice, io
@@ -0,0 +1,27 @@
+#include "CheckpointWriter.hpp"
+#include "utils/Globals.hpp"
+#include <memory>
+
+namespace precice {
+namespace io {
+
+logging::Logger CheckpointWriter:: _log ( "precice::io::CheckpointWriter" );
+
+void CheckpointWriter:: write
+(
+  const std::string& fileName,
+  Checkpoint&&       checkpoint )
+{
+  TRACE(fileName);
+  // std::function has to be copyable, hence the checkpoint is moved into a shared pointer
+  auto job = std::make_shared<Checkpoint>(std::move(checkpoint));
+  _writer.post([fileName, job]() { job->writeFile(fileName); });
+}
+
+void CheckpointWriter:: wait()
+{
+  TRACE();
+  _writer.wait();
+}
+
+}} // namespace precice, io
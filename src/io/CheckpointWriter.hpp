@@ -0,0 +1,37 @@
+#pragma once
+
+#include "BackgroundWriter.hpp"
+#include "Checkpoint.hpp"
+#include "logging/Logger.hpp"
+#include <boost/noncopyable.hpp>
+#include <string>
+
+namespace precice {
+namespace io {
+
+/**
+ * @brief Writes checkpoints to file in a background thread.
+ *
+ * write() only moves the checkpoint into a queue and returns, such that the
+ * simulation does not wait for the file system. The checkpoints are written in
+ * the order of the calls to write(), all queued checkpoints are written before
+ * destruction.
+ */
+class CheckpointWriter : private boost::noncopyable
+{
+public:
+
+  /// Queues checkpoint for writing to fileName, checkpoint is empty afterwards.
+  void write ( const std::string& fileName, Checkpoint&& checkpoint );
+
+  /// Blocks until all queued checkpoints are written.
+  void wait();
+
+private:
+
+  static logging::Logger _log;
+
+  BackgroundWriter _writer;
+};
+
+}} // namespace precice, io
@@ -52,6 +52,11 @@ public:
     const std::string& name,
     const std::string& location,
     mesh::Mesh&        mesh ) =0;
+
+  /**
+   * @brief Blocks until all exports are written, for exports writing in the background.
+   */
+  virtual void wait() {}
 };
 
 }} // namespace precice, io
@@ -38,6 +38,9 @@ struct ExportContext
   // @brief If true, normals are plotted.
   bool plotNormals;
 
+  // @brief Encoding of the exported data (e.g. ascii), for vtk exports.
+  std::string format;
+
   /**
    * @brief Constructor.
    */
@@ -51,7 +54,8 @@ struct ExportContext
     exportSpacetree(false),
     everyIteration(false),
     type(),
-    plotNormals(false)
+    plotNormals(false),
+    format("ascii")
   {}
 };
 
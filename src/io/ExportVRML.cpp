@@ -3,8 +3,6 @@
 #include "mesh/Vertex.hpp"
 #include "mesh/Edge.hpp"
 #include "mesh/Triangle.hpp"
-#include "mesh/PropertyContainer.hpp"
-#include "utils/String.hpp"
 #include "utils/Globals.hpp"
 #include <iostream>
 #include <Eigen/Dense>
@@ -47,35 +45,6 @@ void ExportVRML:: doExport
   outstream.close();
 }
 
-void ExportVRML:: doExportCheckpoint
-(
-  const std::string& filename,
-  mesh::Mesh&        mesh )
-{
-  //currently checkpoints do not have a dedicated location, but write straight to the main directory
-  std::ofstream outFile;
-  std::string fullFilename(filename);
-  openFile(outFile, utils::checkAppendExtension(fullFilename, std::string(".wrl")));
-  writeHeader(outFile);
-  writeGeometry(outFile, mesh);
-  writeVertexData(outFile, mesh);
-  writePropertyContainer(outFile, mesh);
-  outFile << "}" << std::endl;
-  outFile.close();
-}
-
-void ExportVRML:: openFile
-(
-  std::ofstream&     outFile,
-  const std::string& filename ) const
-{
-  outFile.open ( filename.c_str() );
-  CHECK(outFile, "Could not open file \"" << filename << "\" for VRML export!" );
-  outFile.setf(std::ios::showpoint);
-  outFile.setf(std::ios::scientific);
-  outFile << std::setprecision(16);
-}
-
 void ExportVRML:: writeHeader
 (
   std::ofstream& outFile ) const
@@ -183,123 +152,6 @@ void ExportVRML:: writeGeometry
            << "   }"    << std::endl;
 }
 
-void ExportVRML:: writeVertexData
-(
-  std::ofstream& outFile,
-   mesh::Mesh&   mesh ) const
-{
-  for (mesh::PtrData data : mesh.data()) {
-    outFile << "   Info {"                         << std::endl
-            << "      string \"preCICE data\""     << std::endl
-            << "      fields [ SFString dataname SFString datatype "
-            << "MFFloat datavalues ]"              << std::endl
-            << "      dataname \"" << data->getName() << "\"" << std::endl
-            << "      datadimensions " << data->getDimensions() << std::endl
-            << "      datavalues ["                << std::endl;
-
-    const Eigen::VectorXd& values = data->values();
-    int dims = data->getDimensions();
-    for ( int i=0; i < values.size(); i+=dims ) {
-      outFile << "         ";
-      for ( int dim=0; dim < dims; dim++ ) {
-        outFile << values(i+dim);
-        if ( dim + 1 < dims ) {
-          outFile << " ";
-        }
-      }
-      outFile << "," << std::endl;
-    }
-
-//      for ( mesh::Vertex & vertex : mesh.vertices() ) {
-//         assertion ( vertex.hasProperty(data->getID()) );
-//         if ( data->getType() == mesh::Data::TYPE_VECTOR ) {
-//            using utils::Vector;
-//            Vector value ( vertex.getProperty<Vector>(data->getID()) );
-//            if ( utils::Def::DIM == 2 ) {
-//               outFile << "         " << value[0] << " "
-//                       << value[1] << "," << std::endl;
-//            }
-//            else {
-//               assertion ( utils::Def::DIM == 3 );
-//               outFile << "         " << value[0] << " "
-//                       << value[1] << " " << value[2] << "," << std::endl;
-//            }
-//         }
-//         else {
-//            preciceCheck ( false, "writeVertexData()",
-//                           "Only vector data is supported!" );
-//         }
-//      }
-
-      outFile << "      ]" << std::endl
-              << "   }"    << std::endl;
-
-   }
-}
-
-void ExportVRML:: writePropertyContainer
-(
-  std::ofstream& outFile,
-  mesh::Mesh&    mesh ) const
-{
-  using mesh::PropertyContainer;
-  int dimensions = mesh.getDimensions();
-  for (PropertyContainer & container : mesh.propertyContainers()) {
-    int id = container.getProperty<int> ( container.INDEX_GEOMETRY_ID );
-    std::string idName ( "" );
-    for (auto &nameID : mesh.getNameIDPairs()) {
-      if ( nameID.second == id ) {
-        idName = nameID.first;
-        break;
-      }
-    }
-    assertion ( idName != std::string("") );
-
-    outFile << "   Info {"                                << std::endl
-      << "      string \"preCICE property container\""    << std::endl
-      << "      fields [ SFString idname MFInt32 faces ]" << std::endl
-      << "      idname \"" << idName << "\"" << std::endl
-      << "      faces [ "                    << std::endl;
-
-//    using mesh::Vertex;
-//    int vertexIndex = 0;
-//    for ( Vertex & vertex : mesh.vertices() ) {
-//      for ( int i=0; i < vertex.getParentCount(); i++ ) {
-//        if ( &vertex.getParent(i) == &container  ) {
-//          outFile << "         " << vertexIndex << "," << std::endl;
-//        }
-//      }
-//      vertexIndex ++;
-//    }
-//    outFile << "      ]" << std::endl;
-
-    int index = 0;
-    if (dimensions == 2){
-      for (mesh::Edge& edge : mesh.edges()) {
-        for (int i=0; i < edge.getParentCount(); i++){
-          if (&edge.getParent(i) == &container ){
-            outFile << "         " << index << "," << std::endl;
-          }
-        }
-        index++;
-      }
-    }
-    else {
-      for (mesh::Triangle& triangle : mesh.triangles()) {
-        for (int i=0; i < triangle.getParentCount(); i++){
-          if (&triangle.getParent(i) == &container ){
-            outFile << "         " << index << "," << std::endl;
-          }
-        }
-        index++;
-      }
-
-    }
-    outFile << "      ]" << std::endl;
-    outFile << "   }"    << std::endl;
-  }
-}
-
 }} // namespace precice, io
 
 
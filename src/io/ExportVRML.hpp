@@ -46,37 +46,16 @@ public:
     const std::string& location,
     mesh::Mesh&        mesh );
 
-  /**
-   * @brief Perform writing to VRML file of a full geometry checkpoint.
-   *
-   * A full checkpoint also  includes vertex data and property containers.
-   */
-  void doExportCheckpoint (
-    const std::string& filename,
-    mesh::Mesh&        mesh );
-
 private:
 
   /// @brief Logging device.
   static logging::Logger _log;
 
-  void openFile (
-    std::ofstream&     outFile,
-    const std::string& filename ) const;
-
   void writeHeader ( std::ofstream& outFile ) const;
 
   void writeGeometry (
     std::ofstream& outFile,
     mesh::Mesh&    mesh ) const;
-
-  void writeVertexData (
-    std::ofstream& outFile,
-    mesh::Mesh&    mesh ) const;
-
-  void writePropertyContainer (
-    std::ofstream& outFile,
-    mesh::Mesh&    mesh ) const;
 };
 
 }} // namespace precice, io
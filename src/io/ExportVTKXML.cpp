@@ -5,24 +5,196 @@
 #include "mesh/Triangle.hpp"
 #include "mesh/Quad.hpp"
 #include "utils/Globals.hpp"
+#include "utils/MasterSlave.hpp"
 #include <Eigen/Dense>
+#include <algorithm>
+#include <cstdint>
 #include <string>
+#include <sstream>
 #include <fstream>
+#include <memory>
 #include <boost/filesystem.hpp>
+#ifndef PRECICE_NO_ZLIB
+#include <zlib.h>
+#endif
 
 namespace precice {
 namespace io {
 
+struct ExportVTKXML:: Piece
+{
+  Format format;
+
+  int numPoints;
+
+  // Coordinates of all vertices, always with 3 components
+  std::vector<double> positions;
+
+  std::vector<int> connectivity;
+
+  std::vector<int> offsets;
+
+  std::vector<unsigned char> types;
+
+  std::vector<std::string> scalarDataNames;
+
+  std::vector<std::string> vectorDataNames;
+
+  // Values of one data, vector data is padded to 3 components
+  struct Array
+  {
+    std::string name;
+    int components;
+    std::vector<double> values;
+  };
+
+  std::vector<Array> data;
+};
+
+namespace {
+
+// Size of the blocks compressed separately, as used by VTK
+const std::uint64_t COMPRESSION_BLOCK_SIZE = 32768;
+
+/// Returns the VTK type of floating point values for the given format.
+const char* floatType ( ExportVTKXML::Format format )
+{
+  return format == ExportVTKXML::ASCII ? "Float32" : "Float64";
+}
+
+/**
+ * @brief Appends size bytes of data as one block of appended data.
+ *
+ * Uncompressed blocks are preceded by their size. Compressed blocks are split
+ * into sub-blocks, preceded by their number, the size of a full and of the last
+ * sub-block and the compressed sizes of all sub-blocks.
+ */
+void appendBlock
+(
+  std::string&  appended,
+  bool          compress,
+  const void*   data,
+  std::uint64_t size )
+{
+  const char* bytes = static_cast<const char*>(data);
+  if (not compress){
+    appended.append(reinterpret_cast<const char*>(&size), sizeof(size));
+    appended.append(bytes, size);
+    return;
+  }
+# ifndef PRECICE_NO_ZLIB
+  std::uint64_t blocks = (size + COMPRESSION_BLOCK_SIZE - 1) / COMPRESSION_BLOCK_SIZE;
+  std::vector<std::uint64_t> header(3 + blocks);
+  header[0] = blocks;
+  header[1] = COMPRESSION_BLOCK_SIZE;
+  header[2] = size % COMPRESSION_BLOCK_SIZE;
+  std::string compressed;
+  std::vector<Bytef> buffer(compressBound(COMPRESSION_BLOCK_SIZE));
+  for (std::uint64_t i=0; i < blocks; i++){
+    std::uint64_t begin = i * COMPRESSION_BLOCK_SIZE;
+    uLongf compressedSize = buffer.size();
+    int status = compress2(buffer.data(), &compressedSize,
+                           reinterpret_cast<const Bytef*>(bytes + begin),
+                           std::min(COMPRESSION_BLOCK_SIZE, size - begin), Z_BEST_SPEED);
+    assertion(status == Z_OK, status);
+    header[3 + i] = compressedSize;
+    compressed.append(reinterpret_cast<const char*>(buffer.data()), compressedSize);
+  }
+  appended.append(reinterpret_cast<const char*>(header.data()),
+                  header.size() * sizeof(std::uint64_t));
+  appended += compressed;
+# endif // not PRECICE_NO_ZLIB
+}
+
+/// Writes the header of a data array and its values, either inline or to the appended data.
+template<typename T>
+void writeArray
+(
+  std::ostream&             out,
+  std::string&              appended,
+  ExportVTKXML::Format      format,
+  const std::string&        type,
+  const std::string&        name,
+  int                       components,
+  const std::vector<T>&     values )
+{
+  out << "            <DataArray type=\"" << type << "\" Name=\"" << name
+      << "\" NumberOfComponents=\"" << components << "\"";
+  if (format == ExportVTKXML::ASCII){
+    out << " format=\"ascii\">\n               ";
+    for (const T& value : values){
+      out << +value << "  "; // + prints unsigned char as number
+    }
+    out << "\n            </DataArray>\n";
+  }
+  else {
+    out << " format=\"appended\" offset=\"" << appended.size() << "\"/>\n";
+    appendBlock(appended, format == ExportVTKXML::COMPRESSED, values.data(),
+                values.size() * sizeof(T));
+  }
+}
+
+/// Writes the names of the scalar and vector data as attributes of PointData or PPointData.
+void writeDataNames
+(
+  std::ostream&                   out,
+  const std::vector<std::string>& scalarDataNames,
+  const std::vector<std::string>& vectorDataNames )
+{
+  out << " Scalars=\"";
+  for (const std::string& name : scalarDataNames) {
+    out << name << " ";
+  }
+  out << "\" Vectors=\"";
+  for (const std::string& name : vectorDataNames) {
+    out << name << " ";
+  }
+  out << "\">\n";
+}
+
+/// Writes the opening VTKFile tag.
+void writeFileTag
+(
+  std::ostream&        out,
+  const std::string&   type,
+  ExportVTKXML::Format format )
+{
+  out << "<?xml version=\"1.0\"?>\n";
+  out << "<VTKFile type=\"" << type << "\"";
+  if (format == ExportVTKXML::ASCII){
+    out << " version=\"0.1\"";
+  }
+  else {
+    out << " version=\"1.0\" header_type=\"UInt64\"";
+    if (format == ExportVTKXML::COMPRESSED){
+      out << " compressor=\"vtkZLibDataCompressor\"";
+    }
+  }
+  out << " byte_order=\"" << (utils::isMachineBigEndian() ? "BigEndian" : "LittleEndian") << "\">\n";
+}
+
+}
+
 logging::Logger ExportVTKXML:: _log("precice::io::ExportVTKXML");
 
 ExportVTKXML:: ExportVTKXML
 (
-  bool writeNormals )
+  bool   writeNormals,
+  Format format )
 :
   Export(),
   _writeNormals(writeNormals),
-  _meshDimensions(-1)
+  _format(format),
+  _meshDimensions(-1),
+  _writer()
 {
+# ifdef PRECICE_NO_ZLIB
+  if (_format == COMPRESSED){
+    preciceWarning("ExportVTKXML()", "preCICE was built without zlib, "
+                   << "compressed VTKXML exports are written uncompressed!");
+    _format = BINARY;
+  }
+# endif
 }
 
 int ExportVTKXML:: getType() const
@@ -37,15 +209,34 @@ void ExportVTKXML:: doExport
   mesh::Mesh&        mesh)
 {
   TRACE(name, location, mesh.getName());
-  std::ofstream outFile;
-  assertion(utils::MasterSlave::_slaveMode || utils::MasterSlave::_masterMode);
   processDataNamesAndDimensions(mesh);
-  if (utils::MasterSlave::_masterMode) {
-    writeMasterFile(name, location, mesh);
+  namespace fs = boost::filesystem;
+  fs::path outfile(location);
+  bool parallel = utils::MasterSlave::_slaveMode || utils::MasterSlave::_masterMode;
+  if (not parallel) {
+    outfile = outfile / fs::path(name + ".vtu");
   }
-  if(mesh.vertices().size()>0){ //only procs at the coupling interface should write output (for performance reasons)
-    writeSubFile(name, location, mesh);
+  else {
+    if (utils::MasterSlave::_masterMode) {
+      writeMasterFile(name, location, mesh);
+    }
+    if (mesh.vertices().empty()){ //only procs at the coupling interface should write output (for performance reasons)
+      return;
+    }
+    outfile = outfile / fs::path(name + "_r" + std::to_string(utils::MasterSlave::_rank) + ".vtu");
   }
+
+  // std::function has to be copyable, hence the snapshot is held by a shared pointer
+  auto piece = std::make_shared<Piece>();
+  takeSnapshot(mesh, *piece);
+  std::string fileName = outfile.string();
+  _writer.post([fileName, piece]() { writeSubFile(fileName, *piece); });
+}
+
+void ExportVTKXML:: wait()
+{
+  TRACE();
+  _writer.wait();
 }
 
 void ExportVTKXML::processDataNamesAndDimensions
@@ -56,7 +247,7 @@ void ExportVTKXML::processDataNamesAndDimensions
   _vectorDataNames.clear();
   _scalarDataNames.clear();
   if (_writeNormals) {
-    _vectorDataNames.push_back("VertexNormals ");
+    _vectorDataNames.push_back("VertexNormals");
   }
   for (mesh::PtrData data : mesh.data()) {
     int dataDimensions = data->getDimensions();
@@ -79,273 +270,173 @@ void ExportVTKXML::writeMasterFile
   namespace fs = boost::filesystem;
   fs::path outfile(location);
   outfile = outfile / fs::path(name + "_master.pvtu");
-  std::ofstream outMasterFile(outfile.string(), std::ios::trunc);
+  std::ostringstream outMasterFile;
+  std::string type = floatType(_format);
 
-  preciceCheck(outMasterFile, "doExport()", "Could not open master file \"" << outfile.c_str()
-    << "\" for VTKXML export!");
+  writeFileTag(outMasterFile, "PUnstructuredGrid", _format);
+  outMasterFile << "   <PUnstructuredGrid GhostLevel=\"0\">\n";
 
-  outMasterFile << "<?xml version=\"1.0\"?>" << std::endl;
-  outMasterFile << "<VTKFile type=\"PUnstructuredGrid\" version=\"0.1\" byte_order=\"";
-  outMasterFile << (utils::isMachineBigEndian() ? "BigEndian\">" : "LittleEndian\">")  << std::endl;
-  outMasterFile << "   <PUnstructuredGrid GhostLevel=\"0\">" << std::endl;
+  outMasterFile << "      <PPoints>\n";
+  outMasterFile << "         <PDataArray type=\"" << type << "\" Name=\"Position\" NumberOfComponents=\"" << 3 << "\"/>\n";
+  outMasterFile << "      </PPoints>\n";
 
-  outMasterFile << "      <PPoints>" << std::endl;
-  outMasterFile << "         <PDataArray type=\"Float32\" Name=\"Position\" NumberOfComponents=\"" << 3 << "\"/>" << std::endl;
-  outMasterFile << "      </PPoints>" << std::endl;
+  outMasterFile << "      <PCells>\n";
+  outMasterFile << "         <PDataArray type=\"Int32\" Name=\"connectivity\" NumberOfComponents=\"1\"/>\n";
+  outMasterFile << "         <PDataArray type=\"Int32\" Name=\"offsets\"      NumberOfComponents=\"1\"/>\n";
+  outMasterFile << "         <PDataArray type=\"UInt8\" Name=\"types\"        NumberOfComponents=\"1\"/>\n";
+  outMasterFile << "      </PCells>\n";
 
-  outMasterFile << "      <PCells>" << std::endl;
-  outMasterFile << "         <PDataArray type=\"Int32\" Name=\"connectivity\" NumberOfComponents=\"1\"/>" << std::endl;
-  outMasterFile << "         <PDataArray type=\"Int32\" Name=\"offsets\"      NumberOfComponents=\"1\"/>" << std::endl;
-  outMasterFile << "         <PDataArray type=\"UInt8\" Name=\"types\"        NumberOfComponents=\"1\"/>" << std::endl;
-  outMasterFile << "      </PCells>" << std::endl;
+  outMasterFile << "      <PPointData";
+  writeDataNames(outMasterFile, _scalarDataNames, _vectorDataNames);
 
-  // write scalar data names
-  outMasterFile << "      <PPointData Scalars=\"";
   for (size_t i = 0; i < _scalarDataNames.size(); ++i) {
-    outMasterFile << _scalarDataNames[i] << " ";
-  }
-  // write vector data names
-  outMasterFile << "\" Vectors=\"";
-  for (size_t i = 0; i < _vectorDataNames.size(); ++i) {
-    outMasterFile << _vectorDataNames[i] << " ";
-  }
-  outMasterFile << "\">" << std::endl;
-
-  for (size_t i = 0; i < _scalarDataNames.size(); ++i) {
-    outMasterFile << "         <PDataArray type=\"Float32\" Name=\""<< _scalarDataNames[i] << "\" NumberOfComponents=\"" << 1 << "\"/>" << std::endl;
+    outMasterFile << "         <PDataArray type=\"" << type << "\" Name=\""<< _scalarDataNames[i] << "\" NumberOfComponents=\"" << 1 << "\"/>\n";
   }
 
   for (size_t i = 0; i < _vectorDataNames.size(); ++i) {
-    outMasterFile << "         <PDataArray type=\"Float32\" Name=\""<< _vectorDataNames[i] << "\" NumberOfComponents=\"" << 3 << "\"/>" << std::endl;
+    outMasterFile << "         <PDataArray type=\"" << type << "\" Name=\""<< _vectorDataNames[i] << "\" NumberOfComponents=\"" << 3 << "\"/>\n";
   }
-  outMasterFile << "      </PPointData>" << std::endl;
+  outMasterFile << "      </PPointData>\n";
 
   for (int i = 0; i < utils::MasterSlave::_size; i++) {
     if(mesh.getVertexDistribution()[i].size()>0){ //only non-empty subfiles
-      outMasterFile << "      <Piece Source=\"" << name << "_r" << i << ".vtu\"/>" << std::endl;
+      outMasterFile << "      <Piece Source=\"" << name << "_r" << i << ".vtu\"/>\n";
     }
   }
 
-  outMasterFile << "   </PUnstructuredGrid>" << std::endl;
-  outMasterFile << "</VTKFile>" << std::endl;
-
-  outMasterFile.close();
-}
-
-void ExportVTKXML::writeSubFile
-(
-  const std::string& name,
-  const std::string& location,
-  mesh::Mesh&        mesh)
-{
-  int numPoints = mesh.vertices().size(); // number of vertices
-  int numCells; // number of cells
-  if (_meshDimensions == 2) {
-    numCells = mesh.edges().size();
-  } else {
-    numCells = mesh.triangles().size() + mesh.quads().size();
-  }
-
-  namespace fs = boost::filesystem;
-  fs::path outfile(location);
-  outfile = outfile / fs::path(name + "_r" + std::to_string(utils::MasterSlave::_rank) + ".vtu");
-  std::ofstream outSubFile(outfile.string(), std::ios::trunc);
-
-  preciceCheck(outSubFile, "doExport()", "Could not open slave file \"" << outfile.c_str()
-    << "\" for VTKXML export!");
-
-
-  outSubFile << "<?xml version=\"1.0\"?>" << std::endl;
-  outSubFile << "<VTKFile type=\"UnstructuredGrid\" version=\"0.1\" byte_order=\"";
-  outSubFile << (utils::isMachineBigEndian() ? "BigEndian\">" : "LittleEndian\">")  << std::endl;
-
-  outSubFile << "   <UnstructuredGrid>" << std::endl;
-  outSubFile << "      <Piece NumberOfPoints=\"" << numPoints << "\" NumberOfCells=\"" << numCells << "\"> " << std::endl;
-  outSubFile << "         <Points> " << std::endl;
-  outSubFile << "            <DataArray type=\"Float32\" Name=\"Position\" NumberOfComponents=\"" << 3 << "\" format=\"ascii\"> " << std::endl;
-  for (mesh::Vertex& vertex : mesh.vertices()) {
-    writeVertex(vertex.getCoords(), outSubFile);
-  }
-  outSubFile << "            </DataArray>" << std::endl;
-  outSubFile << "         </Points> " << std::endl << std::endl;
+  outMasterFile << "   </PUnstructuredGrid>\n";
+  outMasterFile << "</VTKFile>\n";
 
-  // Write geometry
-  exportGeometry(outSubFile, mesh);
-
-  // Write data
-  exportData(outSubFile, mesh);
-
-  outSubFile << "      </Piece>" << std::endl;
-  outSubFile << "   </UnstructuredGrid> " << std::endl;
-  outSubFile << "</VTKFile>" << std::endl;
-
-  outSubFile.close();
+  std::string fileName = outfile.string();
+  std::string content = outMasterFile.str();
+  _writer.post([fileName, content]() { writeFile(fileName, {content}); });
 }
 
-void ExportVTKXML::exportGeometry
+void ExportVTKXML:: takeSnapshot
 (
-  std::ofstream& outFile,
-  mesh::Mesh&    mesh)
+  mesh::Mesh& mesh,
+  Piece&      piece ) const
 {
-  if (_meshDimensions == 2) { // write edges as cells
-    outFile << "         <Cells>" << std::endl;
-    outFile << "            <DataArray type=\"Int32\" Name=\"connectivity\" NumberOfComponents=\"1\" format=\"ascii\">" << std::endl;
-    outFile << "               ";
-    for (mesh::Edge & edge : mesh.edges()) {
-      writeLine(edge, outFile);
-    }
-    outFile << std::endl;
-    outFile << "            </DataArray> " << std::endl;
-    outFile << "            <DataArray type=\"Int32\" Name=\"offsets\" NumberOfComponents=\"1\" format=\"ascii\">" << std::endl;
-    outFile << "               ";
-    for (size_t i = 1; i <= mesh.edges().size(); i++) {
-      outFile << 2*i << "  ";
+  TRACE(mesh.getName());
+  piece.format = _format;
+  piece.numPoints = mesh.vertices().size();
+  piece.scalarDataNames = _scalarDataNames;
+  piece.vectorDataNames = _vectorDataNames;
+
+  // Vertices, also in 2D, vtk needs 3D data
+  piece.positions.assign(3 * piece.numPoints, 0.0);
+  Eigen::Map<Eigen::MatrixXd> positions(piece.positions.data(), 3, piece.numPoints);
+  positions.topRows(_meshDimensions) = mesh.vertexCoords();
+
+  if (_meshDimensions == 2) { // edges as cells
+    piece.connectivity.reserve(2 * mesh.edges().size());
+    for (mesh::Edge& edge : mesh.edges()) {
+      piece.connectivity.push_back(edge.vertex(0).getID());
+      piece.connectivity.push_back(edge.vertex(1).getID());
+      piece.offsets.push_back(piece.connectivity.size());
     }
-    outFile << std::endl;
-    outFile << "            </DataArray>" << std::endl;
-    outFile << "            <DataArray type=\"UInt8\"  Name=\"types\" NumberOfComponents=\"1\" format=\"ascii\">" << std::endl;
-    outFile << "               ";
-    for (size_t i = 1; i <= mesh.edges().size(); i++) {
-      outFile << 3 << "  ";
-    }
-    outFile << std::endl;
-    outFile << "            </DataArray>" << std::endl;
-    outFile << "         </Cells>" << std::endl;
-  } else { // write triangles and quads as cells
-
-    outFile << "         <Cells>" << std::endl;
-    outFile << "            <DataArray type=\"Int32\" Name=\"connectivity\" NumberOfComponents=\"1\" format=\"ascii\">" << std::endl;
-    outFile << "               ";
+    piece.types.assign(mesh.edges().size(), 3);
+  }
+  else { // triangles and quads as cells
+    piece.connectivity.reserve(3 * mesh.triangles().size() + 4 * mesh.quads().size());
     for (mesh::Triangle& triangle : mesh.triangles()) {
-      writeTriangle(triangle, outFile);
+      for (int i=0; i < 3; i++){
+        piece.connectivity.push_back(triangle.vertex(i).getID());
+      }
+      piece.offsets.push_back(piece.connectivity.size());
     }
     for (mesh::Quad& quad : mesh.quads()) {
-      writeQuadrangle(quad, outFile);
-    }
-    outFile << std::endl;
-    outFile << "            </DataArray> " << std::endl;
-    outFile << "            <DataArray type=\"Int32\" Name=\"offsets\" NumberOfComponents=\"1\" format=\"ascii\">" << std::endl;
-    outFile << "               ";
-    for (size_t i = 1; i <= mesh.triangles().size(); i++) {
-      outFile << 3*i << "  ";
-    }
-    for (size_t i = 1; i <= mesh.quads().size(); i++) {
-      outFile << 4*i << "  ";
-    }
-    outFile << std::endl;
-    outFile << "            </DataArray>" << std::endl;
-    outFile << "            <DataArray type=\"UInt8\"  Name=\"types\" NumberOfComponents=\"1\" format=\"ascii\">" << std::endl;
-    outFile << "               ";
-    for (size_t i = 1; i <= mesh.triangles().size(); i++) {
-      outFile << 5 << "  ";
-    }
-    for (size_t i = 1; i <= mesh.quads().size(); i++) {
-      outFile << 9 << "  ";
+      for (int i=0; i < 4; i++){
+        piece.connectivity.push_back(quad.vertex(i).getID());
+      }
+      piece.offsets.push_back(piece.connectivity.size());
     }
-    outFile << std::endl;
-    outFile << "            </DataArray>" << std::endl;
-    outFile << "         </Cells>" << std::endl;
+    piece.types.assign(mesh.triangles().size(), 5);
+    piece.types.insert(piece.types.end(), mesh.quads().size(), 9);
   }
-}
 
-void ExportVTKXML:: exportData
-(
-  std::ofstream& outFile,
-  mesh::Mesh&    mesh)
-{
-  outFile << "         <PointData Scalars=\"";
-  for (size_t i = 0; i < _scalarDataNames.size(); i++) {
-    outFile << _scalarDataNames[i] << " ";
-  }
-  outFile << "\" Vectors=\"";
-  for (size_t i = 0; i < _vectorDataNames.size(); i++) {
-    outFile << _vectorDataNames[i] << " ";
+  if (_writeNormals) {
+    Piece::Array normals;
+    normals.name = "VertexNormals";
+    normals.components = 3;
+    normals.values.assign(3 * piece.numPoints, 0.0);
+    Eigen::Map<Eigen::MatrixXd>(normals.values.data(), 3, piece.numPoints).topRows(_meshDimensions)
+      = mesh.vertexNormals();
+    piece.data.push_back(std::move(normals));
   }
-  outFile << "\">" << std::endl;
 
-  for (mesh::PtrData data : mesh.data()) { // Plot vertex data
-    Eigen::VectorXd& values = data->values();
+  for (mesh::PtrData data : mesh.data()) {
+    const Eigen::VectorXd& values = data->values();
     int dataDimensions = data->getDimensions();
-    std::string dataName(data->getName());
-    int numberOfComponents = (dataDimensions==2) ? 3 : dataDimensions;
-    outFile << "            <DataArray type=\"Float32\" Name=\"" << dataName << "\" NumberOfComponents=\"" << numberOfComponents;
-    outFile << "\" format=\"ascii\">" << std::endl;
-    outFile << "               ";
-    if(dataDimensions > 1) {
-      Eigen::VectorXd viewTemp(dataDimensions);
-      int counter = 0;
-      for (mesh::Vertex& vertex : mesh.vertices()) {
-        int offset = counter * dataDimensions;
-        for(int i=0; i < dataDimensions; i++){
-          viewTemp[i] = values(offset + i);
-        }
-        for(int i = 0; i < dataDimensions; i++){
-          outFile << viewTemp[i] << " ";
-        }
-        if(dataDimensions == 2){
-          outFile << "0.0" << " "; //2D data needs to be 3D for vtk
-        }
-        outFile << " ";
-        counter++;
-      }
-    } else if(dataDimensions == 1) {
-      int counter = 0;
-      for (mesh::Vertex& vertex : mesh.vertices()) {
-        outFile << values(counter) << " ";
-        counter++;
-      }
-    }
-    outFile << std::endl << "            </DataArray>" << std::endl;
+    Piece::Array array;
+    array.name = data->getName();
+    array.components = (dataDimensions == 2) ? 3 : dataDimensions; //2D data needs to be 3D for vtk
+    array.values.assign(array.components * piece.numPoints, 0.0);
+    Eigen::Map<Eigen::MatrixXd>(array.values.data(), array.components, piece.numPoints).topRows(dataDimensions)
+      = Eigen::Map<const Eigen::MatrixXd>(values.data(), dataDimensions, piece.numPoints);
+    piece.data.push_back(std::move(array));
   }
-  outFile << "         </PointData> " << std::endl;
 }
 
-void ExportVTKXML::writeVertex
+void ExportVTKXML::writeSubFile
 (
-  const Eigen::VectorXd& position,
-  std::ofstream&         outFile)
+  const std::string& fileName,
+  const Piece&       piece )
 {
-  outFile << "               ";
-  for (int i = 0; i < position.size(); i++){
-    outFile << position(i) << "  ";
-  }
-  if (position.size() ==2)
-  {
-    outFile << 0.0 << "  ";  //also for 2D scenario, vtk needs 3D data
+  Format format = piece.format;
+  std::string type = floatType(format);
+  std::ostringstream outSubFile;
+  // Binary data of all arrays, written after the xml part
+  std::vector<std::string> parts(3);
+  std::string& appended = parts[1];
+
+  writeFileTag(outSubFile, "UnstructuredGrid", format);
+  outSubFile << "   <UnstructuredGrid>\n";
+  outSubFile << "      <Piece NumberOfPoints=\"" << piece.numPoints << "\" NumberOfCells=\""
+             << piece.types.size() << "\">\n";
+
+  outSubFile << "         <Points>\n";
+  writeArray(outSubFile, appended, format, type, "Position", 3, piece.positions);
+  outSubFile << "         </Points>\n";
+
+  outSubFile << "         <Cells>\n";
+  writeArray(outSubFile, appended, format, "Int32", "connectivity", 1, piece.connectivity);
+  writeArray(outSubFile, appended, format, "Int32", "offsets", 1, piece.offsets);
+  writeArray(outSubFile, appended, format, "UInt8", "types", 1, piece.types);
+  outSubFile << "         </Cells>\n";
+
+  outSubFile << "         <PointData";
+  writeDataNames(outSubFile, piece.scalarDataNames, piece.vectorDataNames);
+  for (const Piece::Array& array : piece.data) {
+    writeArray(outSubFile, appended, format, type, array.name, array.components, array.values);
   }
-  outFile << std::endl;
-}
+  outSubFile << "         </PointData>\n";
 
+  outSubFile << "      </Piece>\n";
+  outSubFile << "   </UnstructuredGrid>\n";
+  if (format != ASCII) {
+    outSubFile << "   <AppendedData encoding=\"raw\">\n   _";
+    parts[2] = "\n   </AppendedData>\n";
+  }
+  parts[0] = outSubFile.str();
+  parts[2] += "</VTKFile>\n";
 
-void ExportVTKXML:: writeTriangle
-(
-  mesh::Triangle& triangle,
-  std::ofstream&  outFile)
-{
-  outFile << triangle.vertex(0).getID() << "  ";
-  outFile << triangle.vertex(1).getID() << "  ";
-  outFile << triangle.vertex(2).getID() << "  ";
-
-}
-
-void ExportVTKXML:: writeQuadrangle
-(
-  mesh::Quad&    quad,
-  std::ofstream& outFile)
-{
-  outFile << quad.vertex(0).getID() << "  ";
-  outFile << quad.vertex(1).getID() << "  ";
-  outFile << quad.vertex(2).getID() << "  ";
-  outFile << quad.vertex(3).getID() << "  ";
+  writeFile(fileName, parts);
 }
 
-void ExportVTKXML:: writeLine
+void ExportVTKXML:: writeFile
 (
-  mesh::Edge& edge,
-  std::ofstream& outFile)
+  const std::string&              fileName,
+  const std::vector<std::string>& parts )
 {
-  outFile << edge.vertex(0).getID() << "  ";
-  outFile << edge.vertex(1).getID() << "  ";
+  std::ofstream outFile(fileName, std::ios::trunc | std::ios::binary);
+  preciceCheck(outFile, "doExport()", "Could not open file \"" << fileName
+               << "\" for VTKXML export!");
+  for (const std::string& part : parts) {
+    outFile.write(part.data(), part.size());
+  }
+  preciceCheck(outFile, "doExport()", "Writing file \"" << fileName
+               << "\" for VTKXML export failed!");
 }
 
 }} // namespace precice, io
@@ -2,6 +2,7 @@
 #define PRECICE_IO_EXPORTVTKXML_HPP_
 
 #include "Export.hpp"
+#include "BackgroundWriter.hpp"
 #include "logging/Logger.hpp"
 #include <vector>
 #include <string>
@@ -10,9 +11,6 @@
 namespace precice {
    namespace mesh {
       class Mesh;
-      class Quad;
-      class Edge;
-      class Triangle;
    }
 }
 
@@ -22,57 +20,69 @@ namespace precice {
 namespace io {
 
 /**
- * @brief Writes meshes to xml-vtk files. Only for parallel usage. Serial usage (coupling mode) should still use ExportVTK
+ * @brief Writes meshes to xml-vtk files.
+ *
+ * Each rank with vertices writes its own piece (.vtu), the master additionally
+ * writes the .pvtu file referencing all pieces. Without master-slave mode, a
+ * single piece is written. doExport() only takes a snapshot of the mesh, the
+ * files are formatted and written by a background thread.
  */
 class ExportVTKXML : public Export
 {
 public:
 
+  /**
+   * @brief Encodings of the data arrays.
+   */
+  enum Format {
+    // Text, Float32 values
+    ASCII,
+    // Raw binary appended data, Float64 values
+    BINARY,
+    // Binary appended data compressed with zlib, Float64 values
+    COMPRESSED
+  };
+
   /**
    * @brief Standard constructor
    *
    * @param exportNormals  [IN] boolean: write normals to file?
+   * @param format [IN] Encoding of the data arrays.
    */
-  ExportVTKXML ( bool writeNormals);
+  ExportVTKXML ( bool writeNormals, Format format = ASCII );
 
   /**
    * @brief Returns the VTK type ID.
    */
   virtual int getType() const;
 
-
   /**
-   * @brief Perform writing to vtk file
+   * @brief Takes a snapshot of the mesh and queues it for writing to vtk files.
    */
   virtual void doExport (
     const std::string& name,
     const std::string& location,
     mesh::Mesh&        mesh );
 
-  static void writeVertex (
-    const Eigen::VectorXd& position,
-    std::ofstream&         outFile );
-
-  static void writeLine (
-    mesh::Edge&    edge,
-    std::ofstream& outFile );
-
-  static void writeTriangle (
-    mesh::Triangle& triangle,
-    std::ofstream&  outFile );
-
-  static void writeQuadrangle (
-    mesh::Quad&    quad,
-    std::ofstream& outFile );
+  /**
+   * @brief Blocks until all queued exports are written.
+   */
+  virtual void wait();
 
 private:
 
+   /// Copy of the mesh and its data taken by doExport().
+   struct Piece;
+
    // @brief Logging device.
    static logging::Logger _log;
 
    // @brief By default set true: plot vertex normals, false: no normals plotting
    bool _writeNormals;
 
+   // @brief Encoding of the data arrays.
+   Format _format;
+
    // @ brief dimensions of mesh
    int _meshDimensions;
 
@@ -82,6 +92,9 @@ private:
    // @brief List of names of all vector data on mesh
    std::vector<std::string> _vectorDataNames;
 
+   // @brief Writes the files in the background, declared last to be joined first.
+   BackgroundWriter _writer;
+
    /**
     * @brief Stores scalar and vector data names in string vectors
     * Needed for writing master file and sub files
@@ -100,21 +113,28 @@ private:
      mesh::Mesh&        mesh);
 
    /**
-    * @brief Writes the sub file for each rank
+    * @brief Copies vertices, cells and data of the mesh.
     */
-   void writeSubFile
+   void takeSnapshot
    (
-     const std::string& name,
-     const std::string& location,
-     mesh::Mesh&        mesh);
+     mesh::Mesh& mesh,
+     Piece&      piece ) const;
 
-   void exportGeometry (
-     std::ofstream& outFile,
-     mesh::Mesh&    mesh );
+   /**
+    * @brief Writes the sub file of a rank from a snapshot
+    */
+   static void writeSubFile
+   (
+     const std::string& fileName,
+     const Piece&       piece );
 
-   void exportData (
-     std::ofstream& outFile,
-     mesh::Mesh&    mesh );
+   /**
+    * @brief Writes the concatenation of parts to a file
+    */
+   static void writeFile
+   (
+     const std::string&              fileName,
+     const std::vector<std::string>& parts );
 };
 
 }} // namespace precice, io
@@ -34,6 +34,10 @@ ExportConfiguration:: ExportConfiguration
   ATTR_NORMALS ( "normals" ),
   ATTR_SPACETREE ( "spacetree" ),
   ATTR_EVERY_ITERATION("every-iteration"),
+  ATTR_FORMAT("format"),
+  VALUE_ASCII("ascii"),
+  VALUE_BINARY("binary"),
+  VALUE_COMPRESSED("compressed"),
   //_isValid ( false ),
   _contexts()
 {
@@ -43,7 +47,19 @@ ExportConfiguration:: ExportConfiguration
   XMLTag::Occurrence occ = XMLTag::OCCUR_ARBITRARY;
   {
     XMLTag tag(*this, VALUE_VTK, occ, TAG);
-    tag.setDocumentation("Exports meshes to VTK text files.");
+    tag.setDocumentation("Exports meshes to VTK files.");
+
+    XMLAttribute<std::string> attrFormat(ATTR_FORMAT);
+    doc = "Encoding of the exported data. With " + VALUE_BINARY + " or " + VALUE_COMPRESSED;
+    doc += " (zlib), the data is written in binary to VTK XML files, also without a master.";
+    doc += " These exports are written in the background and are much faster than " + VALUE_ASCII + ".";
+    attrFormat.setDocumentation(doc);
+    ValidatorEquals<std::string> validAscii(VALUE_ASCII);
+    ValidatorEquals<std::string> validBinary(VALUE_BINARY);
+    ValidatorEquals<std::string> validCompressed(VALUE_COMPRESSED);
+    attrFormat.setValidator(validAscii || validBinary || validCompressed);
+    attrFormat.setDefaultValue(VALUE_ASCII);
+    tag.addAttribute(attrFormat);
     tags.push_back(tag);
   }
   {
@@ -162,6 +178,9 @@ void ExportConfiguration:: xmlTagCallback
     context.exportSpacetree = tag.getBooleanAttributeValue(ATTR_SPACETREE);
     context.everyIteration = tag.getBooleanAttributeValue(ATTR_EVERY_ITERATION);
     context.type = tag.getName();
+    if (context.type == VALUE_VTK){
+      context.format = tag.getStringAttributeValue(ATTR_FORMAT);
+    }
     if ((context.timestepInterval == -1) &&  context.triggerSolverPlot){
       std::string error = "Attribute timestep interval has to be set when ";
       error += "trigger-solver is activated";
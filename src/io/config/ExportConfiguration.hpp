@@ -85,6 +85,10 @@ private:
   const std::string ATTR_NORMALS;
   const std::string ATTR_SPACETREE;
   const std::string ATTR_EVERY_ITERATION;
+  const std::string ATTR_FORMAT;
+  const std::string VALUE_ASCII;
+  const std::string VALUE_BINARY;
+  const std::string VALUE_COMPRESSED;
 
   // @brief Flag indicating success of configuration.
   //bool _isValid;
@@ -0,0 +1,233 @@
+#include "CheckpointTest.hpp"
+#include "io/Checkpoint.hpp"
+#include "io/CheckpointWriter.hpp"
+#include "mesh/Data.hpp"
+#include "mesh/Mesh.hpp"
+#include "mesh/Vertex.hpp"
+#include "mesh/Edge.hpp"
+#include "mesh/Triangle.hpp"
+#include "mesh/PropertyContainer.hpp"
+#include "geometry/Cuboid.hpp"
+#include "utils/Parallel.hpp"
+#include "math/math.hpp"
+#include <string>
+#include <vector>
+
+#include "tarch/tests/TestCaseFactory.h"
+registerTest(precice::io::tests::CheckpointTest)
+
+namespace precice {
+namespace io {
+namespace tests {
+
+logging::Logger CheckpointTest:: _log ( "precice::io::tests::CheckpointTest" );
+
+CheckpointTest:: CheckpointTest()
+:
+  TestCase ( "precice::io::tests::CheckpointTest" )
+{}
+
+void CheckpointTest:: run()
+{
+  PRECICE_MASTER_ONLY {
+    testMethod(testWriteRead);
+    testMethod(testMesh2D);
+    testMethod(testMesh3D);
+    testMethod(testWriter);
+  }
+}
+
+void CheckpointTest:: testWriteRead()
+{
+  TRACE();
+  Eigen::MatrixXd matrix(3, 2);
+  matrix << 1.0, 2.0, 3.0, 4.0, 5.0, 6.0;
+  Eigen::VectorXd vector = Eigen::VectorXd::LinSpaced(5, -1.0, 1.0);
+  std::vector<int> indices = {4, 2, 7};
+  {
+    Checkpoint checkpoint;
+    checkpoint.add("time", 0.25);
+    checkpoint.add("advancecalls", 12l);
+    checkpoint.add("matrix", matrix);
+    checkpoint.add("vector", vector);
+    checkpoint.add("empty", Eigen::MatrixXd());
+    checkpoint.add("indices", indices);
+    checkpoint.writeFile("io-CheckpointTest-testWriteRead.ckpt");
+  }
+
+  Checkpoint checkpoint;
+  checkpoint.readFile("io-CheckpointTest-testWriteRead.ckpt");
+  validate(checkpoint.contains("time"));
+  validate(not checkpoint.contains("timestep"));
+
+  double time = 0.0;
+  checkpoint.get("time", time);
+  validateNumericalEquals(time, 0.25);
+  long int advanceCalls = 0;
+  checkpoint.get("advancecalls", advanceCalls);
+  validateEquals(advanceCalls, 12);
+  int intAdvanceCalls = 0;
+  checkpoint.get("advancecalls", intAdvanceCalls);
+  validateEquals(intAdvanceCalls, 12);
+
+  Eigen::MatrixXd readMatrix;
+  checkpoint.get("matrix", readMatrix);
+  validateEquals(readMatrix.rows(), 3);
+  validateEquals(readMatrix.cols(), 2);
+  validate(math::equals(readMatrix, matrix));
+  Eigen::VectorXd readVector;
+  checkpoint.get("vector", readVector);
+  validateWithMessage(math::equals(readVector, vector), readVector);
+  checkpoint.get("empty", readMatrix);
+  validateEquals(readMatrix.size(), 0);
+  std::vector<int> readIndices;
+  checkpoint.get("indices", readIndices);
+  validate(readIndices == indices);
+}
+
+void CheckpointTest:: testMesh2D()
+{
+  TRACE();
+  mesh::Mesh::resetGeometryIDsGlobally();
+  int dim = 2;
+  mesh::Mesh mesh("TestCuboid", dim, false);
+  geometry::Cuboid cuboid(Eigen::Vector2d::Zero(), 1.0, Eigen::Vector2d::Constant(1.0));
+  mesh.setSubID("side-0");
+  mesh.setSubID("side-1");
+  mesh::PtrData data = mesh.createData("TestData", 2);
+  cuboid.create(mesh);
+  for (int i=0; i < data->values().size(); i++){
+    data->values()(i) = 0.5 * i;
+  }
+
+  {
+    Checkpoint checkpoint;
+    checkpoint.addMesh(mesh);
+    checkpoint.writeFile("io-CheckpointTest-testMesh2D.ckpt");
+  }
+
+  mesh::Mesh restoredMesh("TestCuboid", dim, false);
+  mesh::PtrData restoredData = restoredMesh.createData("TestData", 2);
+  restoredMesh.setSubID("side-0");
+  restoredMesh.setSubID("side-1");
+  Checkpoint checkpoint;
+  checkpoint.readFile("io-CheckpointTest-testMesh2D.ckpt");
+  checkpoint.restoreMesh(restoredMesh, true);
+
+  validateEquals(restoredMesh.vertices().size(), mesh.vertices().size());
+  validateEquals(restoredMesh.edges().size(), mesh.edges().size());
+  validate(restoredMesh.vertexCoords() == mesh.vertexCoords());
+  for (size_t i=0; i < mesh.edges().size(); i++){
+    validateEquals(restoredMesh.edges()[i].vertex(0).getID(), mesh.edges()[i].vertex(0).getID());
+    validateEquals(restoredMesh.edges()[i].vertex(1).getID(), mesh.edges()[i].vertex(1).getID());
+  }
+  validateWithMessage(math::equals(restoredData->values(), data->values()), restoredData->values());
+
+  int id = mesh::PropertyContainer::INDEX_GEOMETRY_ID;
+  for (size_t i=0; i < mesh.vertices().size(); i++){
+    std::vector<int> properties;
+    std::vector<int> restoredProperties;
+    mesh.vertices()[i].getProperties(id, properties);
+    restoredMesh.vertices()[i].getProperties(id, restoredProperties);
+    validateEqualsWithMessage(restoredProperties.size(), properties.size(), i);
+  }
+  for (size_t i=0; i < mesh.edges().size(); i++){
+    std::vector<int> properties;
+    std::vector<int> restoredProperties;
+    mesh.edges()[i].getProperties(id, properties);
+    restoredMesh.edges()[i].getProperties(id, restoredProperties);
+    validateEqualsWithMessage(restoredProperties.size(), properties.size(), i);
+  }
+}
+
+void CheckpointTest:: testMesh3D()
+{
+  TRACE();
+  int dim = 3;
+  mesh::Mesh mesh("TestTriangles", dim, false);
+  mesh::PtrData data = mesh.createData("TestData", 1);
+  mesh::Vertex& v0 = mesh.createVertex(Eigen::Vector3d(0.0, 0.0, 0.0));
+  mesh::Vertex& v1 = mesh.createVertex(Eigen::Vector3d(1.0, 0.0, 0.0));
+  mesh::Vertex& v2 = mesh.createVertex(Eigen::Vector3d(0.0, 1.0, 0.0));
+  mesh::Vertex& v3 = mesh.createVertex(Eigen::Vector3d(0.0, 0.0, 1.0));
+  mesh::Edge& e01 = mesh.createEdge(v0, v1);
+  mesh::Edge& e12 = mesh.createEdge(v1, v2);
+  mesh::Edge& e20 = mesh.createEdge(v2, v0);
+  mesh::Edge& e13 = mesh.createEdge(v1, v3);
+  mesh::Edge& e30 = mesh.createEdge(v3, v0);
+  mesh.createTriangle(e01, e12, e20);
+  mesh.createTriangle(e01, e13, e30);
+  mesh.allocateDataValues();
+  data->values() << 1.0, 2.0, 3.0, 4.0;
+
+  Checkpoint checkpoint;
+  checkpoint.addMesh(mesh);
+  checkpoint.writeFile("io-CheckpointTest-testMesh3D.ckpt");
+  checkpoint.readFile("io-CheckpointTest-testMesh3D.ckpt");
+
+  // Restore into a mesh, of which the vertices are already set by the solver
+  mesh::Mesh restoredMesh("TestTriangles", dim, false);
+  mesh::PtrData restoredData = restoredMesh.createData("TestData", 1);
+  for (const mesh::Vertex& vertex : mesh.vertices()){
+    restoredMesh.createVertex(vertex.getCoords());
+  }
+  checkpoint.restoreMesh(restoredMesh, false);
+  validateEquals(restoredMesh.vertices().size(), 4);
+  validateWithMessage(math::equals(restoredData->values(), data->values()), restoredData->values());
+
+  // Restore into an empty mesh
+  mesh::Mesh createdMesh("TestTriangles", dim, false);
+  mesh::PtrData createdData = createdMesh.createData("TestData", 1);
+  checkpoint.restoreMesh(createdMesh, true);
+  validateEquals(createdMesh.vertices().size(), 4);
+  validateEquals(createdMesh.edges().size(), 5);
+  validateEquals(createdMesh.triangles().size(), 2);
+  for (size_t i=0; i < mesh.triangles().size(); i++){
+    for (int j=0; j < 3; j++){
+      validateEquals(createdMesh.triangles()[i].edge(j).getID(), mesh.triangles()[i].edge(j).getID());
+      validateEquals(createdMesh.triangles()[i].vertex(j).getID(), mesh.triangles()[i].vertex(j).getID());
+    }
+  }
+  validateWithMessage(math::equals(createdData->values(), data->values()), createdData->values());
+}
+
+void CheckpointTest:: testWriter()
+{
+  TRACE();
+  const int count = 5;
+  {
+    CheckpointWriter writer;
+    for (int i=0; i < count; i++){
+      Checkpoint checkpoint;
+      checkpoint.add("timestep", (long int) i);
+      checkpoint.add("values", Eigen::VectorXd::Constant(1000, i));
+      writer.write("io-CheckpointTest-testWriter-" + std::to_string(i) + ".ckpt", std::move(checkpoint));
+    }
+    writer.wait();
+    Checkpoint checkpoint;
+    checkpoint.readFile("io-CheckpointTest-testWriter-0.ckpt");
+    long int timestep = -1;
+    checkpoint.get("timestep", timestep);
+    validateEquals(timestep, 0);
+
+    // The last checkpoint is written on destruction of the writer, at the latest
+    Checkpoint last;
+    last.add("timestep", (long int) count);
+    writer.write("io-CheckpointTest-testWriter-" + std::to_string(count) + ".ckpt", std::move(last));
+  }
+  for (int i=0; i <= count; i++){
+    Checkpoint checkpoint;
+    checkpoint.readFile("io-CheckpointTest-testWriter-" + std::to_string(i) + ".ckpt");
+    long int timestep = -1;
+    checkpoint.get("timestep", timestep);
+    validateEquals(timestep, i);
+    if (i < count){
+      Eigen::VectorXd values;
+      checkpoint.get("values", values);
+      validateEquals(values.size(), 1000);
+      validateNumericalEquals(values(999), (double) i);
+    }
+  }
+}
+
+}}} // namespace precice, io, tests
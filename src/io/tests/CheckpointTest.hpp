@@ -0,0 +1,65 @@
+#ifndef PRECICE_IO_TESTS_CHECKPOINTTEST_HPP_
+#define PRECICE_IO_TESTS_CHECKPOINTTEST_HPP_
+
+#include "tarch/tests/TestCase.h"
+#include "logging/Logger.hpp"
+
+namespace precice {
+namespace io {
+namespace tests {
+
+/**
+ * @brief Tests for io::Checkpoint and io::CheckpointWriter.
+ */
+class CheckpointTest : public tarch::tests::TestCase
+{
+public:
+
+  /**
+   * @brief Constructor.
+   */
+  CheckpointTest();
+
+  /**
+   * @brief Destructor, empty.
+   */
+  virtual ~CheckpointTest() {}
+
+  /**
+   * @brief Empty.
+   */
+  virtual void setUp() {}
+
+  /**
+   * @brief Calls all tests.
+   */
+  virtual void run();
+
+private:
+
+  static logging::Logger _log;
+
+  /**
+   * @brief Tests writing and reading values, vectors and matrices.
+   */
+  void testWriteRead();
+
+  /**
+   * @brief Tests restoring a 2D mesh with sub-IDs and data.
+   */
+  void testMesh2D();
+
+  /**
+   * @brief Tests restoring a 3D mesh and comparing it to already set vertices.
+   */
+  void testMesh3D();
+
+  /**
+   * @brief Tests writing several checkpoints in the background.
+   */
+  void testWriter();
+};
+
+}}} // namespace precice, io, tests
+
+#endif // PRECICE_IO_TESTS_CHECKPOINTTEST_HPP_
@@ -10,7 +10,15 @@
 #include "utils/Globals.hpp"
 #include "utils/MasterSlave.hpp"
 #include "com/MPIDirectCommunication.hpp"
+#include "math/math.hpp"
+#include <cstdint>
+#include <cstring>
+#include <fstream>
 #include <sstream>
+#include <vector>
+#ifndef PRECICE_NO_ZLIB
+#include <zlib.h>
+#endif
 
 #include "tarch/tests/TestCaseFactory.h"
 registerTest(precice::io::tests::ExportVTKXMLTest)
@@ -21,6 +29,52 @@ namespace tests {
 
 logging::Logger ExportVTKXMLTest:: _log ("precice::io::ExportVTKXMLTest");
 
+namespace {
+
+std::string readFile ( const std::string& fileName )
+{
+  std::ifstream in(fileName, std::ios::binary);
+  std::ostringstream content;
+  content << in.rdbuf();
+  return content.str();
+}
+
+/// Returns the position of the name attribute of a data array.
+size_t findArray ( const std::string& content, const std::string& name )
+{
+  return content.find("Name=\"" + name + "\"");
+}
+
+/// Reads the values of an inline ASCII data array.
+std::vector<double> readASCIIArray ( const std::string& content, const std::string& name )
+{
+  std::vector<double> values;
+  size_t begin = content.find('>', findArray(content, name)) + 1;
+  size_t end = content.find("</DataArray>", begin);
+  std::istringstream in(content.substr(begin, end - begin));
+  double value;
+  while (in >> value){
+    values.push_back(value);
+  }
+  return values;
+}
+
+/// Reads the offset of an appended data array.
+std::uint64_t readOffset ( const std::string& content, const std::string& name )
+{
+  size_t begin = content.find("offset=\"", findArray(content, name)) + 8;
+  return std::stoull(content.substr(begin, content.find('"', begin) - begin));
+}
+
+std::uint64_t readHeader ( const char* bytes, int index )
+{
+  std::uint64_t value;
+  std::memcpy(&value, bytes + index * sizeof(value), sizeof(value));
+  return value;
+}
+
+}
+
 ExportVTKXMLTest:: ExportVTKXMLTest()
 :
   TestCase ("io::ExportVTKXMLTest")
@@ -150,6 +204,22 @@ void ExportVTKXMLTest:: testExportTriangulatedMesh()
   std::string location = "";
   exportVTKXML.doExport ( filename.str(), location, mesh );
 
+  ExportVTKXML exportBinary(exportNormals, ExportVTKXML::BINARY);
+  exportBinary.doExport ( filename.str() + "-binary", location, mesh );
+  ExportVTKXML exportCompressed(exportNormals, ExportVTKXML::COMPRESSED);
+  exportCompressed.doExport ( filename.str() + "-compressed", location, mesh );
+  exportVTKXML.wait();
+  exportBinary.wait();
+  exportCompressed.wait();
+
+  if (not mesh.vertices().empty()){
+    std::string piece = "_r" + std::to_string(utils::MasterSlave::_rank) + ".vtu";
+    validateAppendedData(filename.str() + piece, filename.str() + "-binary" + piece, false);
+#   ifndef PRECICE_NO_ZLIB
+    validateAppendedData(filename.str() + piece, filename.str() + "-compressed" + piece, true);
+#   endif
+  }
+
   tearDownMasterSlave();
 }
 
@@ -226,6 +296,74 @@ void ExportVTKXMLTest:: testExportQuadMesh()
   tearDownMasterSlave();
 }
 
+void ExportVTKXMLTest:: validateAppendedData
+(
+  const std::string& asciiFileName,
+  const std::string& fileName,
+  bool               compressed )
+{
+  preciceTrace ( "validateAppendedData()", fileName );
+  std::string ascii = readFile(asciiFileName);
+  std::string content = readFile(fileName);
+  validateWithMessage(content.find("header_type=\"UInt64\"") != std::string::npos, fileName);
+  bool hasCompressor = content.find("vtkZLibDataCompressor") != std::string::npos;
+  validateEquals(hasCompressor, compressed);
+  size_t appended = content.find("<AppendedData encoding=\"raw\">");
+  validateWithMessage(appended != std::string::npos, fileName);
+  appended = content.find('_', appended) + 1;
+
+  // Float64 positions and Int32 connectivity
+  for (const char* name : {"Position", "connectivity"}){
+    bool isFloat = std::string(name) == "Position";
+    size_t valueSize = isFloat ? sizeof(double) : sizeof(std::int32_t);
+    std::vector<double> expected = readASCIIArray(ascii, name);
+    // A piece without cells, e.g., of a single vertex, has no connectivity
+    validateWithMessage(not (isFloat && expected.empty()), name);
+    if (expected.empty()){
+      continue;
+    }
+    std::uint64_t size = expected.size() * valueSize;
+    const char* block = content.data() + appended + readOffset(content, name);
+
+    std::string bytes;
+    if (not compressed){
+      validateEquals(readHeader(block, 0), size);
+      bytes.assign(block + sizeof(std::uint64_t), size);
+    }
+#   ifndef PRECICE_NO_ZLIB
+    else {
+      // number of blocks, size of a full and of the last block, compressed sizes
+      std::uint64_t blocks = readHeader(block, 0);
+      validateEquals(blocks, (std::uint64_t) 1);
+      validateEquals(readHeader(block, 1), (std::uint64_t) 32768);
+      validateEquals(readHeader(block, 2), size);
+      std::uint64_t compressedSize = readHeader(block, 3);
+      std::vector<Bytef> buffer(size);
+      uLongf decodedSize = size;
+      int status = uncompress(buffer.data(), &decodedSize,
+                              reinterpret_cast<const Bytef*>(block + 4 * sizeof(std::uint64_t)),
+                              compressedSize);
+      validateEquals(status, Z_OK);
+      validateEquals(decodedSize, size);
+      bytes.assign(reinterpret_cast<const char*>(buffer.data()), size);
+    }
+#   endif // not PRECICE_NO_ZLIB
+
+    for (size_t i=0; i < expected.size(); i++){
+      double value;
+      if (isFloat){
+        std::memcpy(&value, bytes.data() + i * valueSize, valueSize);
+      }
+      else {
+        std::int32_t intValue;
+        std::memcpy(&intValue, bytes.data() + i * valueSize, valueSize);
+        value = intValue;
+      }
+      validateWithParams3(math::equals(value, expected[i]), name, value, expected[i]);
+    }
+  }
+}
+
 void ExportVTKXMLTest:: setUpMasterSlave()
 {
   preciceTrace ( "setUpMasterSlave" );
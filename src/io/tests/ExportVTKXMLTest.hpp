@@ -5,6 +5,7 @@
 
 #include "tarch/tests/TestCase.h"
 #include "logging/Logger.hpp"
+#include <string>
 
 namespace precice {
 namespace io {
@@ -56,6 +57,17 @@ private:
     */
    void testExportQuadMesh();
 
+   /**
+    * @brief Reads back an appended binary piece and compares its arrays to the ASCII piece.
+    *
+    * Checks the size header of each array, for compressed data the header of
+    * the zlib blocks, and the decoded values.
+    */
+   void validateAppendedData (
+     const std::string& asciiFileName,
+     const std::string& fileName,
+     bool               compressed );
+
    void setUpMasterSlave();
 
    void tearDownMasterSlave();
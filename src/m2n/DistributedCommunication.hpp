@@ -1,6 +1,9 @@
 #pragma once
 
+#include "SendRequest.hpp"
+#include "com/Request.hpp"
 #include "mesh/SharedPointer.hpp"
+#include <vector>
 
 namespace precice {
 namespace m2n {
@@ -79,12 +82,56 @@ public:
     size_t     size,
     int     valueDimension) =0;
 
+  /**
+   * @brief Starts to send an array of double values from all slaves.
+   *
+   * The values are copied before returning, i.e., itemsToSend may be modified
+   * afterwards. The returned request completes, when the values have been
+   * transferred. The default implementation sends blocking.
+   */
+  virtual com::Request::SharedPointer aSend (
+    double* itemsToSend,
+    size_t     size,
+    int     valueDimension)
+  {
+    send(itemsToSend, size, valueDimension);
+    return std::make_shared<SendRequest>();
+  }
+
+  /**
+   * @brief Starts to send the arrays of several fields at once.
+   *
+   * Implementations may pack all fields into one message per remote rank. The
+   * default implementation sends the fields one after the other, blocking.
+   */
+  virtual com::Request::SharedPointer aSend (
+    const std::vector<double*>& itemsToSend,
+    const std::vector<size_t>&  sizes,
+    const std::vector<int>&     valueDimensions)
+  {
+    for (size_t i=0; i < itemsToSend.size(); i++){
+      send(itemsToSend[i], sizes[i], valueDimensions[i]);
+    }
+    return std::make_shared<SendRequest>();
+  }
+
   /// All slaves receive an array of doubles (different for each slave).
   virtual void receive (
     double* itemsToReceive,
     size_t     size,
     int     valueDimension) =0;
 
+  /// All slaves receive the arrays of several fields, sent by the batched aSend().
+  virtual void receive (
+    const std::vector<double*>& itemsToReceive,
+    const std::vector<size_t>&  sizes,
+    const std::vector<int>&     valueDimensions)
+  {
+    for (size_t i=0; i < itemsToReceive.size(); i++){
+      receive(itemsToReceive[i], sizes[i], valueDimensions[i]);
+    }
+  }
+
 protected:
   /**
    * @brief mesh that dictates the distribution of this mapping
@@ -4,6 +4,7 @@
 #include "DistributedCommunication.hpp"
 #include "DistributedComFactory.hpp"
 #include "GatherScatterCommunication.hpp"
+#include "SendRequest.hpp"
 #include "com/Communication.hpp"
 #include "utils/EventTimings.hpp"
 #include "utils/MasterSlave.hpp"
@@ -172,6 +173,27 @@ void M2N:: send (
   int     meshID,
   int     valueDimension )
 {
+  aSend(itemsToSend, size, meshID, valueDimension)->wait();
+}
+
+com::Request::SharedPointer M2N:: aSend (
+  double* itemsToSend,
+  int     size,
+  int     meshID,
+  int     valueDimension )
+{
+  return aSend(std::vector<double*>{itemsToSend}, std::vector<int>{size},
+               meshID, std::vector<int>{valueDimension});
+}
+
+com::Request::SharedPointer M2N:: aSend (
+  const std::vector<double*>& itemsToSend,
+  const std::vector<int>&     sizes,
+  int                         meshID,
+  const std::vector<int>&     valueDimensions )
+{
+  assertion(itemsToSend.size() == sizes.size(), itemsToSend.size(), sizes.size());
+  assertion(itemsToSend.size() == valueDimensions.size(), itemsToSend.size(), valueDimensions.size());
   if(utils::MasterSlave::_slaveMode || utils::MasterSlave::_masterMode){
     assertion(_areSlavesConnected);
     assertion(_distComs.find(meshID) != _distComs.end());
@@ -179,8 +201,6 @@ void M2N:: send (
 
 #ifdef M2N_PRE_SYNCHRONIZE
     if(not precice::testMode){
-//      Event e("M2N::send/synchronize", true);
-
       if(not utils::MasterSlave::_slaveMode){
         bool ack;
 
@@ -191,11 +211,17 @@ void M2N:: send (
     }
 #endif
 
-    _distComs[meshID]->send(itemsToSend,size,valueDimension);
+    return _distComs[meshID]->aSend(itemsToSend,
+                                    std::vector<size_t>(sizes.begin(), sizes.end()),
+                                    valueDimensions);
   }
   else{//coupling mode
+    // The master communication sends from itemsToSend directly, hence blocking
     assertion(_isMasterConnected);
-    _masterCom->send(itemsToSend, size, 0);
+    for (size_t i=0; i < itemsToSend.size(); i++){
+      _masterCom->send(itemsToSend[i], sizes[i], 0);
+    }
+    return std::make_shared<SendRequest>();
   }
 }
 
@@ -224,6 +250,18 @@ void M2N:: receive (
   int     meshID,
   int     valueDimension )
 {
+  receive(std::vector<double*>{itemsToReceive}, std::vector<int>{size},
+          meshID, std::vector<int>{valueDimension});
+}
+
+void M2N:: receive (
+  const std::vector<double*>& itemsToReceive,
+  const std::vector<int>&     sizes,
+  int                         meshID,
+  const std::vector<int>&     valueDimensions )
+{
+  assertion(itemsToReceive.size() == sizes.size(), itemsToReceive.size(), sizes.size());
+  assertion(itemsToReceive.size() == valueDimensions.size(), itemsToReceive.size(), valueDimensions.size());
   if(utils::MasterSlave::_slaveMode || utils::MasterSlave::_masterMode){
     assertion(_areSlavesConnected);
     assertion(_distComs.find(meshID) != _distComs.end());
@@ -243,11 +281,15 @@ void M2N:: receive (
     }
 #endif
 
-    _distComs[meshID]->receive(itemsToReceive,size,valueDimension);
+    _distComs[meshID]->receive(itemsToReceive,
+                               std::vector<size_t>(sizes.begin(), sizes.end()),
+                               valueDimensions);
   }
   else{//coupling mode
     assertion(_isMasterConnected);
-    _masterCom->receive(itemsToReceive, size, 0);
+    for (size_t i=0; i < itemsToReceive.size(); i++){
+      _masterCom->receive(itemsToReceive[i], sizes[i], 0);
+    }
   }
 }
 
@@ -8,6 +8,7 @@
 #include "logging/Logger.hpp"
 
 #include <map>
+#include <vector>
 
 namespace precice {
 namespace m2n {
@@ -116,6 +117,32 @@ public:
     int     meshID,
     int     valueDimension );
 
+  /**
+   * @brief Starts to send an array of double values from all slaves (different for each slave).
+   *
+   * The values are copied before returning, i.e., itemsToSend may be modified
+   * afterwards. The returned request completes, when the values have been
+   * transferred. Without master-slave mode, the values are sent blocking.
+   */
+  com::Request::SharedPointer aSend (
+    double* itemsToSend,
+    int     size,
+    int     meshID,
+    int     valueDimension );
+
+  /**
+   * @brief Starts to send the arrays of several fields on the same mesh at once.
+   *
+   * With a point-to-point distributed communication, all fields are packed into
+   * one message per remote rank. The remote participant has to receive the
+   * same fields in the same order by the batched receive().
+   */
+  com::Request::SharedPointer aSend (
+    const std::vector<double*>& itemsToSend,
+    const std::vector<int>&     sizes,
+    int                         meshID,
+    const std::vector<int>&     valueDimensions );
+
   /**
    * @brief The master sends a bool to the other master, for performance reasons, we
    * neglect the gathering and checking step.
@@ -140,6 +167,15 @@ public:
     int     meshID,
     int     valueDimension );
 
+  /**
+   * @brief All slaves receive the arrays of several fields on the same mesh at once.
+   */
+  void receive (
+    const std::vector<double*>& itemsToReceive,
+    const std::vector<int>&     sizes,
+    int                         meshID,
+    const std::vector<int>&     valueDimensions );
+
   /**
    * @brief All slaves receive a bool (the same for each slave).
    */
@@ -6,6 +6,8 @@
 #include "utils/MasterSlave.hpp"
 #include "utils/Publisher.hpp"
 
+#include <algorithm>
+#include <unordered_map>
 #include <vector>
 
 using precice::utils::Event;
@@ -71,77 +73,6 @@ receive(std::map<int, std::vector<int>>& m,
   }
 }
 
-void
-broadcast(std::vector<int> const& v,
-          com::Communication::SharedPointer communication =
-              utils::MasterSlave::_communication) {
-  communication->broadcast(static_cast<int>(v.size()));
-  communication->broadcast(const_cast<int*>(&v[0]), v.size());
-}
-
-void
-broadcast(std::vector<int>& v,
-          int rankBroadcaster,
-          com::Communication::SharedPointer communication =
-              utils::MasterSlave::_communication) {
-  v.clear();
-
-  int size = 0;
-
-  communication->broadcast(size, rankBroadcaster);
-
-  v.resize(size);
-
-  communication->broadcast(&v[0], size, rankBroadcaster);
-}
-
-void
-broadcastSend(std::map<int, std::vector<int>> const& m,
-              com::Communication::SharedPointer communication =
-                  utils::MasterSlave::_communication) {
-  communication->broadcast(static_cast<int>(m.size()));
-
-  for (auto const& i : m) {
-    auto const& rank = i.first;
-    auto const& indices = i.second;
-
-    communication->broadcast(rank);
-    broadcast(indices, communication);
-  }
-}
-
-void
-broadcastReceive(std::map<int, std::vector<int>>& m,
-                 int rankBroadcaster,
-                 com::Communication::SharedPointer communication =
-                     utils::MasterSlave::_communication) {
-  m.clear();
-
-  int size = 0;
-
-  communication->broadcast(size, rankBroadcaster);
-
-  while (size--) {
-    int rank = -1;
-
-    communication->broadcast(rank, rankBroadcaster);
-    broadcast(m[rank], rankBroadcaster, communication);
-  }
-}
-
-void
-broadcast(std::map<int, std::vector<int>>& m) {
-  if (utils::MasterSlave::_masterMode) {
-    // Broadcast (send) vertex distributions.
-    m2n::broadcastSend(m);
-  } else {
-    assertion(utils::MasterSlave::_slaveMode);
-
-    // Broadcast (receive) vertex distributions.
-    m2n::broadcastReceive(m, 0);
-  }
-}
-
 void
 print(std::map<int, std::vector<int>> const& m) {
   std::ostringstream oss;
@@ -278,47 +209,58 @@ printLocalIndexCountStats(std::map<int, std::vector<int>> const& m) {
   }
 }
 
-// The approximate complexity of this function is O((number of local data
-// indices for the current rank in `thisVertexDistribution') * (total number of
-// data indices for all ranks in `otherVertexDistribution')).
+// Returns a mapping from global data indices to the ranks in
+// `vertexDistribution', which hold them. The complexity is linear in the total
+// number of data indices in `vertexDistribution'.
+std::unordered_map<int, std::vector<int>>
+buildRankDirectory(std::map<int, std::vector<int>> const& vertexDistribution) {
+  std::unordered_map<int, std::vector<int>> rankDirectory;
+
+  for (auto const& i : vertexDistribution) {
+    for (int index : i.second) {
+      std::vector<int>& ranks = rankDirectory[index];
+
+      // Ranks are visited in ascending order, duplicates are hence adjacent.
+      if (ranks.empty() || ranks.back() != i.first)
+        ranks.push_back(i.first);
+    }
+  }
+
+  return rankDirectory;
+}
+
+// The complexity of this function is O(number of local data indices of the
+// current rank), since the ranks of the other participant holding an index
+// are looked up in `otherRankDirectory' (see buildRankDirectory()).
 std::map<int, std::vector<int>>
 buildCommunicationMap(
     // `localIndexCount' is the number of unique local indices for the current
     // rank.
     size_t& localIndexCount,
-    // `thisVertexDistribution' is input vertex distribution from this
-    // participant.
-    std::map<int, std::vector<int>> const& thisVertexDistribution,
-    // `otherVertexDistribution' is input vertex distribution from other
-    // participant.
-    std::map<int, std::vector<int>> const& otherVertexDistribution,
-    int thisRank = utils::MasterSlave::_rank) {
+    // `indices' are the global data indices of the current rank.
+    std::vector<int> const& indices,
+    // `otherRankDirectory' maps global data indices to the ranks of the other
+    // participant, which hold them.
+    std::unordered_map<int, std::vector<int>> const& otherRankDirectory) {
 
   localIndexCount = 0;
-  
-  std::map<int, std::vector<int>> communicationMap;
 
-  auto iterator = thisVertexDistribution.find(thisRank);
-  
-  if (iterator == thisVertexDistribution.end())
-    return communicationMap;
-  
-  auto const& indices = iterator->second;
+  std::map<int, std::vector<int>> communicationMap;
 
   int index = 0;
 
   for (int thisIndex : indices) {
-    for (auto &other : otherVertexDistribution) {
-      for (auto &otherIndex : other.second) {
-        if (thisIndex == otherIndex) {
-          communicationMap[other.first].push_back(index);
-          break;
-        }
+    auto iterator = otherRankDirectory.find(thisIndex);
+
+    if (iterator != otherRankDirectory.end()) {
+      for (int otherRank : iterator->second) {
+        communicationMap[otherRank].push_back(index);
       }
     }
+
     ++index;
   }
-  
+
   // CAUTION:
   // This prevents point-to-point communication from considering those process
   // ranks, which don't have matching indices in the remote participant
@@ -332,6 +274,54 @@ buildCommunicationMap(
   return communicationMap;
 }
 
+// Computes the communication maps of all ranks of the current participant on
+// the master and sends each slave only its own one. Hence, only the master
+// needs the vertex distributions of both participants, while the memory of a
+// slave stays proportional to its number of local data indices.
+std::map<int, std::vector<int>>
+scatterCommunicationMaps(
+    size_t& localIndexCount,
+    // Vertex distributions, only required on the master.
+    std::map<int, std::vector<int>> const& thisVertexDistribution,
+    std::map<int, std::vector<int>> const& otherVertexDistribution) {
+  std::map<int, std::vector<int>> communicationMap;
+
+  if (utils::MasterSlave::_masterMode) {
+    auto otherRankDirectory = buildRankDirectory(otherVertexDistribution);
+
+    std::vector<int> const noIndices;
+
+    auto indicesOf = [&](int rank) -> std::vector<int> const& {
+      auto iterator = thisVertexDistribution.find(rank);
+      return iterator == thisVertexDistribution.end() ? noIndices : iterator->second;
+    };
+
+    for (int rankSlave = 1; rankSlave < utils::MasterSlave::_size; ++rankSlave) {
+      size_t slaveIndexCount = 0;
+
+      auto slaveCommunicationMap = buildCommunicationMap(
+          slaveIndexCount, indicesOf(rankSlave), otherRankDirectory);
+
+      utils::MasterSlave::_communication->send(static_cast<int>(slaveIndexCount), rankSlave);
+      m2n::send(slaveCommunicationMap, rankSlave, utils::MasterSlave::_communication);
+    }
+
+    communicationMap = buildCommunicationMap(
+        localIndexCount, indicesOf(utils::MasterSlave::_rank), otherRankDirectory);
+  } else {
+    assertion(utils::MasterSlave::_slaveMode);
+
+    int count = 0;
+
+    utils::MasterSlave::_communication->receive(count, 0);
+    m2n::receive(communicationMap, 0, utils::MasterSlave::_communication);
+
+    localIndexCount = count;
+  }
+
+  return communicationMap;
+}
+
 std::string PointToPointCommunication::_prefix;
 
 PointToPointCommunication::ScopedSetEventNamePrefix::ScopedSetEventNamePrefix(
@@ -413,14 +403,12 @@ PointToPointCommunication::acceptConnection(std::string const& nameAcceptor,
     assertion(utils::MasterSlave::_slaveMode);
   }
 
-  m2n::broadcast(vertexDistribution);
-  m2n::broadcast(requesterVertexDistribution);
-
   // Local (for process rank in the current participant) communication map that
   // defines a mapping from a process rank in the remote participant to an array
   // of local data indices, which define a subset of local (for process rank in
   // the current participant) data to be communicated between the current
-  // process rank and the remote process rank.
+  // process rank and the remote process rank. It is computed by the master and
+  // sent to each rank.
   //
   // Example. Assume that the current process rank is 3. Assume that its
   // `communicationMap' is
@@ -433,7 +421,7 @@ PointToPointCommunication::acceptConnection(std::string const& nameAcceptor,
   //   the remote process with rank 1;
   // - has to communicate (send/receive) data with local indices 0 and 2 with
   //   the remote process with rank 4.
-  std::map<int, std::vector<int>> communicationMap = m2n::buildCommunicationMap(
+  std::map<int, std::vector<int>> communicationMap = m2n::scatterCommunicationMaps(
       _localIndexCount, vertexDistribution, requesterVertexDistribution);
 
 // Print `communicationMap'.
@@ -574,14 +562,12 @@ PointToPointCommunication::requestConnection(std::string const& nameAcceptor,
 
   }
 
-  m2n::broadcast(vertexDistribution);
-  m2n::broadcast(acceptorVertexDistribution);
-
   // Local (for process rank in the current participant) communication map that
   // defines a mapping from a process rank in the remote participant to an array
   // of local data indices, which define a subset of local (for process rank in
   // the current participant) data to be communicated between the current
-  // process rank and the remote process rank.
+  // process rank and the remote process rank. It is computed by the master and
+  // sent to each rank.
   //
   // Example. Assume that the current process rank is 3. Assume that its
   // `communicationMap' is
@@ -594,7 +580,7 @@ PointToPointCommunication::requestConnection(std::string const& nameAcceptor,
   //   the remote process with rank 1;
   // - has to communicate (send/receive) data with local indices 0 and 2 with
   //   the remote process with rank 4.
-  std::map<int, std::vector<int>> communicationMap = m2n::buildCommunicationMap(
+  std::map<int, std::vector<int>> communicationMap = m2n::scatterCommunicationMaps(
       _localIndexCount, vertexDistribution, acceptorVertexDistribution);
 
 // Print `communicationMap'.
@@ -696,6 +682,12 @@ PointToPointCommunication::closeConnection() {
   if (not isConnected())
     return;
 
+  com::Request::wait(_sendRequests);
+
+  _sendRequests.clear();
+
+  _sendBuffers.clear();
+
   for (auto& mapping : _mappings) {
     mapping.communication->closeConnection();
   }
@@ -715,78 +707,158 @@ void
 PointToPointCommunication::send(double* itemsToSend,
                                 size_t size,
                                 int valueDimension) {
+  aSend(itemsToSend, size, valueDimension)->wait();
+}
+
+com::Request::SharedPointer
+PointToPointCommunication::aSend(double* itemsToSend,
+                                 size_t size,
+                                 int valueDimension) {
+  return aSend(std::vector<double*>{itemsToSend},
+               std::vector<size_t>{size},
+               std::vector<int>{valueDimension});
+}
+
+com::Request::SharedPointer
+PointToPointCommunication::aSend(std::vector<double*> const& itemsToSend,
+                                 std::vector<size_t> const& sizes,
+                                 std::vector<int> const& valueDimensions) {
+  assertion(itemsToSend.size() == sizes.size(), itemsToSend.size(), sizes.size());
+  assertion(itemsToSend.size() == valueDimensions.size(), itemsToSend.size(), valueDimensions.size());
 
   if (_mappings.size() == 0) {
-    preciceCheck(size==0, "send()", "preCICE trys to communicate data to/from a processor that has no surface "
-                                 << "overlay with the connected participant. Please check the definition of your "
-                                 << "coupling surfaces.");
+    for (size_t size : sizes) {
+      preciceCheck(size==0, "send()", "preCICE trys to communicate data to/from a processor that has no surface "
+                                   << "overlay with the connected participant. Please check the definition of your "
+                                   << "coupling surfaces.");
+    }
     assertion(_localIndexCount==0);
-    return;
+    return std::make_shared<SendRequest>();
+  }
+
+  int totalValueDimension = 0;
+  for (size_t field = 0; field < itemsToSend.size(); ++field) {
+    assertion(sizes[field] == _localIndexCount * valueDimensions[field],
+              sizes[field], _localIndexCount * valueDimensions[field]);
+    totalValueDimension += valueDimensions[field];
   }
 
-  assertion(size == _localIndexCount * valueDimension, size,_localIndexCount * valueDimension);
+  // Forget requests, which have completed and thereby released their buffers.
+  _sendRequests.erase(
+      std::remove_if(_sendRequests.begin(), _sendRequests.end(),
+                     [](com::Request::SharedPointer& request) { return request->test(); }),
+      _sendRequests.end());
+
+  // Take a buffer, which is not held by a pending request anymore.
+  SendRequest::Buffer buffer;
+  for (auto& sendBuffer : _sendBuffers) {
+    if (sendBuffer.use_count() == 1) {
+      buffer = sendBuffer;
+      break;
+    }
+  }
+  if (not buffer) {
+    buffer = std::make_shared<std::vector<double>>();
+    _sendBuffers.push_back(buffer);
+  }
+  buffer->resize(_totalIndexCount * totalValueDimension);
 
+  std::vector<com::Request::SharedPointer> requests;
+  requests.reserve(_mappings.size());
+
+  size_t offset = 0;
+
+  // One message per remote rank, containing the values of all fields one after
+  // the other.
   for (auto& mapping : _mappings) {
-    mapping.offset = _buffer.size();
+    double* values = buffer->data() + offset;
 
-    for (auto index : mapping.indices) {
-      for (int d = 0; d < valueDimension; ++d) {
-        _buffer.push_back(itemsToSend[index * valueDimension + d]);
+    for (size_t field = 0; field < itemsToSend.size(); ++field) {
+      int valueDimension = valueDimensions[field];
+
+      for (auto index : mapping.indices) {
+        for (int d = 0; d < valueDimension; ++d) {
+          *values++ = itemsToSend[field][index * valueDimension + d];
+        }
       }
     }
 
-    mapping.request =
-        mapping.communication->aSend(_buffer.data() + mapping.offset,
-                                     mapping.indices.size() * valueDimension,
-                                     mapping.localRemoteRank);
-  }
+    requests.push_back(
+        mapping.communication->aSend(buffer->data() + offset,
+                                     mapping.indices.size() * totalValueDimension,
+                                     mapping.localRemoteRank));
 
-  for (auto& mapping : _mappings) {
-    mapping.request->wait();
+    offset += mapping.indices.size() * totalValueDimension;
   }
 
-  _buffer.clear();
+  auto request = std::make_shared<SendRequest>(std::move(requests), std::move(buffer));
+  _sendRequests.push_back(request);
+  return request;
 }
 
 void
 PointToPointCommunication::receive(double* itemsToReceive,
                                    size_t size,
                                    int valueDimension) {
+  receive(std::vector<double*>{itemsToReceive},
+          std::vector<size_t>{size},
+          std::vector<int>{valueDimension});
+}
+
+void
+PointToPointCommunication::receive(std::vector<double*> const& itemsToReceive,
+                                   std::vector<size_t> const& sizes,
+                                   std::vector<int> const& valueDimensions) {
+  assertion(itemsToReceive.size() == sizes.size(), itemsToReceive.size(), sizes.size());
+  assertion(itemsToReceive.size() == valueDimensions.size(), itemsToReceive.size(), valueDimensions.size());
+
   if (_mappings.size() == 0) {
-    preciceCheck(size==0, "send()", "preCICE trys to communicate data to/from a processor that has no surface "
-                                     << "overlay with the connected participant. Please check the definition of your "
-                                     << "coupling surfaces.");
+    for (size_t size : sizes) {
+      preciceCheck(size==0, "send()", "preCICE trys to communicate data to/from a processor that has no surface "
+                                       << "overlay with the connected participant. Please check the definition of your "
+                                       << "coupling surfaces.");
+    }
     assertion(_localIndexCount==0);
     return;
   }
 
-  assertion(size == _localIndexCount * valueDimension, size,_localIndexCount * valueDimension);
+  int totalValueDimension = 0;
+  for (size_t field = 0; field < itemsToReceive.size(); ++field) {
+    assertion(sizes[field] == _localIndexCount * valueDimensions[field],
+              sizes[field], _localIndexCount * valueDimensions[field]);
+    std::fill(itemsToReceive[field], itemsToReceive[field] + sizes[field], 0);
+    totalValueDimension += valueDimensions[field];
+  }
 
-  std::fill(itemsToReceive, itemsToReceive + size, 0);
+  // Sized once, since the pending receives point into the buffer
+  _buffer.resize(_totalIndexCount * totalValueDimension);
 
-  for (auto& mapping : _mappings) {
-    mapping.offset = _buffer.size();
+  size_t offset = 0;
 
-    _buffer.resize(_buffer.size() + mapping.indices.size() * valueDimension);
+  for (auto& mapping : _mappings) {
+    mapping.offset = offset;
 
     mapping.request =
         mapping.communication->aReceive(_buffer.data() + mapping.offset,
-                                        mapping.indices.size() * valueDimension,
+                                        mapping.indices.size() * totalValueDimension,
                                         mapping.localRemoteRank);
+
+    offset += mapping.indices.size() * totalValueDimension;
   }
 
   for (auto& mapping : _mappings) {
     mapping.request->wait();
 
-    int i = 0;
+    const double* values = _buffer.data() + mapping.offset;
 
-    for (auto index : mapping.indices) {
-      for (int d = 0; d < valueDimension; ++d) {
-        itemsToReceive[index * valueDimension + d] +=
-            _buffer[mapping.offset + i * valueDimension + d];
-      }
+    for (size_t field = 0; field < itemsToReceive.size(); ++field) {
+      int valueDimension = valueDimensions[field];
 
-      i++;
+      for (auto index : mapping.indices) {
+        for (int d = 0; d < valueDimension; ++d) {
+          itemsToReceive[field][index * valueDimension + d] += *values++;
+        }
+      }
     }
   }
 
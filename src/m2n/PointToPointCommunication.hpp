@@ -81,6 +81,28 @@ public:
    */
   virtual void send(double* itemsToSend, size_t size, int valueDimension = 1);
 
+  /**
+   * @brief Starts to send a subset of local double values corresponding to
+   *        local indices deduced from the current and remote vertex
+   *        distributions.
+   *
+   * The values are packed into a send buffer, which is held by the returned
+   * request until the transfer has completed. Hence, itemsToSend may be
+   * modified right after the call.
+   */
+  virtual com::Request::SharedPointer aSend(double* itemsToSend,
+                                            size_t size,
+                                            int valueDimension = 1);
+
+  /**
+   * @brief Starts to send the values of several fields at once.
+   *
+   * The values of all fields are packed into one message per remote rank.
+   */
+  virtual com::Request::SharedPointer aSend(std::vector<double*> const& itemsToSend,
+                                            std::vector<size_t> const& sizes,
+                                            std::vector<int> const& valueDimensions);
+
   /**
    * @brief Receives a subset of local double values corresponding to local
    *        indices deduced from the current and remote vertex distributions.
@@ -89,6 +111,14 @@ public:
                        size_t size,
                        int valueDimension = 1);
 
+  /**
+   * @brief Receives the values of several fields at once, which have been sent
+   *        by the batched aSend().
+   */
+  virtual void receive(std::vector<double*> const& itemsToReceive,
+                       std::vector<size_t> const& sizes,
+                       std::vector<int> const& valueDimensions);
+
 private:
   static logging::Logger _log;
 
@@ -122,8 +152,20 @@ private:
    */
   std::vector<Mapping> _mappings;
 
+  /// Buffer to unpack received values.
   std::vector<double> _buffer;
 
+  /**
+   * @brief Pool of send buffers.
+   *
+   * A buffer is in use, as long as a pending request of aSend() holds it, and
+   * is reused afterwards.
+   */
+  std::vector<SendRequest::Buffer> _sendBuffers;
+
+  /// Requests of aSend(), which might not have completed yet.
+  std::vector<com::Request::SharedPointer> _sendRequests;
+
   size_t _localIndexCount;
 
   size_t _totalIndexCount;
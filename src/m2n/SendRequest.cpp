@@ -0,0 +1,41 @@
+#include "SendRequest.hpp"
+#include <utility>
+
+namespace precice {
+namespace m2n {
+
+SendRequest:: SendRequest()
+:
+  _requests(),
+  _buffer()
+{}
+
+SendRequest:: SendRequest
+(
+  std::vector<com::Request::SharedPointer> requests,
+  Buffer                                   buffer )
+:
+  _requests(std::move(requests)),
+  _buffer(std::move(buffer))
+{}
+
+bool SendRequest:: test()
+{
+  for (auto& request : _requests) {
+    if (not request->test()) {
+      return false;
+    }
+  }
+  _requests.clear();
+  _buffer.reset();
+  return true;
+}
+
+void SendRequest:: wait()
+{
+  com::Request::wait(_requests);
+  _requests.clear();
+  _buffer.reset();
+}
+
+}} // namespace precice, m2n
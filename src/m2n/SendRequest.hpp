@@ -0,0 +1,45 @@
+#pragma once
+
+#include "com/Request.hpp"
+#include <memory>
+#include <vector>
+
+namespace precice {
+namespace m2n {
+
+/**
+ * @brief Request of an asynchronous send to possibly several remote ranks.
+ *
+ * Completes, when all contained point-to-point requests have completed. Holds
+ * the send buffer until then, and releases it afterwards for reuse. A request
+ * without contained requests is completed from the beginning, which is used by
+ * blocking implementations of DistributedCommunication::aSend().
+ */
+class SendRequest : public com::Request
+{
+public:
+
+  using Buffer = std::shared_ptr<std::vector<double>>;
+
+  /// Constructor for a completed request.
+  SendRequest();
+
+  /// Constructor, the buffer is held until all requests have completed.
+  SendRequest (
+    std::vector<com::Request::SharedPointer> requests,
+    Buffer                                   buffer );
+
+  /// Returns true, if all requests have completed.
+  virtual bool test();
+
+  /// Waits until all requests have completed.
+  virtual void wait();
+
+private:
+
+  std::vector<com::Request::SharedPointer> _requests;
+
+  Buffer _buffer;
+};
+
+}} // namespace precice, m2n
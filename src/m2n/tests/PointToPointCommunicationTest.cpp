@@ -10,6 +10,7 @@
 
 #include "tarch/tests/TestCaseFactory.h"
 
+#include <algorithm>
 #include <vector>
 
 using precice::utils::Parallel;
@@ -67,6 +68,7 @@ PointToPointCommunicationTest::run() {
       testMethod(testSocketCommunication);
       #endif
       testMethod(testMPIPortsCommunication);
+      testMethod(testAsynchronousSend);
       Parallel::setGlobalCommunicator(Parallel::getCommunicatorWorld());
     }
   }
@@ -233,6 +235,182 @@ PointToPointCommunicationTest::test(
   Parallel::synchronizeProcesses();
   utils::Parallel::clearGroups();
 }
+
+void
+PointToPointCommunicationTest::testAsynchronousSend() {
+  preciceTrace("testAsynchronousSend");
+
+  com::CommunicationFactory::SharedPointer cf(
+      new com::MPIPortsCommunicationFactory);
+
+  assertion(Parallel::getCommunicatorSize() == 4);
+
+  validateEquals(Parallel::getCommunicatorSize(), 4);
+
+  MasterSlave::_communication =
+      com::Communication::SharedPointer(new com::MPIDirectCommunication);
+
+  mesh::PtrMesh mesh(new mesh::Mesh("Mesh", 2, true));
+
+  m2n::PointToPointCommunication c(cf, mesh);
+
+  vector<double> data;
+  vector<double> expectedData;
+
+  switch (Parallel::getProcessRank()) {
+  case 0: {
+    Parallel::splitCommunicator( "A.Master");
+
+    MasterSlave::_rank = 0;
+    MasterSlave::_size = 2;
+    MasterSlave::_masterMode = true;
+    MasterSlave::_slaveMode = false;
+
+    MasterSlave::_communication->acceptConnection("A.Master", "A.Slave", 0, 1);
+    MasterSlave::_communication->setRankOffset(1);
+
+    mesh->setGlobalNumberOfVertices(10);
+
+    mesh->getVertexDistribution()[0].push_back(0);
+    mesh->getVertexDistribution()[0].push_back(1); // <-
+    mesh->getVertexDistribution()[0].push_back(3);
+    mesh->getVertexDistribution()[0].push_back(5); // <-
+    mesh->getVertexDistribution()[0].push_back(7);
+
+    mesh->getVertexDistribution()[1].push_back(1); // <-
+    mesh->getVertexDistribution()[1].push_back(2);
+    mesh->getVertexDistribution()[1].push_back(4);
+    mesh->getVertexDistribution()[1].push_back(5); // <-
+    mesh->getVertexDistribution()[1].push_back(6);
+
+    data = {10, 20, 40, 60, 80};
+    expectedData = {10 + 2, 4 * 20 + 3, 40 + 2, 4 * 60 + 3, 80 + 2};
+
+    break;
+  }
+  case 1: {
+    Parallel::splitCommunicator( "A.Slave");
+
+    MasterSlave::_rank = 1;
+    MasterSlave::_size = 2;
+    MasterSlave::_masterMode = false;
+    MasterSlave::_slaveMode = true;
+
+    MasterSlave::_communication->requestConnection("A.Master", "A.Slave", 0, 1);
+
+    data = {20, 30, 50, 60, 70};
+    expectedData = {4 * 20 + 3, 30 + 1, 50 + 2, 4 * 60 + 3, 70 + 1};
+
+    break;
+  }
+  case 2: {
+    Parallel::splitCommunicator( "B.Master");
+
+    MasterSlave::_rank = 0;
+    MasterSlave::_size = 2;
+    MasterSlave::_masterMode = true;
+    MasterSlave::_slaveMode = false;
+
+    MasterSlave::_communication->acceptConnection("B.Master", "B.Slave", 0, 1);
+    MasterSlave::_communication->setRankOffset(1);
+
+    mesh->setGlobalNumberOfVertices(10);
+
+    mesh->getVertexDistribution()[0].push_back(1); // <-
+    mesh->getVertexDistribution()[0].push_back(2);
+    mesh->getVertexDistribution()[0].push_back(5); // <-
+    mesh->getVertexDistribution()[0].push_back(6);
+
+    mesh->getVertexDistribution()[1].push_back(0);
+    mesh->getVertexDistribution()[1].push_back(1); // <-
+    mesh->getVertexDistribution()[1].push_back(3);
+    mesh->getVertexDistribution()[1].push_back(4);
+    mesh->getVertexDistribution()[1].push_back(5); // <-
+    mesh->getVertexDistribution()[1].push_back(7);
+
+    data = {static_cast<double>(rand()), static_cast<double>(rand()), static_cast<double>(rand()), static_cast<double>(rand())};
+    expectedData = {2 * 20, 30, 2 * 60, 70};
+
+    break;
+  }
+  case 3: {
+    Parallel::splitCommunicator( "B.Slave");
+
+    MasterSlave::_rank = 1;
+    MasterSlave::_size = 2;
+    MasterSlave::_masterMode = false;
+    MasterSlave::_slaveMode = true;
+
+    MasterSlave::_communication->requestConnection("B.Master", "B.Slave", 0, 1);
+
+    data = {static_cast<double>(rand()), static_cast<double>(rand()), static_cast<double>(rand()), static_cast<double>(rand()), static_cast<double>(rand()), static_cast<double>(rand())};
+    expectedData = {10, 2 * 20, 40, 50, 2 * 60, 80};
+
+    break;
+  }
+  }
+
+  if (Parallel::getProcessRank() < 2) {
+    c.requestConnection("B", "A");
+
+    auto request = c.aSend(data.data(), data.size());
+
+    // The values have been copied to a send buffer already
+    vector<double> sentData = data;
+    std::fill(data.begin(), data.end(), 0.0);
+
+    request->wait();
+
+    c.receive(data.data(), data.size());
+
+    validate(equal(data, expectedData));
+
+    // Send two fields at once, the second one of dimension 2
+    vector<double> vectorData;
+    for (double value : sentData) {
+      vectorData.push_back(value);
+      vectorData.push_back(-value);
+    }
+
+    c.aSend({sentData.data(), vectorData.data()},
+            {sentData.size(), vectorData.size()},
+            {1, 2})->wait();
+  } else {
+    c.acceptConnection("B", "A");
+
+    c.receive(data.data(), data.size());
+
+    validate(equal(data, expectedData));
+
+    process(data);
+
+    c.aSend(data.data(), data.size())->wait();
+
+    vector<double> scalarData(expectedData.size());
+    vector<double> vectorData(2 * expectedData.size());
+    vector<double> expectedVectorData;
+    for (double value : expectedData) {
+      expectedVectorData.push_back(value);
+      expectedVectorData.push_back(-value);
+    }
+
+    c.receive({scalarData.data(), vectorData.data()},
+              {scalarData.size(), vectorData.size()},
+              {1, 2});
+
+    validate(equal(scalarData, expectedData));
+    validate(equal(vectorData, expectedVectorData));
+  }
+
+  MasterSlave::_communication.reset();
+  MasterSlave::_rank = Parallel::getProcessRank();
+  MasterSlave::_size = Parallel::getCommunicatorSize();
+  MasterSlave::_masterMode = false;
+  MasterSlave::_slaveMode = false;
+
+  Parallel::synchronizeProcesses();
+  utils::Parallel::clearGroups();
+}
 }
 }
 } // namespace precice, m2n, tests
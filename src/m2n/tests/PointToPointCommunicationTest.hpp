@@ -38,6 +38,11 @@ private:
   void testMPIPortsCommunication();
 
   void test(com::CommunicationFactory::SharedPointer cf);
+
+  /**
+   * @brief Exchanges data with aSend, also several fields in one message.
+   */
+  void testAsynchronousSend();
 };
 }
 }
@@ -1,7 +1,10 @@
 #include "NearestNeighborMapping.hpp"
 #include "query/FindClosestVertex.hpp"
+#include "query/VertexIndex.hpp"
 #include "utils/Helpers.hpp"
+#include "utils/Threads.hpp"
 #include <Eigen/Dense>
+#include <vector>
 
 namespace precice {
 namespace mapping {
@@ -26,33 +29,34 @@ void NearestNeighborMapping:: computeMapping()
   TRACE(input()->vertices().size());
   assertion(input().get() != nullptr);
   assertion(output().get() != nullptr);
+  mesh::PtrMesh searching; // Mesh whose vertices search for their closest vertex ...
+  mesh::PtrMesh searched;  // ... in this mesh
   if (getConstraint() == CONSISTENT){
     DEBUG("Compute consistent mapping");
-    size_t verticesSize = output()->vertices().size();
-    _vertexIndices.resize(verticesSize);
-    const mesh::Mesh::VertexContainer& outputVertices = output()->vertices();
-    for ( size_t i=0; i < verticesSize; i++ ){
-      const Eigen::VectorXd& coords = outputVertices[i].getCoords();
-      query::FindClosestVertex find(coords); // Search for the output vertex ...
-      find(*input()); // ... inside the input mesh
-      assertion(find.hasFound());
-      _vertexIndices[i] = find.getClosestVertex().getID();
-    }
+    searching = output();
+    searched = input();
   }
   else {
     assertion(getConstraint() == CONSERVATIVE, getConstraint());
     DEBUG("Compute conservative mapping");
-    size_t verticesSize = input()->vertices().size();
-    _vertexIndices.resize(verticesSize);
-    const mesh::Mesh::VertexContainer& inputVertices = input()->vertices();
-    for ( size_t i=0; i < verticesSize; i++ ){
-      const Eigen::VectorXd& coords = inputVertices[i].getCoords();
-      query::FindClosestVertex find(coords); // Search for the input vertex ...
-      find(*output()); // ... inside the output mesh
+    searching = input();
+    searched = output();
+  }
+  int verticesSize = (int) searching->vertices().size();
+  _vertexIndices.resize(verticesSize);
+  const mesh::Mesh::VertexContainer& vertices = searching->vertices();
+
+  // Built once here, the threads only read the index afterwards
+  query::VertexIndex index(searched);
+  index.update();
+  utils::Threads::parallelFor(0, verticesSize, [&](int thread, int begin, int end){
+    for (int i=begin; i < end; i++){
+      query::FindClosestVertex find(vertices[i].getCoords());
+      find(index);
       assertion(find.hasFound());
       _vertexIndices[i] = find.getClosestVertex().getID();
     }
-  }
+  }, _searchGrainSize);
   _hasComputedMapping = true;
 }
 
@@ -87,17 +91,20 @@ void NearestNeighborMapping:: map
                outputValues.size(), valueDimensions, output()->vertices().size() );
   if (getConstraint() == CONSISTENT){
     DEBUG("Map consistent");
-    size_t outSize = output()->vertices().size();
-    for ( size_t i=0; i < outSize; i++ ){
-      int inputIndex = _vertexIndices[i] * valueDimensions;
-      for ( int dim=0; dim < valueDimensions; dim++ ){
-        outputValues((i*valueDimensions)+dim) = inputValues(inputIndex+dim);
+    int outSize = (int) output()->vertices().size();
+    utils::Threads::parallelFor(0, outSize, [&](int thread, int begin, int end){
+      for (int i=begin; i < end; i++){
+        int inputIndex = _vertexIndices[i] * valueDimensions;
+        for (int dim=0; dim < valueDimensions; dim++){
+          outputValues((i*valueDimensions)+dim) = inputValues(inputIndex+dim);
+        }
       }
-    }
+    }, _mapGrainSize);
   }
   else {
     assertion(getConstraint() == CONSERVATIVE, getConstraint());
     DEBUG("Map conservative");
+    // Several input vertices may add to one output vertex, hence not threaded
     size_t inSize = input()->vertices().size();
     for ( size_t i=0; i < inSize; i++ ){
       int outputIndex = _vertexIndices[i] * valueDimensions;
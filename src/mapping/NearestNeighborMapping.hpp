@@ -46,6 +46,12 @@ private:
   // @brief Logging device.
   static logging::Logger _log;
 
+  // @brief Minimal number of vertices searched by one thread in computeMapping().
+  static const int _searchGrainSize = 256;
+
+  // @brief Minimal number of vertices copied by one thread in a consistent map().
+  static const int _mapGrainSize = 16384;
+
   // @brief Flag to indicate whether computeMapping() has been called.
   bool _hasComputedMapping;
 
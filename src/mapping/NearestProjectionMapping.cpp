@@ -1,6 +1,9 @@
 #include "NearestProjectionMapping.hpp"
 #include "query/FindClosest.hpp"
+#include "query/ElementIndex.hpp"
+#include "utils/Threads.hpp"
 #include <Eigen/Dense>
+#include <vector>
 
 namespace precice {
 namespace mapping {
@@ -30,35 +33,45 @@ NearestProjectionMapping:: NearestProjectionMapping
 void NearestProjectionMapping:: computeMapping()
 {
   TRACE(input()->vertices().size(), output()->vertices().size());
+  mesh::PtrMesh projected; // Mesh whose vertices are projected ...
+  mesh::PtrMesh searched;  // ... onto the mesh elements of this mesh
   if (getConstraint() == CONSISTENT){
     DEBUG("Compute consistent mapping");
-    _weights.resize(output()->vertices().size());
-    for ( size_t i=0; i < output()->vertices().size(); i++ ){
-      query::FindClosest findClosest(output()->vertices()[i].getCoords());
-      findClosest(*input()); // Search inside the input mesh for the output vertex
-      assertion(findClosest.hasFound());
-      const query::ClosestElement& closest = findClosest.getClosest();
-      _weights[i].clear();
-      for (const query::InterpolationElement& elem : closest.interpolationElements) {
-        _weights[i].push_back(elem);
-      }
-    }
+    projected = output();
+    searched = input();
   }
   else {
     assertion(getConstraint() == CONSERVATIVE, getConstraint());
     DEBUG("Compute conservative mapping");
-    _weights.resize(input()->vertices().size());
-    for ( size_t i=0; i < input()->vertices().size(); i++ ){
-      query::FindClosest findClosest(input()->vertices()[i].getCoords());
-      findClosest(*output());
+    projected = input();
+    searched = output();
+  }
+
+  // One index read by all threads, one buffer and list of weights per thread
+  query::ElementIndex index(searched);
+  index.update();
+  int threads = utils::Threads::getNumberOfThreads();
+  std::vector<query::ElementIndex::Buffer> buffers(threads);
+  std::vector<std::vector<Eigen::Triplet<double>>> threadTriplets(threads);
+  const mesh::Mesh::VertexContainer& vertices = projected->vertices();
+  utils::Threads::parallelFor(0, (int) vertices.size(), [&](int thread, int begin, int end){
+    for (int i=begin; i < end; i++){
+      query::FindClosest findClosest(vertices[i].getCoords());
+      findClosest(index.getCandidates(findClosest.getSearchPoint(), buffers[thread]));
       assertion(findClosest.hasFound());
       const query::ClosestElement& closest = findClosest.getClosest();
-      _weights[i].clear();
       for (const query::InterpolationElement& elem : closest.interpolationElements) {
-        _weights[i].push_back(elem);
+        threadTriplets[thread].emplace_back(i, elem.element->getID(), elem.weight);
       }
     }
+  }, _searchGrainSize);
+  // Threads hold consecutive vertices, hence the triplets keep the vertex order
+  std::vector<Eigen::Triplet<double>> triplets;
+  for (std::vector<Eigen::Triplet<double>>& chunk : threadTriplets){
+    triplets.insert(triplets.end(), chunk.begin(), chunk.end());
   }
+  _weights.resize(projected->vertices().size(), searched->vertices().size());
+  _weights.setFromTriplets(triplets.begin(), triplets.end());
   _hasComputedMapping = true;
 }
 
@@ -70,7 +83,7 @@ bool NearestProjectionMapping:: hasComputedMapping() const
 void NearestProjectionMapping:: clear()
 {
   TRACE();
-  _weights.clear();
+  _weights = Eigen::SparseMatrix<double, Eigen::RowMajor>();
   _hasComputedMapping = false;
 }
 
@@ -80,6 +93,7 @@ void NearestProjectionMapping:: map
   int outputDataID )
 {
   TRACE(inputDataID, outputDataID);
+  typedef Eigen::Matrix<double, Eigen::Dynamic, Eigen::Dynamic, Eigen::RowMajor> ValueMatrix;
   mesh::PtrData inData = input()->data(inputDataID);
   mesh::PtrData outData = output()->data(outputDataID);
   const Eigen::VectorXd& inValues = inData->values();
@@ -88,40 +102,29 @@ void NearestProjectionMapping:: map
   int dimensions = inData->getDimensions();
   assertion(dimensions == outData->getDimensions());
 
+  // Views the values as one row per vertex, holding the components
+  Eigen::Map<const ValueMatrix> in(inValues.data(), inValues.size() / dimensions, dimensions);
+  Eigen::Map<ValueMatrix> out(outValues.data(), outValues.size() / dimensions, dimensions);
+
   if (getConstraint() == CONSISTENT){
     DEBUG("Map consistent");
-    assertion(_weights.size() == output()->vertices().size(),
-               _weights.size(), output()->vertices().size());
-    for (size_t i=0; i < output()->vertices().size(); i++){
-      InterpolationElements& elems = _weights[i];
-      size_t outOffset = i * dimensions;
-      for (query::InterpolationElement& elem : elems) {
-        size_t inOffset = (size_t)elem.element->getID() * dimensions;
-        for (int dim=0; dim < dimensions; dim++){
-          assertion(outOffset + dim < (size_t)outValues.size());
-          assertion(inOffset + dim < (size_t)inValues.size());
-          outValues(outOffset + dim) += elem.weight * inValues(inOffset + dim);
-        }
-      }
-    }
+    assertion(_weights.rows() == (int)output()->vertices().size(),
+              _weights.rows(), output()->vertices().size());
+    assertion(_weights.cols() == in.rows(), _weights.cols(), in.rows());
+    assertion(_weights.rows() == out.rows(), _weights.rows(), out.rows());
+    utils::Threads::parallelFor(0, (int) out.rows(), [&](int thread, int begin, int end){
+      out.middleRows(begin, end - begin).noalias() += _weights.middleRows(begin, end - begin) * in;
+    }, _mapGrainSize);
   }
   else {
     assertion(getConstraint() == CONSERVATIVE, getConstraint());
     DEBUG("Map conservative");
-    assertion(_weights.size() == input()->vertices().size(),
-               _weights.size(), input()->vertices().size());
-    for (size_t i=0; i < input()->vertices().size(); i++){
-      size_t inOffset = i * dimensions;
-      InterpolationElements& elems = _weights[i];
-      for (query::InterpolationElement& elem : elems) {
-        size_t outOffset = (size_t)elem.element->getID() * dimensions;
-        for ( int dim=0; dim < dimensions; dim++ ){
-          assertion(outOffset + dim < (size_t)outValues.size());
-          assertion(inOffset + dim < (size_t)inValues.size());
-          outValues(outOffset + dim) += elem.weight * inValues(inOffset + dim);
-        }
-      }
-    }
+    assertion(_weights.rows() == (int)input()->vertices().size(),
+              _weights.rows(), input()->vertices().size());
+    assertion(_weights.rows() == in.rows(), _weights.rows(), in.rows());
+    assertion(_weights.cols() == out.rows(), _weights.cols(), out.rows());
+    // Rows of the transposed operator are scattered, hence not threaded
+    out.noalias() += _weights.transpose() * in;
   }
 }
 
@@ -129,24 +132,13 @@ bool NearestProjectionMapping::doesVertexContribute(
   int vertexID) const
 {
   TRACE(vertexID);
-  if (getConstraint() == CONSISTENT) {
-    for (size_t i=0; i < output()->vertices().size(); i++) {
-      const InterpolationElements& elems = _weights[i];
-      for (const query::InterpolationElement& elem : elems) {
-        if (elem.element->getID()==vertexID && elem.weight!=0.0) {
-          return true;
-        }
-      }
-    }
-  }
-  else {
-    assertion(getConstraint() == CONSERVATIVE, getConstraint());
-    for (size_t i=0; i < input()->vertices().size(); i++) {
-      const InterpolationElements& elems = _weights[i];
-      for (const query::InterpolationElement& elem : elems) {
-        if (elem.element->getID()==vertexID){ // && elem.weight!=0.0){
-          return true;
-        }
+  // Columns of the operator are the vertices of the searched mesh
+  const int* columns = _weights.innerIndexPtr();
+  const double* weights = _weights.valuePtr();
+  for (int i=0; i < _weights.nonZeros(); i++) {
+    if (columns[i] == vertexID){
+      if (getConstraint() == CONSERVATIVE || weights[i] != 0.0){
+        return true;
       }
     }
   }
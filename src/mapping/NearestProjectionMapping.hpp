@@ -1,10 +1,8 @@
 #pragma once
 
 #include "Mapping.hpp"
-#include <list>
-#include <vector>
 #include "logging/Logger.hpp"
-#include "query/FindClosest.hpp"
+#include <Eigen/SparseCore>
 
 namespace precice {
 namespace mapping {
@@ -59,8 +57,20 @@ private:
 
   static logging::Logger _log;
 
-  typedef std::list<query::InterpolationElement> InterpolationElements;
-  std::vector<InterpolationElements> _weights;
+  /// Minimal number of vertices projected by one thread in computeMapping().
+  static const int _searchGrainSize = 128;
+
+  /// Minimal number of operator rows applied by one thread in a consistent map().
+  static const int _mapGrainSize = 4096;
+
+  /**
+   * @brief Interpolation operator in compressed row storage.
+   *
+   * Holds one row per vertex of the projected mesh (output for consistent, input for
+   * conservative mapping) and one column per vertex of the searched mesh. It is applied
+   * to all data of the mesh pair, with all components of a data value at once.
+   */
+  Eigen::SparseMatrix<double, Eigen::RowMajor> _weights;
 
   bool _hasComputedMapping;
 };
@@ -3,10 +3,15 @@
 
 #include "mapping/Mapping.hpp"
 
+#include <deque>
+#include <limits>
 #include <map>
+#include <numeric>
+#include <vector>
 
 #include "math/math.hpp"
 #include "impl/BasisFunctions.hpp"
+#include "query/VertexIndex.hpp"
 #include "config/MappingConfiguration.hpp"
 #include "utils/Petsc.hpp"
 namespace petsc = precice::utils::petsc;
@@ -15,6 +20,7 @@ namespace petsc = precice::utils::petsc;
 #include "petscmat.h"
 #include "petscksp.h"
 #include "petsclog.h"
+#include "petscversion.h"
 
 namespace precice {
 namespace mapping {
@@ -101,6 +107,9 @@ private:
 
   const double _solverRtol;
 
+  /// Iterations of all solves since the last reset, counted by countIterations().
+  PetscInt _solverIterations;
+
   /// true if the mapping along some axis should be ignored
   bool* _deadAxis;
 
@@ -114,11 +123,37 @@ private:
 
   virtual bool doesVertexContribute(int vertexID) const override;
 
-  void incPrealloc(PetscInt* diag, PetscInt* offDiag, int pos, int begin, int end);
+  /**
+   * @brief Evaluates the basis function between point and the vertices of the indexed mesh.
+   *
+   * If the support radius of the basis function is finite and no axis is dead, only the
+   * vertices within the support radius are evaluated. Otherwise, all vertices are evaluated.
+   *
+   * @param[out] positions Ascending positions in Mesh::vertices() of the vertices with nonzero value.
+   * @param[out] values Basis function values for the vertices in positions.
+   */
+  void evaluateRow(query::VertexIndex&       index,
+                   const Eigen::VectorXd&    point,
+                   std::vector<int>&         positions,
+                   std::vector<PetscScalar>& values) const;
 
   /// Stores the solution from the previous iteration
   std::map<unsigned int, petsc::Vector> previousSolution;
 
+  /**
+   * @brief Solves C * solutions = rhs for all components of a data field at once.
+   *
+   * Uses a single KSPMatSolve with PETSc >= 3.14, otherwise one KSPSolve per component.
+   * The solutions hold the initial guesses on entry. The reported number of iterations
+   * is the sum over all components, or the number of block iterations for block methods.
+   */
+  void solve(std::vector<Vec>&  rhs,
+             std::vector<Vec>&  solutions,
+             const std::string& constraintName);
+
+  /// KSP monitor adding one to *iterations for every iteration of _solver, also inside KSPMatSolve.
+  static PetscErrorCode countIterations(KSP ksp, PetscInt iteration, PetscReal residualNorm, void* iterations);
+
   /// Prints an INFO about the current mapping
   void printMappingInfo(int inputDataID, int dim) const;
 };
@@ -148,6 +183,7 @@ PetRadialBasisFctMapping<RADIAL_BASIS_FUNCTION_T>::PetRadialBasisFctMapping
   _matrixQ(PETSC_COMM_WORLD, "Q"),
   _matrixV(PETSC_COMM_WORLD, "V"),
   _solverRtol(solverRtol),
+  _solverIterations(0),
   _polynomial(polynomial)
 {
   setInputRequirement(VERTEX);
@@ -180,6 +216,8 @@ PetRadialBasisFctMapping<RADIAL_BASIS_FUNCTION_T>::PetRadialBasisFctMapping
 
   KSPCreate(PETSC_COMM_WORLD, &_solver);
   KSPCreate(PETSC_COMM_WORLD, &_QRsolver);
+  // KSPGetIterationNumber only returns the iterations of the last column after KSPMatSolve
+  KSPMonitorSet(_solver, &countIterations, &_solverIterations, nullptr);
 }
 
 template<typename RADIAL_BASIS_FUNCTION_T>
@@ -201,7 +239,8 @@ template<typename RADIAL_BASIS_FUNCTION_T>
 void PetRadialBasisFctMapping<RADIAL_BASIS_FUNCTION_T>::computeMapping()
 {
   TRACE();
-  precice::utils::Event e(__func__);
+  static const int eventID = precice::utils::EventRegistry::getID(__func__);
+  precice::utils::Event e(eventID);
 
   if (_polynomial == Polynomial::ON) {
     DEBUG("Using integrated polynomial.");
@@ -304,66 +343,89 @@ void PetRadialBasisFctMapping<RADIAL_BASIS_FUNCTION_T>::computeMapping()
   ierr = ISDestroy(&ISidentityGlobal); CHKERRV(ierr);
   ierr = ISLocalToGlobalMappingDestroy(&ISidentityMapping); CHKERRV(ierr);
 
-  Eigen::VectorXd distance(dimensions);
+  // Column indices of the input vertices, as used by MatSetValuesLocal and mapped to the global
+  // Petsc ordering. The latter decides on the diagonal and off-diagonal blocks in the preallocation.
+  const size_t inputSize = inMesh->vertices().size();
+  std::vector<PetscInt> inColumns(inputSize), inPetscColumns(inputSize);
+  for (size_t i = 0; i < inputSize; i++)
+    inColumns[i] = inMesh->vertices()[i].getGlobalIndex() + polyparams;
+  ierr = ISLocalToGlobalMappingApply(_ISmapping, inputSize, inColumns.data(), inPetscColumns.data()); CHKERRV(ierr);
+
+  // Searches the vertices within the support radius of the basis function, such that the assembly
+  // of C and A does not evaluate all pairs of vertices for compactly supported basis functions.
+  query::VertexIndex index(inMesh);
+  std::vector<int> rowPositions;
+  std::vector<PetscScalar> rowValues;
 
-  // We do preallocating of the matrices C and A. That means we traverse the input data once, just
-  // to know where we have entries in the sparse matrix. This information petsc can use to
-  // preallocate the matrix. In the second phase we actually fill the matrix.
+  // We do preallocating of the matrices C and A. That means we compute the nonzero entries of each row
+  // once and count them, such that petsc can preallocate the matrix exactly. In the second phase we
+  // fill the matrix from the stored rows.
 
   // -- BEGIN PREALLOC LOOP FOR MATRIX C --
-  // TODO Testen ob Preallocation perfekt ist.
-  // MatSetOption(_matrixC, MAT_NEW_NONZERO_ALLOCATION_ERR, PETSC_FALSE);
-  // MatSetOption(_matrixA, MAT_NEW_NONZERO_ALLOCATION_ERR, PETSC_FALSE);
-  // {
-  //   DEBUG("Begin preallocation matrix C");
-  //   int logPreallocCLoop = 1;  //   PetscLogEventRegister("Prealloc Matrix C", 0, &logPreallocCLoop);
-  //   PetscLogEventBegin(logPreallocCLoop, 0, 0, 0, 0);
-  //   PetscInt nnz[n]; // Number of non-zeros per row
-
-  //   if (utils::MasterSlave::_rank <= 0)
-  //     for (int i = 0; i < polyparams; i++)
-  //       nnz[i] = n; // The first rows are dense, except the part in upper right corner
-
-  //   for (const mesh::Vertex& inVertex : inMesh->vertices()) {
-  //     if (not inVertex.isOwner())
-  //       continue;
-
-  //     int row = inVertex.getGlobalIndex() + polyparams - _matrixC.ownerRange().first; // getGlobalIndex ist absolut, row[] ist zero based
-  //     // DEBUG("Row = " << row << " n = " << n);
-  //     nnz[row] = 0;
+  DEBUG("Begin preallocation matrix C");
+  int logPreallocCLoop = 1;
+  PetscLogEventRegister("Prealloc Matrix C", 0, &logPreallocCLoop);
+  PetscLogEventBegin(logPreallocCLoop, 0, 0, 0, 0);
+  static const int ePreallocCID = precice::utils::EventRegistry::getID("PetRBF.preallocC");
+  precice::utils::Event ePreallocC(ePreallocCID);
+  const PetscInt ownerRangeCBegin = _matrixC.ownerRange().first;
+  const PetscInt ownerRangeCEnd = _matrixC.ownerRange().second;
+  // Matrix C stores the upper triangular part only, the diagonal is always set.
+  std::vector<PetscInt> diagNnzC(n, 1), offDiagNnzC(n, 0);
   
-  //     for (mesh::Vertex& vj : inMesh->vertices()) {
-  //       distance = inVertex.getCoords() - vj.getCoords();
-  //       for (int d = 0; d < dimensions; d++) {
-  //         if (_deadAxis[d]) {
-  //           distance[d] = 0;
-  //         }
-  //       }
-  //       double coeff = _basisFunction.evaluate(norm2(distance));
-  //       if (not tarch::la::equals(coeff, 0.0))
-  //         nnz[row]++;
-  //     }
-  //     // DEBUG("Reserved for row = " << row << ", reserved = " << nnz[row]);
-  //   }
-  //   PetscLogEventEnd(logPreallocCLoop, 0, 0, 0, 0);
-  //   // -- END PREALLOC LOOP FOR MATRIX C --
-
-  //   ierr = MatMPISBAIJSetPreallocation(_matrixC, 1, 0, nnz, 0, nnz); CHKERRV(ierr);    
-  // }
+  if (_polynomial == Polynomial::ON and utils::Parallel::getProcessRank() <= 0) {
+    // The polynom rows reside in the first rows and are dense in the vertex columns
+    for (size_t i = 0; i < polyparams; i++) {
+      diagNnzC[i] += ownerRangeCEnd - polyparams;
+      offDiagNnzC[i] += _matrixC.getSize().second - ownerRangeCEnd;
+    }
+  }
+
+  std::vector<size_t> rowBeginC(1, 0);
+  std::vector<PetscInt> colIdxC;
+  std::vector<PetscScalar> colValsC;
+  for (size_t i = 0; i < inputSize; i++) {
+    const mesh::Vertex& inVertex = inMesh->vertices()[i];
+    if (not inVertex.isOwner())
+      continue;
+
+    PetscInt row = inPetscColumns[i];
+    evaluateRow(index, inVertex.getCoords(), rowPositions, rowValues);
+    for (size_t k = 0; k < rowPositions.size(); k++) {
+      colIdxC.push_back(inColumns[rowPositions[k]]);
+      colValsC.push_back(rowValues[k]);
+      PetscInt col = inPetscColumns[rowPositions[k]];
+      if (col > row) {
+        if (col < ownerRangeCEnd)
+          diagNnzC[row - ownerRangeCBegin]++;
+        else
+          offDiagNnzC[row - ownerRangeCBegin]++;
+      }
+    }
+    rowBeginC.push_back(colIdxC.size());
+  }
+  ePreallocC.stop();
+  PetscLogEventEnd(logPreallocCLoop, 0, 0, 0, 0);
+  // -- END PREALLOC LOOP FOR MATRIX C --
+
+  ierr = MatSeqSBAIJSetPreallocation(_matrixC, 1, 0, diagNnzC.data()); CHKERRV(ierr);
+  ierr = MatMPISBAIJSetPreallocation(_matrixC, 1, 0, diagNnzC.data(), 0, offDiagNnzC.data()); CHKERRV(ierr);
+  // A miscounted entry costs a malloc only, the number of mallocs is reported below.
+  ierr = MatSetOption(_matrixC, MAT_NEW_NONZERO_ALLOCATION_ERR, PETSC_FALSE); CHKERRV(ierr);
   
   // -- BEGIN FILL LOOP FOR MATRIX C --
   int logCLoop = 2;
   PetscLogEventRegister("Filling Matrix C", 0, &logCLoop);
   PetscLogEventBegin(logCLoop, 0, 0, 0, 0);
-  precice::utils::Event eFillC("PetRBF.fillC");
-  // We collect entries for each row and set them blockwise using MatSetValues.
+  static const int eFillCID = precice::utils::EventRegistry::getID("PetRBF.fillC");
+  precice::utils::Event eFillC(eFillCID);
+  // We set the stored entries for each row blockwise using MatSetValues.
+  int ownedRow = 0;
   for (const mesh::Vertex& inVertex : inMesh->vertices()) {
     if (not inVertex.isOwner())
       continue;
 
     int row = inVertex.getGlobalIndex() + polyparams;
-    PetscInt colIdx[_matrixC.getSize().second];     // holds the columns indices of the entries
-    PetscScalar colVals[_matrixC.getSize().second]; // holds the values of the entries
     
     // -- SETS THE POLYNOM PART OF THE MATRIX --
     if (_polynomial == Polynomial::ON or _polynomial == Polynomial::SEPARATE) {
@@ -397,23 +459,10 @@ void PetRadialBasisFctMapping<RADIAL_BASIS_FUNCTION_T>::computeMapping()
     }
 
     // -- SETS THE COEFFICIENTS --
-    PetscInt colNum = 0;  // holds the number of columns
-    for (mesh::Vertex& vj : inMesh->vertices()) {
-      distance = inVertex.getCoords() - vj.getCoords();
-      for (int d = 0; d < dimensions; d++) {
-        if (_deadAxis[d]) {
-          distance[d] = 0;
-        }
-      }
-      double coeff = _basisFunction.evaluate(distance.norm());
-      if (not math::equals(coeff, 0.0)) {
-        colVals[colNum] = coeff;
-        colIdx[colNum] = vj.getGlobalIndex() + polyparams; // column of entry is the globalIndex
-        colNum++;
-      }
-    }
-
-    ierr = MatSetValuesLocal(_matrixC, 1, &row, colNum, colIdx, colVals, INSERT_VALUES); CHKERRV(ierr);
+    PetscInt colNum = rowBeginC[ownedRow + 1] - rowBeginC[ownedRow];
+    ierr = MatSetValuesLocal(_matrixC, 1, &row, colNum, colIdxC.data() + rowBeginC[ownedRow],
+                             colValsC.data() + rowBeginC[ownedRow], INSERT_VALUES); CHKERRV(ierr);
+    ownedRow++;
   }
   DEBUG("Finished filling Matrix C");
   eFillC.stop();
@@ -430,62 +479,62 @@ void PetRadialBasisFctMapping<RADIAL_BASIS_FUNCTION_T>::computeMapping()
   ierr = MatAssemblyBegin(_matrixQ, MAT_FINAL_ASSEMBLY); CHKERRV(ierr);
   
   // -- BEGIN PREALLOC LOOP FOR MATRIX A --
-  // {
-  //   int localDiagColBegin = _matrixA.ownerRangeColumn().first;
-  //   int localDiagColEnd = _matrixA.ownerRangeColumn().second;
-  //   DEBUG("Local Submatrix Rows = " << ownerRangeABegin << " / " << ownerRangeAEnd <<
-  //                ", Local Submatrix Cols = " << localDiagColBegin << " / " << localDiagColEnd);
-
-  //   DEBUG("Begin preallocation matrix A.");
-  //   int logPreallocALoop = 3;
-  //   PetscLogEventRegister("Prealloc Matrix A", 0, &logPreallocALoop);
-  //   PetscLogEventBegin(logPreallocALoop, 0, 0, 0, 0);
-  //   PetscInt nnzA[outputSize]; // Number of non-zero entries, off-diagonal
-  //   PetscInt DnnzA[outputSize]; // Number of non-zero entries, diagonal
-  //   for (int i = 0; i < ownerRangeAEnd - ownerRangeABegin; i++) {
-  //     nnzA[i] = 0; DnnzA[i] = 0;
-  //     int polyCol = 1;
-  //     for (int dim = 0; dim < dimensions; dim++) {
-  //       if (not _deadAxis[dim]) {
-  //         incPrealloc(nnzA, DnnzA, polyCol, localDiagColBegin, localDiagColEnd);
-  //         ++polyCol;
-  //       }
-  //     }
-  //     const mesh::Vertex& oVertex = outMesh->vertices()[i];
-  //     for (const mesh::Vertex& inVertex : inMesh->vertices()) {
-  //       distance = oVertex.getCoords() - inVertex.getCoords();
-  //       for (int d = 0; d < dimensions; d++) {
-  //         if (_deadAxis[d])
-  //           distance[d] = 0;
-  //       }
-  //       double coeff = _basisFunction.evaluate(norm2(distance));
-  //       if (not tarch::la::equals(coeff, 0.0)) {
-  //         const int colPosition = inVertex.getGlobalIndex() + polyparams;
-  //         incPrealloc(nnzA, DnnzA, colPosition, localDiagColBegin, localDiagColEnd);
-  //       }
-  //       DEBUG("Preallocating     diagonal row " << i << " with " << DnnzA[i] << " elements.");
-  //       DEBUG("Preallocating off-diagonal row " << i << " with " << nnzA[i] << " elements.");
-  //     }
-  //   }
-  //   // -- END PREALLOC LOOP FOR MATRIX A --
-
-  //   // Preallocation: Number of diagonal non-zero entries equals outputSize, since diagonal is full
-  //   MatSetOption(_matrixA, MAT_NEW_NONZERO_ALLOCATION_ERR, PETSC_FALSE);
-  //   ierr = MatMPIAIJSetPreallocation(_matrixA, 0, DnnzA, 0, nnzA); CHKERRV(ierr);
-  // }
+  DEBUG("Begin preallocation matrix A.");
+  int logPreallocALoop = 3;
+  PetscLogEventRegister("Prealloc Matrix A", 0, &logPreallocALoop);
+  PetscLogEventBegin(logPreallocALoop, 0, 0, 0, 0);
+  static const int ePreallocAID = precice::utils::EventRegistry::getID("PetRBF.preallocA");
+  precice::utils::Event ePreallocA(ePreallocAID);
+  const PetscInt localDiagColBegin = _matrixA.ownerRangeColumn().first;
+  const PetscInt localDiagColEnd = _matrixA.ownerRangeColumn().second;
+  DEBUG("Local Submatrix Rows = " << ownerRangeABegin << " / " << ownerRangeAEnd <<
+        ", Local Submatrix Cols = " << localDiagColBegin << " / " << localDiagColEnd);
+  std::vector<PetscInt> diagNnzA(outputSize, 0), offDiagNnzA(outputSize, 0);
+  std::vector<size_t> rowBeginA(1, 0);
+  std::vector<PetscInt> colIdxA;
+  std::vector<PetscScalar> colValsA;
+  for (size_t i = 0; i < outputSize; i++) {
+    if (_polynomial == Polynomial::ON) {
+      // polyparams reside in the first columns (which are always on rank 0)
+      for (PetscInt polyCol = 0; polyCol < static_cast<PetscInt>(polyparams); polyCol++) {
+        if ((polyCol >= localDiagColBegin) and (polyCol < localDiagColEnd))
+          diagNnzA[i]++;
+        else
+          offDiagNnzA[i]++;
+      }
+    }
+
+    evaluateRow(index, outMesh->vertices()[i].getCoords(), rowPositions, rowValues);
+    for (size_t k = 0; k < rowPositions.size(); k++) {
+      colIdxA.push_back(inColumns[rowPositions[k]]);
+      colValsA.push_back(rowValues[k]);
+      PetscInt col = inPetscColumns[rowPositions[k]];
+      if ((col >= localDiagColBegin) and (col < localDiagColEnd))
+        diagNnzA[i]++;
+      else
+        offDiagNnzA[i]++;
+    }
+    rowBeginA.push_back(colIdxA.size());
+  }
+  ePreallocA.stop();
+  PetscLogEventEnd(logPreallocALoop, 0, 0, 0, 0);
+  // -- END PREALLOC LOOP FOR MATRIX A --
+
+  ierr = MatSeqAIJSetPreallocation(_matrixA, 0, diagNnzA.data()); CHKERRV(ierr);
+  ierr = MatMPIAIJSetPreallocation(_matrixA, 0, diagNnzA.data(), 0, offDiagNnzA.data()); CHKERRV(ierr);
+  ierr = MatSetOption(_matrixA, MAT_NEW_NONZERO_ALLOCATION_ERR, PETSC_FALSE); CHKERRV(ierr);
   
   // -- BEGIN FILL LOOP FOR MATRIX A --
   DEBUG("Begin filling matrix A.");
   int logALoop = 4;
   PetscLogEventRegister("Filling Matrix A", 0, &logALoop);
   PetscLogEventBegin(logALoop, 0, 0, 0, 0);
-  precice::utils::Event eFillA("PetRBF.fillA");
+  static const int eFillAID = precice::utils::EventRegistry::getID("PetRBF.fillA");
+  precice::utils::Event eFillA(eFillAID);
 
   for (int it = ownerRangeABegin; it < ownerRangeAEnd; it++) {
-    PetscInt colNum = 0;
-    PetscInt colIdx[_matrixA.getSize().second];     // holds the columns indices of the entries
-    PetscScalar colVals[_matrixA.getSize().second]; // holds the values of the entries
-    const mesh::Vertex& oVertex = outMesh->vertices()[it - _matrixA.ownerRange().first];
+    const int localRow = it - ownerRangeABegin;
+    const mesh::Vertex& oVertex = outMesh->vertices()[localRow];
 
     // -- SET THE POLYNOM PART OF THE MATRIX --
     if (_polynomial == Polynomial::ON or _polynomial == Polynomial::SEPARATE) {
@@ -509,21 +558,10 @@ void PetRadialBasisFctMapping<RADIAL_BASIS_FUNCTION_T>::computeMapping()
     }
 
     // -- SETS THE COEFFICIENTS --
-    for (const mesh::Vertex& inVertex : inMesh->vertices()) {
-      distance = oVertex.getCoords() - inVertex.getCoords();
-      for (int d = 0; d < dimensions; d++) {
-        if (_deadAxis[d])
-          distance[d] = 0;
-      }
-      double coeff = _basisFunction.evaluate(distance.norm());
-      if (not math::equals(coeff, 0.0)) {
-        colVals[colNum] = coeff;
-        colIdx[colNum] = inVertex.getGlobalIndex() + polyparams;
-        colNum++;
-      }
-    }
+    PetscInt colNum = rowBeginA[localRow + 1] - rowBeginA[localRow];
     // DEBUG("Filling A: row = " << it << ", col count = " << colNum);
-    ierr = MatSetValuesLocal(_matrixA, 1, &it, colNum, colIdx, colVals, INSERT_VALUES); CHKERRV(ierr);
+    ierr = MatSetValuesLocal(_matrixA, 1, &it, colNum, colIdxA.data() + rowBeginA[localRow],
+                             colValsA.data() + rowBeginA[localRow], INSERT_VALUES); CHKERRV(ierr);
   }
   DEBUG("Finished filling Matrix A");
   eFillA.stop();
@@ -592,14 +630,14 @@ template<typename RADIAL_BASIS_FUNCTION_T>
 void PetRadialBasisFctMapping<RADIAL_BASIS_FUNCTION_T>::map(int inputDataID, int outputDataID)
 {
   TRACE(inputDataID, outputDataID);
-  precice::utils::Event e(__func__);
+  static const int eventID = precice::utils::EventRegistry::getID(__func__);
+  precice::utils::Event e(eventID);
   
   assertion(_hasComputedMapping);
   assertion(input()->getDimensions() == output()->getDimensions(),
             input()->getDimensions(), output()->getDimensions());
 
   PetscErrorCode ierr = 0;
-  KSPConvergedReason convReason;
   auto& inValues = input()->data(inputDataID)->values();
   auto& outValues = output()->data(outputDataID)->values();
 
@@ -609,8 +647,11 @@ void PetRadialBasisFctMapping<RADIAL_BASIS_FUNCTION_T>::map(int inputDataID, int
 
   int localPolyparams = utils::Parallel::getProcessRank() > 0 ? 0 : polyparams; // Set localPolyparams only when root rank
 
+  // Right hand sides and solutions of all components, such that all components are solved at once
+  std::deque<petsc::Vector> rhsVectors;
+  std::vector<Vec> rhs, solutions;
+
   if (getConstraint() == CONSERVATIVE) {
-    petsc::Vector au(_matrixA, "au", petsc::Vector::RIGHT);
     petsc::Vector in(_matrixA, "in");
     
     // Fill input from input data values
@@ -623,6 +664,10 @@ void PetRadialBasisFctMapping<RADIAL_BASIS_FUNCTION_T>::map(int inputDataID, int
       }
       in.assemble();
 
+      rhsVectors.emplace_back(_matrixA, "au", petsc::Vector::RIGHT);
+      ierr = MatMultTranspose(_matrixA, in, rhsVectors.back()); CHKERRV(ierr);
+      rhs.push_back(rhsVectors.back());
+
       // Gets the petsc::vector for the given combination of outputData, inputData and dimension
       // If none created yet, create one, based on _matrixC
       petsc::Vector& out = std::get<0>(
@@ -630,27 +675,17 @@ void PetRadialBasisFctMapping<RADIAL_BASIS_FUNCTION_T>::map(int inputDataID, int
                                  std::forward_as_tuple(inputDataID + outputDataID * 10 + dim * 100),
                                  std::forward_as_tuple(_matrixC, "out"))
         )->second;
-      
-      ierr = MatMultTranspose(_matrixA, in, au); CHKERRV(ierr);
-      utils::Event eSolve("PetRBF.solve.conservative");
-      ierr = KSPSolve(_solver, au, out); CHKERRV(ierr);
-      eSolve.stop();
-      
-      PetscInt iterations;
-      KSPGetIterationNumber(_solver, &iterations);
-      utils::EventRegistry::setProp("PetRBF.its.conservative", iterations);
-      
-      ierr = KSPGetConvergedReason(_solver, &convReason); CHKERRV(ierr);
-      if (convReason < 0) {
-        KSPView(_solver, PETSC_VIEWER_STDOUT_WORLD);
-        ERROR("RBF linear system has not converged.");
-      }
-            
-      VecChop(out, 1e-9);
+      solutions.push_back(out);
+    }
+
+    solve(rhs, solutions, "conservative");
+
+    for (int dim = 0; dim < valueDim; dim++) {
+      VecChop(solutions[dim], 1e-9);
 
       // Copy mapped data to output data values
       const PetscScalar *outArray;
-      VecGetArrayRead(out, &outArray);
+      VecGetArrayRead(solutions[dim], &outArray);
 
       int count = 0, ownerCount = 0;
       for (const mesh::Vertex& vertex : output()->vertices()) {
@@ -663,33 +698,41 @@ void PetRadialBasisFctMapping<RADIAL_BASIS_FUNCTION_T>::map(int inputDataID, int
         }
         count++;
       }
-      VecRestoreArrayRead(out, &outArray);
+      VecRestoreArrayRead(solutions[dim], &outArray);
     }
   }
   else { // Map CONSISTENT
     petsc::Vector out(_matrixA, "out");
-    petsc::Vector in(_matrixC, "in");
-    petsc::Vector a(_matrixQ, "a", petsc::Vector::RIGHT); // holds the solution of the LS polynom
-        
-    ierr = VecSetLocalToGlobalMapping(in, _ISmapping); CHKERRV(ierr);
+    std::deque<petsc::Vector> polynomials; // hold the solutions of the LS polynom
     const PetscScalar *vecArray;
 
-    // For every data dimension, perform mapping
+    // Fill input from input data values, assemble all components at once
     for (int dim=0; dim < valueDim; dim++) {
       printMappingInfo(inputDataID, dim);
-      
-      // Fill input from input data values
-      int count = 0;
-      for (const auto& vertex : input()->vertices()) {
-        ierr = VecSetValueLocal(in, vertex.getGlobalIndex()+polyparams, inValues[count*valueDim + dim], INSERT_VALUES); CHKERRV(ierr); // evtl. besser als VecSetValuesLocal
-        count++;
+      rhsVectors.emplace_back(_matrixC, "in");
+      ierr = VecSetLocalToGlobalMapping(rhsVectors.back(), _ISmapping); CHKERRV(ierr);
+      rhs.push_back(rhsVectors.back());
+    }
+    int count = 0;
+    for (const auto& vertex : input()->vertices()) {
+      for (int dim=0; dim < valueDim; dim++) {
+        ierr = VecSetValueLocal(rhs[dim], vertex.getGlobalIndex()+polyparams, inValues[count*valueDim + dim], INSERT_VALUES); CHKERRV(ierr); // evtl. besser als VecSetValuesLocal
       }
-      in.assemble();
-            
+      count++;
+    }
+    for (Vec in : rhs) {
+      ierr = VecAssemblyBegin(in); CHKERRV(ierr);
+    }
+    for (Vec in : rhs) {
+      ierr = VecAssemblyEnd(in); CHKERRV(ierr);
+    }
+
+    for (int dim=0; dim < valueDim; dim++) {
       if (_polynomial == Polynomial::SEPARATE) {
-        KSPSolve(_QRsolver, in, a);
-        VecScale(a, -1);
-        MatMultAdd(_matrixQ, a, in, in); // Subtract the polynomial from the input values
+        polynomials.emplace_back(_matrixQ, "a", petsc::Vector::RIGHT);
+        KSPSolve(_QRsolver, rhs[dim], polynomials.back());
+        VecScale(polynomials.back(), -1);
+        MatMultAdd(_matrixQ, polynomials.back(), rhs[dim], rhs[dim]); // Subtract the polynomial from the input values
       }
       
       petsc::Vector& p = std::get<0>(  // Save and reuse the solution from the previous iteration
@@ -697,25 +740,16 @@ void PetRadialBasisFctMapping<RADIAL_BASIS_FUNCTION_T>::map(int inputDataID, int
                                  std::forward_as_tuple(inputDataID + outputDataID * 10 + dim * 100),
                                  std::forward_as_tuple(_matrixC, "p"))
         )->second;
+      solutions.push_back(p);
+    }
 
-      utils::Event eSolve("PetRBF.solve.consistent");
-      ierr = KSPSolve(_solver, in, p); CHKERRV(ierr);
-      eSolve.stop();
-            
-      PetscInt iterations;
-      KSPGetIterationNumber(_solver, &iterations);
-      utils::EventRegistry::setProp("PetRBF.its.consistent", iterations);
-
-      ierr = KSPGetConvergedReason(_solver, &convReason); CHKERRV(ierr);
-      if (convReason < 0) {
-        KSPView(_solver, PETSC_VIEWER_STDOUT_WORLD);
-        ERROR("RBF linear system has not converged.");
-      }
+    solve(rhs, solutions, "consistent");
 
-      ierr = MatMult(_matrixA, p, out); CHKERRV(ierr);
+    for (int dim=0; dim < valueDim; dim++) {
+      ierr = MatMult(_matrixA, solutions[dim], out); CHKERRV(ierr);
       if (_polynomial == Polynomial::SEPARATE) {
-        ierr = VecScale(a, -1); // scale it back, so wie add the polynom
-        ierr = MatMultAdd(_matrixV, a, out, out); CHKERRV(ierr);
+        ierr = VecScale(polynomials[dim], -1); // scale it back, so wie add the polynom
+        ierr = MatMultAdd(_matrixV, polynomials[dim], out, out); CHKERRV(ierr);
       }
       VecChop(out, 1e-9);
       
@@ -730,6 +764,88 @@ void PetRadialBasisFctMapping<RADIAL_BASIS_FUNCTION_T>::map(int inputDataID, int
   }
 }
 
+template<typename RADIAL_BASIS_FUNCTION_T>
+void PetRadialBasisFctMapping<RADIAL_BASIS_FUNCTION_T>::solve
+(
+  std::vector<Vec>&  rhs,
+  std::vector<Vec>&  solutions,
+  const std::string& constraintName)
+{
+  assertion(rhs.size() == solutions.size(), rhs.size(), solutions.size());
+  PetscErrorCode ierr = 0;
+  KSPConvergedReason convReason;
+  PetscInt iterations = 0;
+  utils::Event eSolve("PetRBF.solve." + constraintName);
+
+# if PETSC_VERSION_GE(3,14,0)
+  if (rhs.size() > 1) {
+    // Solves all components as columns of dense matrices, which is a block Krylov solve for
+    // block methods (e.g. -ksp_type hpddm) and reuses the setup of the solver otherwise.
+    PetscInt localRows, globalRows;
+    Mat B, X;
+    Vec column;
+    ierr = VecGetLocalSize(rhs[0], &localRows); CHKERRV(ierr);
+    ierr = VecGetSize(rhs[0], &globalRows); CHKERRV(ierr);
+    ierr = MatCreateDense(PETSC_COMM_WORLD, localRows, PETSC_DECIDE, globalRows, rhs.size(), nullptr, &B); CHKERRV(ierr);
+    ierr = MatDuplicate(B, MAT_DO_NOT_COPY_VALUES, &X); CHKERRV(ierr);
+    for (size_t i = 0; i < rhs.size(); i++) {
+      ierr = MatDenseGetColumnVecWrite(B, i, &column); CHKERRV(ierr);
+      ierr = VecCopy(rhs[i], column); CHKERRV(ierr);
+      ierr = MatDenseRestoreColumnVecWrite(B, i, &column); CHKERRV(ierr);
+      ierr = MatDenseGetColumnVecWrite(X, i, &column); CHKERRV(ierr);
+      ierr = VecCopy(solutions[i], column); CHKERRV(ierr); // Initial guess from the previous solution
+      ierr = MatDenseRestoreColumnVecWrite(X, i, &column); CHKERRV(ierr);
+    }
+    _solverIterations = 0;
+    ierr = KSPMatSolve(_solver, B, X); CHKERRV(ierr);
+    iterations = _solverIterations;
+    for (size_t i = 0; i < solutions.size(); i++) {
+      ierr = MatDenseGetColumnVecRead(X, i, &column); CHKERRV(ierr);
+      ierr = VecCopy(column, solutions[i]); CHKERRV(ierr);
+      ierr = MatDenseRestoreColumnVecRead(X, i, &column); CHKERRV(ierr);
+    }
+    ierr = MatDestroy(&B); CHKERRV(ierr);
+    ierr = MatDestroy(&X); CHKERRV(ierr);
+    ierr = KSPGetConvergedReason(_solver, &convReason); CHKERRV(ierr);
+    if (convReason < 0) {
+      KSPView(_solver, PETSC_VIEWER_STDOUT_WORLD);
+      ERROR("RBF linear system has not converged.");
+    }
+  }
+  else
+# endif
+  {
+    // Solves the components one after the other, all solves reuse the setup of the solver
+    for (size_t i = 0; i < rhs.size(); i++) {
+      ierr = KSPSolve(_solver, rhs[i], solutions[i]); CHKERRV(ierr);
+      PetscInt componentIterations;
+      KSPGetIterationNumber(_solver, &componentIterations);
+      iterations += componentIterations;
+      ierr = KSPGetConvergedReason(_solver, &convReason); CHKERRV(ierr);
+      if (convReason < 0) {
+        KSPView(_solver, PETSC_VIEWER_STDOUT_WORLD);
+        ERROR("RBF linear system has not converged.");
+      }
+    }
+  }
+  eSolve.stop();
+  utils::EventRegistry::setProp("PetRBF.its." + constraintName, iterations);
+}
+
+template<typename RADIAL_BASIS_FUNCTION_T>
+PetscErrorCode PetRadialBasisFctMapping<RADIAL_BASIS_FUNCTION_T>::countIterations
+(
+  KSP       ksp,
+  PetscInt  iteration,
+  PetscReal residualNorm,
+  void*     iterations)
+{
+  // The monitor is also called before the first iteration of each solve
+  if (iteration > 0) {
+    *static_cast<PetscInt*>(iterations) += 1;
+  }
+  return 0;
+}
 
 template<typename RADIAL_BASIS_FUNCTION_T>
 bool PetRadialBasisFctMapping<RADIAL_BASIS_FUNCTION_T>::doesVertexContribute(int vertexID) const
@@ -756,13 +872,47 @@ void PetRadialBasisFctMapping<RADIAL_BASIS_FUNCTION_T>::printMappingInfo(int inp
 }
 
 template<typename RADIAL_BASIS_FUNCTION_T>
-void PetRadialBasisFctMapping<RADIAL_BASIS_FUNCTION_T>::incPrealloc(PetscInt* diag, PetscInt* offDiag, int pos, int begin, int end)
+void PetRadialBasisFctMapping<RADIAL_BASIS_FUNCTION_T>::evaluateRow
+(
+  query::VertexIndex&       index,
+  const Eigen::VectorXd&    point,
+  std::vector<int>&         positions,
+  std::vector<PetscScalar>& values) const
 {
-  // Do some optimizatin here: inline, const, ...
-  if ((pos < begin) or (pos > end))
-    (*offDiag)++; // vertex is off-diagonal
-  else
-    (*diag)++; // vertex is diagonal
+  const mesh::Mesh::VertexContainer& vertices = index.getMesh()->vertices();
+  const int dimensions = index.getMesh()->getDimensions();
+  bool hasDeadAxis = false;
+  for (int d = 0; d < dimensions; d++)
+    hasDeadAxis |= _deadAxis[d];
+
+  // The radius search uses the full distance, which is larger than the distance with dead axes
+  positions.clear();
+  values.clear();
+  double supportRadius = _basisFunction.getSupportRadius();
+  if ((supportRadius < std::numeric_limits<double>::max()) and (not hasDeadAxis)) {
+    index.getVerticesInRadius(point, supportRadius, positions);
+  }
+  else {
+    positions.resize(vertices.size());
+    std::iota(positions.begin(), positions.end(), 0);
+  }
+
+  size_t count = 0;
+  Eigen::VectorXd distance(dimensions);
+  for (int position : positions) {
+    distance = point - vertices[position].getCoords();
+    for (int d = 0; d < dimensions; d++) {
+      if (_deadAxis[d])
+        distance[d] = 0;
+    }
+    double coeff = _basisFunction.evaluate(distance.norm());
+    if (not math::equals(coeff, 0.0)) {
+      positions[count] = position;
+      values.push_back(coeff);
+      count++;
+    }
+  }
+  positions.resize(count);
 }
 
 }} // namespace precice, mapping
@@ -4,9 +4,15 @@
 #include "impl/BasisFunctions.hpp"
 #include "utils/MasterSlave.hpp"
 #include "io/TXTWriter.hpp"
+#include "math/math.hpp"
+#include "query/VertexIndex.hpp"
 
 #include <Eigen/Core>
 #include <Eigen/QR>
+#include <Eigen/SparseCore>
+#include <Eigen/SparseLU>
+#include <numeric>
+#include <vector>
 
 namespace precice {
 namespace mapping {
@@ -21,6 +27,10 @@ namespace mapping {
  *
  * The radial basis function type has to be given as template parameter, and has
  * to be one of the defined types in this file.
+ *
+ * For basis functions with compact support, the matrices are assembled sparse from
+ * the vertices within the support radius and the interpolation system is solved by a
+ * sparse LU decomposition. Otherwise, dense matrices and a QR decomposition are used.
  */
 template<typename RADIAL_BASIS_FUNCTION_T>
 class RadialBasisFctMapping : public Mapping
@@ -70,12 +80,44 @@ private:
   Eigen::MatrixXd _matrixA;
 
   Eigen::ColPivHouseholderQR<Eigen::MatrixXd> _qr;
+
+  /// Evaluation matrix A for basis functions with compact support.
+  Eigen::SparseMatrix<double> _sparseMatrixA;
+
+  /// Decomposition of the interpolation matrix C for basis functions with compact support.
+  Eigen::SparseLU<Eigen::SparseMatrix<double>> _sparseLU;
   
   /// true if the mapping along some axis should be ignored
   bool* _deadAxis;
 
   /// Deletes all dead directions from fullVector and returns a vector of reduced dimensionality.
   Eigen::VectorXd reduceVector(const Eigen::VectorXd& fullVector);
+
+  /// Assembles sparse matrices C and A and decomposes C, for basis functions with compact support.
+  void computeSparseMapping(const mesh::PtrMesh& inMesh, const mesh::PtrMesh& outMesh);
+
+  /**
+   * @brief Appends the triplets of the nonzero basis function values between point and the input vertices.
+   *
+   * If no axis is dead, only the vertices within the support radius are evaluated.
+   */
+  void addSparseRow(query::VertexIndex&                  index,
+                    int                                  row,
+                    const Eigen::VectorXd&               point,
+                    std::vector<int>&                    candidates,
+                    std::vector<Eigen::Triplet<double>>& triplets);
+
+  /// Returns the size of the input vector of the interpolation, including the polynomial.
+  int getInterpolationSize() const;
+
+  /// Returns A * p, for the dense or sparse matrix A.
+  Eigen::VectorXd multiplyA(const Eigen::VectorXd& p) const;
+
+  /// Returns A^T * in, for the dense or sparse matrix A.
+  Eigen::VectorXd multiplyTransposedA(const Eigen::VectorXd& in) const;
+
+  /// Returns the solution of the interpolation system C * p = in.
+  Eigen::VectorXd solveC(const Eigen::VectorXd& in);
   
   void setDeadAxis(bool xDead, bool yDead, bool zDead)
   {
@@ -162,6 +204,13 @@ void RadialBasisFctMapping<RADIAL_BASIS_FUNCTION_T>:: computeMapping()
   }
   int polyparams = 1 + dimensions - deadDimensions;
   assertion(inputSize >= 1 + polyparams, inputSize);
+
+  if (_basisFunction.hasCompactSupport()) {
+    computeSparseMapping(inMesh, outMesh);
+    _hasComputedMapping = true;
+    return;
+  }
+
   int n = inputSize + polyparams; // Add linear polynom degrees
   Eigen::MatrixXd matrixCLU(n, n);
   matrixCLU.setZero();
@@ -248,6 +297,7 @@ void RadialBasisFctMapping<RADIAL_BASIS_FUNCTION_T>:: clear()
   TRACE();
   _matrixA = Eigen::MatrixXd();
   _qr = Eigen::ColPivHouseholderQR<Eigen::MatrixXd>();
+  _sparseMatrixA = Eigen::SparseMatrix<double>();
   _hasComputedMapping = false;
 }
 
@@ -278,12 +328,12 @@ void RadialBasisFctMapping<RADIAL_BASIS_FUNCTION_T>:: map
   if (getConstraint() == CONSERVATIVE){
     DEBUG("Map conservative");
     static int mappingIndex = 0;
-    Eigen::VectorXd Au(_matrixA.cols());  // rows == n
-    Eigen::VectorXd in(_matrixA.rows());  // rows == outputSize
-    Eigen::VectorXd out(_matrixA.cols()); // rows == n
+    Eigen::VectorXd Au(getInterpolationSize());  // rows == n
+    Eigen::VectorXd in(input()->vertices().size());  // rows == outputSize
+    Eigen::VectorXd out(getInterpolationSize()); // rows == n
 
     // DEBUG("C rows=" << _matrixCLU.rows() << " cols=" << _matrixCLU.cols());
-    DEBUG("A rows=" << _matrixA.rows() << " cols=" << _matrixA.cols());
+    DEBUG("A rows=" << in.size() << " cols=" << Au.size());
     DEBUG("in size=" << in.size() << ", out size=" << out.size());
 
     for (int dim = 0; dim < valueDim; dim++) {
@@ -296,8 +346,8 @@ void RadialBasisFctMapping<RADIAL_BASIS_FUNCTION_T>:: map
       io::TXTWriter::write(in, stream.str());
 #     endif
 
-      Au = _matrixA.transpose() * in;
-      out = _qr.solve(Au);
+      Au = multiplyTransposedA(in);
+      out = solveC(Au);
 
       // Copy mapped data to output data values
 #     ifdef PRECICE_STATISTICS
@@ -313,9 +363,9 @@ void RadialBasisFctMapping<RADIAL_BASIS_FUNCTION_T>:: map
   }
   else { // Map consistent
     DEBUG("Map consistent");
-    Eigen::VectorXd p(_matrixA.cols());    // rows == n
-    Eigen::VectorXd in(_matrixA.cols());   // rows == n
-    Eigen::VectorXd out(_matrixA.rows());  // rows == outputSize
+    Eigen::VectorXd p(getInterpolationSize());    // rows == n
+    Eigen::VectorXd in(getInterpolationSize());   // rows == n
+    Eigen::VectorXd out(output()->vertices().size());  // rows == outputSize
     in.setZero();
 
     // For every data dimension, perform mapping
@@ -325,8 +375,8 @@ void RadialBasisFctMapping<RADIAL_BASIS_FUNCTION_T>:: map
         in[i] = inValues(i*valueDim + dim);
       }
 
-      p = _qr.solve(in);
-      out = _matrixA * p;
+      p = solveC(in);
+      out = multiplyA(p);
 
       // Copy mapped data to ouptut data values
       for (int i = 0; i < out.size(); i++) {
@@ -359,5 +409,129 @@ Eigen::VectorXd RadialBasisFctMapping<RADIAL_BASIS_FUNCTION_T>::reduceVector
   return reducedVector;
 }
 
+template<typename RADIAL_BASIS_FUNCTION_T>
+void RadialBasisFctMapping<RADIAL_BASIS_FUNCTION_T>::computeSparseMapping
+(
+  const mesh::PtrMesh& inMesh,
+  const mesh::PtrMesh& outMesh)
+{
+  TRACE();
+  int inputSize = (int)inMesh->vertices().size();
+  int outputSize = (int)outMesh->vertices().size();
+  int reducedDimensions = reduceVector(inMesh->vertices()[0].getCoords()).size();
+  int n = inputSize + 1 + reducedDimensions; // Add linear polynom degrees
+
+  query::VertexIndex index(inMesh);
+  std::vector<int> candidates;
+  std::vector<Eigen::Triplet<double>> triplets;
+
+  // Fill matrix C with values, the polynom is stored symmetrically in the last rows and columns
+  for (int i = 0; i < inputSize; i++) {
+    mesh::Vertex::ConstVectorMap coords = inMesh->vertices()[i].getCoords();
+    addSparseRow(index, i, coords, candidates, triplets);
+    Eigen::VectorXd reducedCoords = reduceVector(coords);
+    triplets.emplace_back(i, inputSize, 1.0);
+    triplets.emplace_back(inputSize, i, 1.0);
+    for (int dim = 0; dim < reducedDimensions; dim++) {
+      triplets.emplace_back(i, inputSize+1+dim, reducedCoords[dim]);
+      triplets.emplace_back(inputSize+1+dim, i, reducedCoords[dim]);
+    }
+  }
+  Eigen::SparseMatrix<double> matrixC(n, n);
+  matrixC.setFromTriplets(triplets.begin(), triplets.end());
+  DEBUG("Matrix C has " << matrixC.nonZeros() << " non-zeros");
+
+  // Fill _sparseMatrixA with values
+  triplets.clear();
+  for (int i = 0; i < outputSize; i++) {
+    mesh::Vertex::ConstVectorMap coords = outMesh->vertices()[i].getCoords();
+    addSparseRow(index, i, coords, candidates, triplets);
+    Eigen::VectorXd reducedCoords = reduceVector(coords);
+    triplets.emplace_back(i, inputSize, 1.0);
+    for (int dim = 0; dim < reducedDimensions; dim++) {
+      triplets.emplace_back(i, inputSize+1+dim, reducedCoords[dim]);
+    }
+  }
+  _sparseMatrixA = Eigen::SparseMatrix<double>(outputSize, n);
+  _sparseMatrixA.setFromTriplets(triplets.begin(), triplets.end());
+  DEBUG("Matrix A has " << _sparseMatrixA.nonZeros() << " non-zeros");
+
+  // The polynom makes C indefinite, hence LU instead of a Cholesky decomposition
+  _sparseLU.compute(matrixC);
+  if (_sparseLU.info() != Eigen::Success)
+    ERROR("Interpolation matrix C is not invertible.");
+}
+
+template<typename RADIAL_BASIS_FUNCTION_T>
+void RadialBasisFctMapping<RADIAL_BASIS_FUNCTION_T>::addSparseRow
+(
+  query::VertexIndex&                  index,
+  int                                  row,
+  const Eigen::VectorXd&               point,
+  std::vector<int>&                    candidates,
+  std::vector<Eigen::Triplet<double>>& triplets)
+{
+  const mesh::Mesh::VertexContainer& vertices = index.getMesh()->vertices();
+  bool hasDeadAxis = false;
+  for (int d = 0; d < getDimensions(); d++)
+    hasDeadAxis |= _deadAxis[d];
+
+  // The radius search uses the full distance, which is larger than the distance with dead axes
+  candidates.clear();
+  if (hasDeadAxis) {
+    candidates.resize(vertices.size());
+    std::iota(candidates.begin(), candidates.end(), 0);
+  }
+  else {
+    index.getVerticesInRadius(point, _basisFunction.getSupportRadius(), candidates);
+  }
+
+  Eigen::VectorXd difference(point.size());
+  for (int j : candidates) {
+    difference = point;
+    difference -= vertices[j].getCoords();
+    double value = _basisFunction.evaluate(reduceVector(difference).norm());
+    if (not math::equals(value, 0.0))
+      triplets.emplace_back(row, j, value);
+  }
+}
+
+template<typename RADIAL_BASIS_FUNCTION_T>
+int RadialBasisFctMapping<RADIAL_BASIS_FUNCTION_T>::getInterpolationSize() const
+{
+  if (_basisFunction.hasCompactSupport())
+    return _sparseMatrixA.cols();
+  return _matrixA.cols();
+}
+
+template<typename RADIAL_BASIS_FUNCTION_T>
+Eigen::VectorXd RadialBasisFctMapping<RADIAL_BASIS_FUNCTION_T>::multiplyA
+(
+  const Eigen::VectorXd& p) const
+{
+  if (_basisFunction.hasCompactSupport())
+    return _sparseMatrixA * p;
+  return _matrixA * p;
+}
+
+template<typename RADIAL_BASIS_FUNCTION_T>
+Eigen::VectorXd RadialBasisFctMapping<RADIAL_BASIS_FUNCTION_T>::multiplyTransposedA
+(
+  const Eigen::VectorXd& in) const
+{
+  if (_basisFunction.hasCompactSupport())
+    return _sparseMatrixA.transpose() * in;
+  return _matrixA.transpose() * in;
+}
+
+template<typename RADIAL_BASIS_FUNCTION_T>
+Eigen::VectorXd RadialBasisFctMapping<RADIAL_BASIS_FUNCTION_T>::solveC
+(
+  const Eigen::VectorXd& in)
+{
+  if (_basisFunction.hasCompactSupport())
+    return _sparseLU.solve(in);
+  return _qr.solve(in);
+}
 
 }} // namespace precice, mapping
@@ -4,6 +4,7 @@
 #include "mesh/Vertex.hpp"
 #include "mesh/Data.hpp"
 #include "utils/Parallel.hpp"
+#include "utils/Threads.hpp"
 #include "math/math.hpp"
 
 #include "tarch/tests/TestCaseFactory.h"
@@ -25,6 +26,7 @@ void NearestNeighborMappingTest:: run()
   PRECICE_MASTER_ONLY {
     testMethod(testConsistentNonIncremental);
     testMethod(testConservativeNonIncremental);
+    testMethod(testThreads);
   }
 }
 
@@ -184,4 +186,59 @@ void NearestNeighborMappingTest:: testConservativeNonIncremental()
   validateNumericalEquals(outValues(1), 0.0);
 }
 
+void NearestNeighborMappingTest:: testThreads()
+{
+  TRACE();
+  using namespace mesh;
+  int dimensions = 2;
+
+  // Create two interleaved grids with data
+  PtrMesh coarseMesh(new Mesh("CoarseMesh", dimensions, false));
+  PtrData coarseData = coarseMesh->createData("CoarseData", 2);
+  for (int i=0; i < 10; i++){
+    for (int j=0; j < 10; j++){
+      coarseMesh->createVertex(Eigen::Vector2d(0.1 * i, 0.1 * j));
+    }
+  }
+  coarseMesh->allocateDataValues();
+  PtrMesh fineMesh(new Mesh("FineMesh", dimensions, false));
+  PtrData fineData = fineMesh->createData("FineData", 2);
+  // Large enough to be split over threads, see the grain sizes of the mapping
+  for (int i=0; i < 230; i++){
+    for (int j=0; j < 170; j++){
+      fineMesh->createVertex(Eigen::Vector2d(0.0041 * i, 0.0057 * j));
+    }
+  }
+  fineMesh->allocateDataValues();
+
+  // Mappings on several threads have to give the same values as on one thread
+  Eigen::VectorXd consistentValues[2];
+  Eigen::VectorXd conservativeValues[2];
+  int threads[2] = {1, 3};
+  for (int run=0; run < 2; run++){
+    utils::Threads::setNumberOfThreads(threads[run]);
+    for (int i=0; i < coarseData->values().size(); i++){
+      coarseData->values()(i) = (double) i;
+    }
+    NearestNeighborMapping consistent(Mapping::CONSISTENT, dimensions);
+    consistent.setMeshes(coarseMesh, fineMesh);
+    consistent.computeMapping();
+    fineData->values().setZero();
+    consistent.map(coarseData->getID(), fineData->getID());
+    consistentValues[run] = fineData->values();
+
+    NearestNeighborMapping conservative(Mapping::CONSERVATIVE, dimensions);
+    conservative.setMeshes(fineMesh, coarseMesh);
+    conservative.computeMapping();
+    coarseData->values().setZero();
+    conservative.map(fineData->getID(), coarseData->getID());
+    conservativeValues[run] = coarseData->values();
+  }
+  utils::Threads::setNumberOfThreads(1);
+
+  validate(consistentValues[0] == consistentValues[1]);
+  validate(conservativeValues[0] == conservativeValues[1]);
+  validateNumericalEquals(conservativeValues[0].sum(), consistentValues[0].sum());
+}
+
 }}} // namespace precice, mapping, tests
@@ -43,6 +43,8 @@ private:
   void testConsistentNonIncremental();
 
   void testConservativeNonIncremental();
+
+  void testThreads();
 };
 
 }}} // namespace precice, mapping, tests
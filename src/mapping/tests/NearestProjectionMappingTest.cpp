@@ -2,9 +2,11 @@
 #include "mapping/NearestProjectionMapping.hpp"
 #include "utils/Parallel.hpp"
 #include "utils/Globals.hpp"
+#include "utils/Threads.hpp"
 #include "mesh/Mesh.hpp"
 #include "mesh/Vertex.hpp"
 #include "mesh/Edge.hpp"
+#include <cmath>
 
 #include "tarch/tests/TestCaseFactory.h"
 registerTest(precice::mapping::tests::NearestProjectionMappingTest)
@@ -25,6 +27,8 @@ void NearestProjectionMappingTest:: run()
   PRECICE_MASTER_ONLY {
     testMethod(testConservativeNonIncremental);
     testMethod(testConsistentNonIncremental);
+    testMethod(testVectorData);
+    testMethod(testThreads);
   }
 }
 
@@ -171,4 +175,114 @@ void NearestProjectionMappingTest:: testConsistentNonIncremental()
   validateNumericalEquals ( outData->values()[2], (valueVertex1 + valueVertex2) * 0.5 );
 }
 
+void NearestProjectionMappingTest:: testVectorData()
+{
+  TRACE();
+  using namespace mesh;
+  int dimensions = 2;
+
+  // Create mesh to map from, with a vector and a scalar data field
+  PtrMesh inMesh ( new Mesh("InMesh", dimensions, false) );
+  PtrData inVectorData = inMesh->createData ( "InVectorData", 2 );
+  PtrData inScalarData = inMesh->createData ( "InScalarData", 1 );
+  Vertex& v1 = inMesh->createVertex ( Eigen::Vector2d(0.0, 0.0) );
+  Vertex& v2 = inMesh->createVertex ( Eigen::Vector2d(1.0, 1.0) );
+  inMesh->createEdge ( v1, v2 );
+  inMesh->computeState();
+  inMesh->allocateDataValues();
+  inVectorData->values() << 1.0, -1.0, 3.0, 5.0;
+  inScalarData->values() << 2.0, 4.0;
+
+  // Create mesh to map to
+  PtrMesh outMesh ( new Mesh("OutMesh", dimensions, false) );
+  PtrData outVectorData = outMesh->createData ( "OutVectorData", 2 );
+  PtrData outScalarData = outMesh->createData ( "OutScalarData", 1 );
+  outMesh->createVertex ( Eigen::Vector2d(0.5, 0.5) );
+  outMesh->createVertex ( Eigen::Vector2d(-0.5, -0.5) );
+  outMesh->createVertex ( Eigen::Vector2d(0.75, 0.75) );
+  outMesh->allocateDataValues();
+
+  // Both data fields use the same computed mapping
+  NearestProjectionMapping mapping(Mapping::CONSISTENT, dimensions);
+  mapping.setMeshes ( inMesh, outMesh );
+  mapping.computeMapping();
+  mapping.map ( inVectorData->getID(), outVectorData->getID() );
+  mapping.map ( inScalarData->getID(), outScalarData->getID() );
+
+  const Eigen::VectorXd& vectorValues = outVectorData->values();
+  validateNumericalEquals ( vectorValues[0], 2.0 );
+  validateNumericalEquals ( vectorValues[1], 2.0 );
+  validateNumericalEquals ( vectorValues[2], 1.0 );
+  validateNumericalEquals ( vectorValues[3], -1.0 );
+  validateNumericalEquals ( vectorValues[4], 2.5 );
+  validateNumericalEquals ( vectorValues[5], 3.5 );
+  const Eigen::VectorXd& scalarValues = outScalarData->values();
+  validateNumericalEquals ( scalarValues[0], 3.0 );
+  validateNumericalEquals ( scalarValues[1], 2.0 );
+  validateNumericalEquals ( scalarValues[2], 3.5 );
+}
+
+void NearestProjectionMappingTest:: testThreads()
+{
+  TRACE();
+  using namespace mesh;
+  int dimensions = 2;
+
+  // Create a closed polygon to map from and to
+  PtrMesh polygon ( new Mesh("Polygon", dimensions, false) );
+  PtrData polygonData = polygon->createData ( "PolygonData", 1 );
+  int polygonSize = 50;
+  for (int i=0; i < polygonSize; i++){
+    double angle = 2.0 * M_PI * i / polygonSize;
+    polygon->createVertex ( Eigen::Vector2d(std::cos(angle), std::sin(angle)) );
+  }
+  for (int i=0; i < polygonSize; i++){
+    polygon->createEdge ( polygon->vertices()[i],
+                          polygon->vertices()[(i + 1) % polygonSize] );
+  }
+  polygon->computeState();
+  polygon->allocateDataValues();
+
+  // Create a point cloud around the polygon, its data is mapped from the polygon
+  PtrMesh points ( new Mesh("Points", dimensions, false) );
+  PtrData pointsData = points->createData ( "PointsData", 1 );
+  // Large enough to be split over threads, see the grain sizes of the mapping
+  int pointsSize = 10001;
+  for (int i=0; i < pointsSize; i++){
+    double angle = 2.0 * M_PI * i / pointsSize;
+    double radius = 0.8 + 0.00004 * i;
+    points->createVertex ( Eigen::Vector2d(radius * std::cos(angle), radius * std::sin(angle)) );
+  }
+  points->allocateDataValues();
+
+  // Mappings on several threads have to give the same values as on one thread
+  Eigen::VectorXd consistentValues[2];
+  Eigen::VectorXd conservativeValues[2];
+  int threads[2] = {1, 3};
+  for (int run=0; run < 2; run++){
+    utils::Threads::setNumberOfThreads(threads[run]);
+    for (int i=0; i < polygonSize; i++){
+      polygonData->values()[i] = (double) i;
+    }
+    NearestProjectionMapping consistent(Mapping::CONSISTENT, dimensions);
+    consistent.setMeshes ( polygon, points );
+    consistent.computeMapping();
+    pointsData->values().setZero();
+    consistent.map ( polygonData->getID(), pointsData->getID() );
+    consistentValues[run] = pointsData->values();
+
+    NearestProjectionMapping conservative(Mapping::CONSERVATIVE, dimensions);
+    conservative.setMeshes ( points, polygon );
+    conservative.computeMapping();
+    polygonData->values().setZero();
+    conservative.map ( pointsData->getID(), polygonData->getID() );
+    conservativeValues[run] = polygonData->values();
+  }
+  utils::Threads::setNumberOfThreads(1);
+
+  validate ( consistentValues[0] == consistentValues[1] );
+  validate ( conservativeValues[0] == conservativeValues[1] );
+  validateNumericalEquals ( conservativeValues[0].sum(), consistentValues[0].sum() );
+}
+
 }}} // namespace precice, mapping, tests
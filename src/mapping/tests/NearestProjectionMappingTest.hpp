@@ -30,6 +30,10 @@ private:
    void testConservativeNonIncremental();
 
    void testConsistentNonIncremental();
+
+   void testVectorData();
+
+   void testThreads();
 };
 
 }}} // namespace precice, mapping, tests
@@ -40,6 +40,8 @@ void PetRadialBasisFctMappingTest:: run()
     testMethod(testDeadAxis2D);
     testMethod(testDeadAxis3D);
     testMethod(testSolutionCaching);
+    testMethod(testCompactSupportPreallocation);
+    testMethod(testVectorData);
     PETSC_COMM_WORLD = MPI_COMM_WORLD;
   }
   
@@ -1041,6 +1043,126 @@ void PetRadialBasisFctMappingTest::testSolutionCaching()
   validateEquals(its, 0);
 }
 
+void PetRadialBasisFctMappingTest::testCompactSupportPreallocation()
+{
+  TRACE();
+  using Eigen::Vector2d;
+  int dimensions = 2;
+
+  bool xDead = false, yDead = false, zDead = false;
+
+  CompactPolynomialC0 fct(1.5);
+  PetRadialBasisFctMapping<CompactPolynomialC0> mapping(Mapping::CONSISTENT, dimensions, fct,
+                                                        xDead, yDead, zDead);
+
+  // Create a grid to map from, each vertex has its 8 grid neighbors within the support radius
+  mesh::PtrMesh inMesh ( new mesh::Mesh("InMesh", dimensions, false) );
+  mesh::PtrData inData = inMesh->createData ( "InData", 1 );
+  int inDataID = inData->getID ();
+  for (int i = 0; i < 10; i++) {
+    for (int j = 0; j < 10; j++) {
+      inMesh->createVertex ( Vector2d(i, j) );
+    }
+  }
+  inMesh->allocateDataValues();
+  addGlobalIndex(inMesh);
+  inData->values().setConstant(1.0);
+
+  // Create the cell centers of the grid to map to
+  mesh::PtrMesh outMesh ( new mesh::Mesh("OutMesh", dimensions, false) );
+  mesh::PtrData outData = outMesh->createData ( "OutData", 1 );
+  int outDataID = outData->getID();
+  for (int i = 0; i < 9; i++) {
+    for (int j = 0; j < 9; j++) {
+      outMesh->createVertex ( Vector2d(i + 0.5, j + 0.5) );
+    }
+  }
+  outMesh->allocateDataValues();
+  addGlobalIndex(outMesh);
+
+  mapping.setMeshes ( inMesh, outMesh );
+  mapping.computeMapping();
+
+  // The preallocation is exact, no entry needs additional memory
+  validateEquals ( mapping._matrixC.getInfo(MAT_LOCAL).mallocs, 0.0 );
+  validateEquals ( mapping._matrixA.getInfo(MAT_LOCAL).mallocs, 0.0 );
+  validateEquals ( mapping._matrixC.getInfo(MAT_LOCAL).nz_unneeded, 0.0 );
+  validateEquals ( mapping._matrixA.getInfo(MAT_LOCAL).nz_unneeded, 0.0 );
+
+  // Constant values are reproduced by the polynomial
+  mapping.map ( inDataID, outDataID );
+  for (int i = 0; i < outData->values().size(); i++) {
+    validateNumericalEqualsWithEps ( outData->values()[i], 1.0, tolerance );
+  }
+}
+
+void PetRadialBasisFctMappingTest::testVectorData()
+{
+  TRACE();
+  using Eigen::Vector2d;
+  int dimensions = 2;
+
+  bool xDead = false, yDead = false, zDead = false;
+
+  CompactPolynomialC6 fct(2.5);
+  typedef PetRadialBasisFctMapping<CompactPolynomialC6> Mapping;
+
+  // Create a grid with a linear vector field to map from
+  mesh::PtrMesh inMesh ( new mesh::Mesh("InMesh", dimensions, false) );
+  mesh::PtrData inData = inMesh->createData ( "InData", dimensions );
+  int inDataID = inData->getID ();
+  for (int i = 0; i < 6; i++) {
+    for (int j = 0; j < 6; j++) {
+      inMesh->createVertex ( Vector2d(i, j) );
+    }
+  }
+  inMesh->allocateDataValues();
+  addGlobalIndex(inMesh);
+  for (const mesh::Vertex& vertex : inMesh->vertices()) {
+    inData->values()[vertex.getID() * 2]     = 1.0 + vertex.getCoords()[0];
+    inData->values()[vertex.getID() * 2 + 1] = 2.0 - 3.0 * vertex.getCoords()[1];
+  }
+
+  // Create the cell centers of the grid to map to
+  mesh::PtrMesh outMesh ( new mesh::Mesh("OutMesh", dimensions, false) );
+  mesh::PtrData outData = outMesh->createData ( "OutData", dimensions );
+  int outDataID = outData->getID();
+  for (int i = 0; i < 5; i++) {
+    for (int j = 0; j < 5; j++) {
+      outMesh->createVertex ( Vector2d(i + 0.5, j + 0.5) );
+    }
+  }
+  outMesh->allocateDataValues();
+  addGlobalIndex(outMesh);
+
+  // All components are solved together, linear fields are reproduced by the polynomial
+  Mapping consistentMap(Mapping::CONSISTENT, dimensions, fct, xDead, yDead, zDead);
+  consistentMap.setMeshes ( inMesh, outMesh );
+  consistentMap.computeMapping();
+  consistentMap.map ( inDataID, outDataID );
+  validateEquals ( consistentMap.previousSolution.size(), 2 );
+  for (const mesh::Vertex& vertex : outMesh->vertices()) {
+    validateNumericalEqualsWithEps ( outData->values()[vertex.getID() * 2],
+                                     1.0 + vertex.getCoords()[0], tolerance );
+    validateNumericalEqualsWithEps ( outData->values()[vertex.getID() * 2 + 1],
+                                     2.0 - 3.0 * vertex.getCoords()[1], tolerance );
+  }
+
+  // The sum of each component is conserved
+  Mapping conservativeMap(Mapping::CONSERVATIVE, dimensions, fct, xDead, yDead, zDead);
+  conservativeMap.setMeshes ( outMesh, inMesh );
+  conservativeMap.computeMapping();
+  conservativeMap.map ( outDataID, inDataID );
+  for (int dim = 0; dim < dimensions; dim++) {
+    double inSum = 0.0, outSum = 0.0;
+    for (size_t i = 0; i < outMesh->vertices().size(); i++)
+      outSum += outData->values()[i * 2 + dim];
+    for (size_t i = 0; i < inMesh->vertices().size(); i++)
+      inSum += inData->values()[i * 2 + dim];
+    validateNumericalEqualsWithEps ( inSum, outSum, tolerance );
+  }
+}
+
 void PetRadialBasisFctMappingTest::addGlobalIndex(mesh::PtrMesh &mesh, int offset)
 {
   for (mesh::Vertex& v : mesh->vertices()) {
@@ -93,6 +93,12 @@ private:
 
   void testSolutionCaching();
 
+  /// Tests the exact preallocation of the matrices for a basis function with compact support.
+  void testCompactSupportPreallocation();
+
+  /// Tests consistent and conservative mapping of a vector field, whose components are solved together.
+  void testVectorData();
+
   struct VertexSpecification
   {
     int rank;
@@ -33,6 +33,7 @@ void RadialBasisFctMappingTest:: run()
   testMethod(testCompactPolynomialC6);
   testMethod(testDeadAxis2D);
   testMethod(testDeadAxis3D);
+  testMethod(testCompactSupportGrid);
 }
 
 void RadialBasisFctMappingTest:: testThinPlateSplines()
@@ -604,4 +605,60 @@ void RadialBasisFctMappingTest:: testDeadAxis3D()
   validateNumericalEquals ( outData->values()[3], 4.3 );
 }
 
+void RadialBasisFctMappingTest:: testCompactSupportGrid()
+{
+  TRACE();
+  int dimensions = 2;
+  using Eigen::Vector2d;
+
+  CompactPolynomialC6 fct(1.5);
+  bool xDead = false;
+  bool yDead = false;
+  bool zDead = false;
+  typedef RadialBasisFctMapping<CompactPolynomialC6> Mapping;
+
+  // Create a grid to map from, much larger than the support radius
+  mesh::PtrMesh inMesh ( new mesh::Mesh("InMesh", dimensions, false) );
+  mesh::PtrData inData = inMesh->createData ( "InData", 1 );
+  int inDataID = inData->getID ();
+  for (int i = 0; i < 20; i++) {
+    for (int j = 0; j < 20; j++) {
+      inMesh->createVertex ( Vector2d(i, j) );
+    }
+  }
+  inMesh->allocateDataValues ();
+  for (const mesh::Vertex& vertex : inMesh->vertices()) {
+    inData->values()[vertex.getID()] = 1.0 + 2.0 * vertex.getCoords()[0] - vertex.getCoords()[1];
+  }
+
+  // Create the cell centers of the grid to map to
+  mesh::PtrMesh outMesh ( new mesh::Mesh("OutMesh", dimensions, false) );
+  mesh::PtrData outData = outMesh->createData ( "OutData", 1 );
+  int outDataID = outData->getID();
+  for (int i = 0; i < 19; i++) {
+    for (int j = 0; j < 19; j++) {
+      outMesh->createVertex ( Vector2d(i + 0.5, j + 0.5) );
+    }
+  }
+  outMesh->allocateDataValues();
+
+  // Linear functions are reproduced by the polynomial
+  Mapping consistentMap(Mapping::CONSISTENT, dimensions, fct, xDead, yDead, zDead);
+  consistentMap.setMeshes ( inMesh, outMesh );
+  consistentMap.computeMapping ();
+  consistentMap.map ( inDataID, outDataID );
+  for (const mesh::Vertex& vertex : outMesh->vertices()) {
+    double expected = 1.0 + 2.0 * vertex.getCoords()[0] - vertex.getCoords()[1];
+    validateNumericalEquals ( outData->values()[vertex.getID()], expected );
+  }
+
+  // The sum of the values is conserved
+  Mapping conservativeMap(Mapping::CONSERVATIVE, dimensions, fct, xDead, yDead, zDead);
+  conservativeMap.setMeshes ( outMesh, inMesh );
+  outData->values().setConstant(1.0);
+  conservativeMap.computeMapping ();
+  conservativeMap.map ( outDataID, inDataID );
+  validateNumericalEquals ( inData->values().sum(), outData->values().sum() );
+}
+
 }}} // namespace precice, mapping, tests
@@ -93,6 +93,11 @@ private:
    * @brief
    */
   void testDeadAxis3D ();
+
+  /**
+   * @brief Tests the sparse assembly for a compact basis function on a grid larger than its support.
+   */
+  void testCompactSupportGrid ();
 };
 
 }}} // namespace precice, mapping, tests
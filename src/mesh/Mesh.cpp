@@ -7,6 +7,7 @@
 #include "utils/EigenHelperFunctions.hpp"
 #include "math/math.hpp"
 #include <Eigen/Dense>
+#include <algorithm>
 
 namespace precice {
 namespace mesh {
@@ -35,6 +36,10 @@ Mesh:: Mesh
   _content(),
   _data(),
   _manageVertexIDs(),
+  _vertexCoords(),
+  _vertexNormals(),
+  _edgeLookup(),
+  _edgeLookupSize(0),
   _manageEdgeIDs(),
   _manageTriangleIDs(),
   _manageQuadIDs(),
@@ -121,6 +126,51 @@ int Mesh:: getDimensions() const
   return _dimensions;
 }
 
+void Mesh:: reserveVertices
+(
+  int count )
+{
+  _content.vertices().reserve(count);
+  _vertexCoords.reserve(count * _dimensions);
+  _vertexNormals.reserve(count * _dimensions);
+}
+
+void Mesh:: reserveEdges
+(
+  int count )
+{
+  _content.edges().reserve(count);
+}
+
+void Mesh:: reserveTriangles
+(
+  int count )
+{
+  _content.triangles().reserve(count);
+}
+
+Eigen::Map<const Eigen::MatrixXd> Mesh:: vertexCoords() const
+{
+  return Eigen::Map<const Eigen::MatrixXd>(_vertexCoords.data(), _dimensions,
+                                           _vertexCoords.size() / _dimensions);
+}
+
+Eigen::Map<const Eigen::MatrixXd> Mesh:: vertexNormals() const
+{
+  return Eigen::Map<const Eigen::MatrixXd>(_vertexNormals.data(), _dimensions,
+                                           _vertexNormals.size() / _dimensions);
+}
+
+std::uint64_t Mesh:: edgeKey
+(
+  int vertexIDOne,
+  int vertexIDTwo )
+{
+  std::uint64_t low = std::min(vertexIDOne, vertexIDTwo);
+  std::uint64_t high = std::max(vertexIDOne, vertexIDTwo);
+  return (high << 32) | low;
+}
+
 void Mesh:: addListener
 (
   Mesh::MeshListener& listener )
@@ -133,6 +183,13 @@ void Mesh:: addListener
   _listeners.push_back(& listener);
 }
 
+void Mesh:: removeListener
+(
+  Mesh::MeshListener& listener )
+{
+  _listeners.remove(& listener);
+}
+
 Edge& Mesh:: createEdge
 (
   Vertex& vertexOne,
@@ -144,6 +201,23 @@ Edge& Mesh:: createEdge
   return *newEdge;
 }
 
+Edge& Mesh:: createUniqueEdge
+(
+  Vertex& vertexOne,
+  Vertex& vertexTwo )
+{
+  EdgeContainer& edges = _content.edges();
+  for (; _edgeLookupSize < edges.size(); _edgeLookupSize++){
+    Edge& edge = edges[_edgeLookupSize];
+    _edgeLookup.insert({edgeKey(edge.vertex(0).getID(), edge.vertex(1).getID()), &edge});
+  }
+  auto found = _edgeLookup.find(edgeKey(vertexOne.getID(), vertexTwo.getID()));
+  if (found != _edgeLookup.end()){
+    return *found->second;
+  }
+  return createEdge(vertexOne, vertexTwo);
+}
+
 Triangle& Mesh:: createTriangle
 (
   Edge& edgeOne,
@@ -676,6 +750,10 @@ void Mesh:: clear()
   _manageTriangleIDs.resetIDs();
   _manageEdgeIDs.resetIDs();
   _manageVertexIDs.resetIDs();
+  _vertexCoords.clear();
+  _vertexNormals.clear();
+  _edgeLookup.clear();
+  _edgeLookupSize = 0;
 
   for (mesh::PtrData data : _data) {
     data->values().resize(0); // TODO: mybe incorrect, previous was clear() ... check if resize(0) has some bad side effects
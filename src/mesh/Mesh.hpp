@@ -7,8 +7,10 @@
 #include "utils/PointerVector.hpp"
 #include "utils/ManageUniqueIDs.hpp"
 #include <boost/noncopyable.hpp>
+#include <cstdint>
 #include <map>
 #include <list>
+#include <unordered_map>
 #include <vector>
 
 namespace precice {
@@ -134,16 +136,58 @@ public:
    */
   void addListener ( MeshListener& listener );
 
+  /**
+   * @brief Deregisters the listener, does nothing if it is not registered.
+   */
+  void removeListener ( MeshListener& listener );
+
   template<typename VECTOR_T>
   Vertex& createVertex ( const VECTOR_T& coords )
   {
     assertion(coords.size() == _dimensions, coords.size(), _dimensions);
-    Vertex* newVertex = new Vertex(coords, _manageVertexIDs.getFreeID(), *this);
+    // Evaluated first, since coords may refer to the coordinates of another vertex
+    Eigen::VectorXd newCoords = coords;
+    int id = _manageVertexIDs.getFreeID();
+    assertion(id * _dimensions == (int) _vertexCoords.size(), id, _vertexCoords.size());
+    _vertexCoords.insert(_vertexCoords.end(), newCoords.data(), newCoords.data() + _dimensions);
+    _vertexNormals.resize(_vertexCoords.size(), 0.0);
+    Vertex* newVertex = new Vertex(id, *this);
     newVertex->addParent(*this);
     _content.add(newVertex);
     return *newVertex;
   }
 
+  /**
+   * @brief Reserves storage for the given total number of vertices.
+   *
+   * Avoids reallocations when many vertices are created, e.g., in setMeshVertices.
+   */
+  void reserveVertices ( int count );
+
+  /// Reserves storage for the given total number of edges.
+  void reserveEdges ( int count );
+
+  /// Reserves storage for the given total number of triangles.
+  void reserveTriangles ( int count );
+
+  /**
+   * @brief Returns the coordinates of all vertices as dimensions x vertices matrix.
+   *
+   * Column i holds the coordinates of the vertex with ID i, which is also at
+   * position i in vertices(). The vertices refer to these coordinates instead
+   * of storing their own, hence loops over all vertices should prefer this view
+   * over vertices(). The view is invalidated by creating further vertices and
+   * by clear().
+   */
+  Eigen::Map<const Eigen::MatrixXd> vertexCoords() const;
+
+  /**
+   * @brief Returns the normals of all vertices as dimensions x vertices matrix.
+   *
+   * Same layout and validity as vertexCoords().
+   */
+  Eigen::Map<const Eigen::MatrixXd> vertexNormals() const;
+
   /**
    * @brief Creates and initializes an Edge object.
    *
@@ -155,6 +199,16 @@ public:
     Vertex& vertexOne,
     Vertex& vertexTwo );
 
+  /**
+   * @brief Returns the edge between the given vertices, creates it if not existing.
+   *
+   * The orientation of an existing edge is not considered. Existing edges are
+   * looked up in a hash map keyed by the vertex IDs, which is updated lazily.
+   */
+  Edge& createUniqueEdge (
+    Vertex& vertexOne,
+    Vertex& vertexTwo );
+
   /**
    * @brief Creates and initializes a Triangle object.
    *
@@ -343,6 +397,18 @@ private:
 
   utils::ManageUniqueIDs _manageVertexIDs;
 
+  /// Coordinates of all vertices, ordered by vertex ID with stride _dimensions.
+  std::vector<double> _vertexCoords;
+
+  /// Normals of all vertices, same layout as _vertexCoords.
+  std::vector<double> _vertexNormals;
+
+  /// Edges by the IDs of their vertices, see edgeKey(). Used by createUniqueEdge().
+  std::unordered_map<std::uint64_t,Edge*> _edgeLookup;
+
+  /// Number of edges, in creation order, which are contained in _edgeLookup.
+  size_t _edgeLookupSize;
+
   utils::ManageUniqueIDs _manageEdgeIDs;
 
   utils::ManageUniqueIDs _manageTriangleIDs;
@@ -379,6 +445,12 @@ private:
 
   /// Sets the isOwner property of a vertex i, if ownerVec[i] == 1
   void setOwnerInformation(const std::vector<int> &ownerVec);
+
+  /// Refers to _vertexCoords and _vertexNormals.
+  friend class Vertex;
+
+  /// Returns the key of an edge in _edgeLookup, independent of its orientation.
+  static std::uint64_t edgeKey ( int vertexIDOne, int vertexIDTwo );
 };
 
 }} // namespace precice, mesh
@@ -1,17 +1,34 @@
 #include "Vertex.hpp"
+#include "Mesh.hpp"
 #include "utils/ManageUniqueIDs.hpp"
 
 namespace precice {
 namespace mesh {
 
-int Vertex:: getDimensions() const
+Vertex:: Vertex
+(
+  int   id,
+  Mesh& mesh )
+:
+  PropertyContainer (),
+  _id ( id ),
+  _dimensions ( mesh.getDimensions() ),
+  _globalIndex(-1),
+  _owner(true),
+  _mesh ( & mesh ),
+  _coordsStorage ( & mesh._vertexCoords ),
+  _normalsStorage ( & mesh._vertexNormals ),
+  _offset ( id * mesh.getDimensions() ),
+  _ownStorage ()
 {
-  return _coords.size();
+  assertion(_offset + _dimensions <= (int) _coordsStorage->size(), _offset, _coordsStorage->size());
+  assertion(_normalsStorage->size() == _coordsStorage->size(),
+            _normalsStorage->size(), _coordsStorage->size());
 }
 
-const Eigen::VectorXd& Vertex::getNormal () const
+int Vertex:: getDimensions() const
 {
-  return _normal;
+  return _dimensions;
 }
 
 const Mesh* Vertex:: mesh () const
@@ -3,7 +3,10 @@
 
 #include "mesh/PropertyContainer.hpp"
 #include "boost/noncopyable.hpp"
+#include <Eigen/Core>
 #include <map>
+#include <memory>
+#include <vector>
 
 namespace precice {
   namespace mesh {
@@ -18,11 +21,19 @@ namespace mesh {
 
 /**
  * @brief Vertex of a mesh.
+ *
+ * The coordinates and the normal of a vertex with parent mesh are stored by
+ * the mesh, in the arrays viewed by Mesh::vertexCoords() and
+ * Mesh::vertexNormals(), and the vertex only refers to them by its ID. A vertex
+ * without parent mesh stores its coordinates and normal itself.
  */
 class Vertex : public PropertyContainer, private boost::noncopyable
 {
 public:
 
+  /// Read-only view of the coordinates or the normal of a vertex.
+  typedef Eigen::Map<const Eigen::VectorXd> ConstVectorMap;
+
   /**
    * @brief Constructor for vertex, parent mesh is not assigned.
    */
@@ -33,12 +44,13 @@ public:
 
   /**
    * @brief Constructor for vertex, parent mesh is assigned.
+   *
+   * The coordinates of the vertex have to be stored by the mesh already, see
+   * Mesh::createVertex().
    */
-  template<typename VECTOR_T>
   Vertex (
-    const VECTOR_T& coordinates,
-    int             id,
-    Mesh&           mesh );
+    int   id,
+    Mesh& mesh );
 
   /**
    * @brief Destructor, empty.
@@ -67,11 +79,15 @@ public:
    */
   int getID() const;
 
-  /// Returns the coordinates of the vertex.
-  const Eigen::VectorXd& getCoords() const;
+  /**
+   * @brief Returns the coordinates of the vertex.
+   *
+   * The view is invalidated, when further vertices are created in the parent mesh.
+   */
+  ConstVectorMap getCoords() const;
 
-  /// Returns the normal of the vertex.
-  const Eigen::VectorXd& getNormal() const;
+  /// Returns the normal of the vertex, with the same validity as getCoords().
+  ConstVectorMap getNormal() const;
 
   /**
    * @brief Returns (possibly NULL) pointer to parent const Mesh object.
@@ -93,14 +109,17 @@ public:
 
 private:
 
+  /// Coordinates and normal of a vertex without parent mesh.
+  struct OwnStorage
+  {
+    std::vector<double> coords;
+    std::vector<double> normal;
+  };
+
   // @brief Unique (among vertices in one mesh) ID of the vertex.
   int _id;
 
-  /// Coordinates of the vertex.
-  Eigen::VectorXd _coords;
-
-  /// Normal of the vertex.
-  Eigen::VectorXd _normal;
+  int _dimensions;
 
   // @brief global (unique) index for parallel simulations
   int _globalIndex;
@@ -110,6 +129,18 @@ private:
 
   // @brief Pointer to parent mesh, possibly NULL.
   Mesh * _mesh;
+
+  /// Coordinates of all vertices of the parent mesh, or _ownStorage->coords.
+  std::vector<double>* _coordsStorage;
+
+  /// Normals of all vertices of the parent mesh, or _ownStorage->normal.
+  std::vector<double>* _normalsStorage;
+
+  /// Position of the coordinates and the normal in their storage.
+  int _offset;
+
+  /// Storage of a vertex without parent mesh, NULL otherwise.
+  std::unique_ptr<OwnStorage> _ownStorage;
 };
 
 // ------------------------------------------------------ HEADER IMPLEMENTATION
@@ -122,35 +153,29 @@ Vertex:: Vertex
 :
   PropertyContainer (),
   _id ( id ),
-  _coords ( coordinates ),
-  _normal ( Eigen::VectorXd::Constant(_coords.size(), 0.0) ),
-  _globalIndex(-1),
-  _owner(true),
-  _mesh ( NULL )
-{}
-
-template<typename VECTOR_T>
-Vertex:: Vertex (
-  const VECTOR_T& coordinates,
-  int             id,
-  Mesh&           mesh )
-:
-  PropertyContainer (),
-  _id ( id ),
-  _coords ( coordinates ),
-  _normal ( Eigen::VectorXd::Constant(_coords.size(), 0.0) ),
+  _dimensions ( coordinates.size() ),
   _globalIndex(-1),
   _owner(true),
-  _mesh ( & mesh )
-{}
+  _mesh ( NULL ),
+  _coordsStorage ( NULL ),
+  _normalsStorage ( NULL ),
+  _offset ( 0 ),
+  _ownStorage ( new OwnStorage() )
+{
+  _ownStorage->coords.resize(_dimensions);
+  _ownStorage->normal.resize(_dimensions, 0.0);
+  _coordsStorage = &_ownStorage->coords;
+  _normalsStorage = &_ownStorage->normal;
+  setCoords(coordinates);
+}
 
 template<typename VECTOR_T>
 void Vertex:: setCoords
 (
   const VECTOR_T& coordinates )
 {
-  assertion ( coordinates.size() == _coords.size(), coordinates.size(), _coords.size() );
-  _coords = coordinates;
+  assertion ( coordinates.size() == _dimensions, coordinates.size(), _dimensions );
+  Eigen::Map<Eigen::VectorXd>(_coordsStorage->data() + _offset, _dimensions) = coordinates;
 }
 
 template<typename VECTOR_T>
@@ -158,8 +183,8 @@ void Vertex:: setNormal
 (
   const VECTOR_T& normal )
 {
-  assertion ( normal.size() == _normal.size(), normal.size(), _normal.size() );
-  _normal = normal;
+  assertion ( normal.size() == _dimensions, normal.size(), _dimensions );
+  Eigen::Map<Eigen::VectorXd>(_normalsStorage->data() + _offset, _dimensions) = normal;
 }
 
 inline int Vertex:: getID() const
@@ -167,9 +192,14 @@ inline int Vertex:: getID() const
   return _id;
 }
 
-inline const Eigen::VectorXd& Vertex::getCoords() const
+inline Vertex::ConstVectorMap Vertex:: getCoords() const
+{
+  return ConstVectorMap(_coordsStorage->data() + _offset, _dimensions);
+}
+
+inline Vertex::ConstVectorMap Vertex:: getNormal() const
 {
-  return _coords;
+  return ConstVectorMap(_normalsStorage->data() + _offset, _dimensions);
 }
 
 }} // namespace precice, mesh
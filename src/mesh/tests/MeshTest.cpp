@@ -34,6 +34,8 @@ void MeshTest:: run()
     testMethod(testComputeState);
     testMethod(testDemonstration);
     testMethod(testBoundingBoxCOG);
+    testMethod(testVertexCoordsView);
+    testMethod(testCreateUniqueEdge);
   }
 # ifndef PRECICE_NO_MPI
   typedef utils::Parallel Par;
@@ -316,6 +318,69 @@ void MeshTest::testBoundingBoxCOG()
 }
 
 
+void MeshTest:: testVertexCoordsView()
+{
+  TRACE();
+  using Eigen::Vector3d;
+  Mesh mesh("MyMesh", 3, false);
+  validateEquals(mesh.vertexCoords().cols(), 0);
+  Vertex& v0 = mesh.createVertex(Vector3d(0.0, 1.0, 2.0));
+  mesh.createVertex(Vector3d(3.0, 4.0, 5.0));
+  Eigen::Map<const Eigen::MatrixXd> coords = mesh.vertexCoords();
+  validateEquals(coords.rows(), 3);
+  validateEquals(coords.cols(), 2);
+  validate(math::equals(Vector3d(coords.col(1)), Vector3d(3.0, 4.0, 5.0)));
+  validate(math::equals(Vector3d(mesh.vertexNormals().col(0)), Vector3d::Zero()));
+
+  v0.setCoords(Vector3d(-1.0, -2.0, -3.0));
+  v0.setNormal(Vector3d(0.0, 0.0, 1.0));
+  validate(math::equals(Vector3d(mesh.vertexCoords().col(0)), Vector3d(-1.0, -2.0, -3.0)));
+  validate(math::equals(Vector3d(mesh.vertexNormals().col(0)), Vector3d(0.0, 0.0, 1.0)));
+
+  // Vertices refer to the storage of the mesh, also after it has grown
+  const double* storage = mesh.vertexCoords().data();
+  for (int i=0; i < 100; i++){
+    mesh.createVertex(Vector3d::Constant(i));
+  }
+  validate(storage != mesh.vertexCoords().data());
+  validate(v0.getCoords().data() == mesh.vertexCoords().data());
+  validate(math::equals(Vector3d(v0.getCoords()), Vector3d(-1.0, -2.0, -3.0)));
+  validate(math::equals(Vector3d(v0.getNormal()), Vector3d(0.0, 0.0, 1.0)));
+  Vertex& copied = mesh.createVertex(v0.getCoords());
+  validate(math::equals(Vector3d(copied.getCoords()), Vector3d(-1.0, -2.0, -3.0)));
+
+  mesh.clear();
+  validateEquals(mesh.vertexCoords().cols(), 0);
+  Vertex& v = mesh.createVertex(Vector3d(7.0, 8.0, 9.0));
+  validateEquals(v.getID(), 0);
+  validate(math::equals(Vector3d(mesh.vertexCoords().col(0)), Vector3d(7.0, 8.0, 9.0)));
+}
+
+void MeshTest:: testCreateUniqueEdge()
+{
+  TRACE();
+  Mesh mesh("MyMesh", 2, false);
+  Vertex& v0 = mesh.createVertex(Eigen::Vector2d(0.0, 0.0));
+  Vertex& v1 = mesh.createVertex(Eigen::Vector2d(1.0, 0.0));
+  Vertex& v2 = mesh.createVertex(Eigen::Vector2d(1.0, 1.0));
+  Edge& e01 = mesh.createEdge(v0, v1);
+
+  // Edges created before and after the first lookup are found in both orientations
+  validateEquals(mesh.createUniqueEdge(v1, v0).getID(), e01.getID());
+  Edge& e12 = mesh.createEdge(v1, v2);
+  validateEquals(mesh.createUniqueEdge(v2, v1).getID(), e12.getID());
+  Edge& e20 = mesh.createUniqueEdge(v2, v0);
+  validateEquals(mesh.edges().size(), 3);
+  validateEquals(mesh.createUniqueEdge(v0, v2).getID(), e20.getID());
+  validateEquals(mesh.edges().size(), 3);
+
+  mesh.clear();
+  Vertex& w0 = mesh.createVertex(Eigen::Vector2d(0.0, 0.0));
+  Vertex& w1 = mesh.createVertex(Eigen::Vector2d(1.0, 0.0));
+  mesh.createUniqueEdge(w0, w1);
+  validateEquals(mesh.edges().size(), 1);
+}
+
 void MeshTest:: testDemonstration ()
 {
   preciceTrace ( "testDemonstration()" );
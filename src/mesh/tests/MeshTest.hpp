@@ -57,6 +57,16 @@ private:
 
    void testBoundingBoxCOG();
 
+   /**
+    * @brief Tests that Mesh::vertexCoords() and vertexNormals() follow the vertices.
+    */
+   void testVertexCoordsView ();
+
+   /**
+    * @brief Tests method Mesh::createUniqueEdge().
+    */
+   void testCreateUniqueEdge ();
+
    /**
     * @brief Demonstrates the capabilities of class Mesh.
     */
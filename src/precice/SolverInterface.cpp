@@ -144,6 +144,30 @@ ClosestMesh SolverInterface:: inquireClosestMesh
   return _impl->inquireClosestMesh ( point, meshIDs );
 }
 
+void SolverInterface:: inquirePositions
+(
+  int                  size,
+  const double*        points,
+  const std::set<int>& meshIDs,
+  int*                 positions )
+{
+  _impl->inquirePositions ( size, points, meshIDs, positions );
+}
+
+void SolverInterface:: inquireClosestMeshes
+(
+  int                  size,
+  const double*        points,
+  const std::set<int>& meshIDs,
+  int*                 positions,
+  double*              distances,
+  double*              distanceVectors,
+  int*                 closestMeshIDs )
+{
+  _impl->inquireClosestMeshes ( size, points, meshIDs, positions, distances,
+                                distanceVectors, closestMeshIDs );
+}
+
 VoxelPosition SolverInterface:: inquireVoxelPosition
 (
   const double*        voxelCenter,
@@ -238,6 +262,34 @@ void SolverInterface:: setMeshTriangleWithEdges
   _impl->setMeshTriangleWithEdges ( meshID, firstVertexID, secondVertexID, thirdVertexID );
 }
 
+void SolverInterface:: setMeshEdges
+(
+  int        meshID,
+  int        size,
+  const int* vertexIDs,
+  int*       edgeIDs )
+{
+  _impl->setMeshEdges(meshID, size, vertexIDs, edgeIDs);
+}
+
+void SolverInterface:: setMeshTriangles
+(
+  int        meshID,
+  int        size,
+  const int* edgeIDs )
+{
+  _impl->setMeshTriangles(meshID, size, edgeIDs);
+}
+
+void SolverInterface:: setMeshTrianglesWithEdges
+(
+  int        meshID,
+  int        size,
+  const int* vertexIDs )
+{
+  _impl->setMeshTrianglesWithEdges(meshID, size, vertexIDs);
+}
+
 void SolverInterface:: setMeshQuad
 (
   int meshID,
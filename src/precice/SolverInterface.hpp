@@ -309,6 +309,48 @@ public:
     const double*        inquiredPoint,
     const std::set<int>& meshIDs );
 
+  /**
+   * @brief Find out positions of several points relative to geometries.
+   *
+   * Gives the same results as calling inquirePosition() for every point, but
+   * evaluates all points in one pass. The pass is split over the threads
+   * configured by the attribute threads of tag <solver-interface>, and sends
+   * one request only, when a server is used.
+   *
+   * @param[in] size Number of points.
+   * @param[in] points Coordinates of the points, dimensions entries per point.
+   * @param[in] meshIDs Mesh IDs of the geometries to be considered.
+   * @param[out] positions Position IDs of the points (see precice::constants).
+   */
+  void inquirePositions (
+    int                  size,
+    const double*        points,
+    const std::set<int>& meshIDs,
+    int*                 positions );
+
+  /**
+   * @brief Find out, which geometry is closest to each of several points.
+   *
+   * Gives the same results as calling inquireClosestMesh() for every point,
+   * evaluated as by inquirePositions().
+   *
+   * @param[in] size Number of points.
+   * @param[in] points Coordinates of the points, dimensions entries per point.
+   * @param[in] meshIDs Mesh IDs of the geometries to be considered.
+   * @param[out] positions Positions relative to the closest meshes, see ClosestMesh::position().
+   * @param[out] distances Unsigned distances to the closest meshes.
+   * @param[out] distanceVectors Distance vectors, dimensions entries per point.
+   * @param[out] closestMeshIDs First mesh ID of the closest mesh, -1 if none is found.
+   */
+  void inquireClosestMeshes (
+    int                  size,
+    const double*        points,
+    const std::set<int>& meshIDs,
+    int*                 positions,
+    double*              distances,
+    double*              distanceVectors,
+    int*                 closestMeshIDs );
+
   /**
    * @brief Inquires, whether voxel is inside, outside or on geometry surface
    *
@@ -418,8 +460,8 @@ public:
    *
    * This routine is supposed to be used, when no edge information is available
    * per se. Edges are created on the fly within preCICE. This routine is
-   * significantly slower than the one using edge IDs, since it needs to check,
-   * whether an edge is created already or not.
+   * slower than the one using edge IDs, since it needs to check, whether an
+   * edge is created already or not.
    */
   void setMeshTriangleWithEdges (
     int meshID,
@@ -427,6 +469,51 @@ public:
     int secondVertexID,
     int thirdVertexID );
 
+  /**
+   * @brief Sets several surface mesh edges from vertex IDs.
+   *
+   * Equivalent to calling setMeshEdge() for every edge, but reserves the
+   * required storage at once.
+   *
+   * @param[in] meshID ID of mesh on which the edges live
+   * @param[in] size Number of edges
+   * @param[in] vertexIDs Vertex IDs of the edges, format is (e0v0, e0v1, e1v0, e1v1, ...)
+   * @param[out] edgeIDs IDs of the edges, to be used when setting triangles.
+   */
+  void setMeshEdges (
+    int        meshID,
+    int        size,
+    const int* vertexIDs,
+    int*       edgeIDs );
+
+  /**
+   * @brief Sets several surface mesh triangles from edge IDs.
+   *
+   * @param[in] meshID ID of mesh on which the triangles live
+   * @param[in] size Number of triangles
+   * @param[in] edgeIDs Edge IDs of the triangles, format is (t0e0, t0e1, t0e2, t1e0, ...)
+   */
+  void setMeshTriangles (
+    int        meshID,
+    int        size,
+    const int* edgeIDs );
+
+  /**
+   * @brief Sets several surface mesh triangles from vertex IDs.
+   *
+   * Edges are created on the fly, as in setMeshTriangleWithEdges(). Existing
+   * edges are found by a hash lookup, hence the cost is linear in the number
+   * of triangles.
+   *
+   * @param[in] meshID ID of mesh on which the triangles live
+   * @param[in] size Number of triangles
+   * @param[in] vertexIDs Vertex IDs of the triangles, format is (t0v0, t0v1, t0v2, t1v0, ...)
+   */
+  void setMeshTrianglesWithEdges (
+    int        meshID,
+    int        size,
+    const int* vertexIDs );
+
   /**
    * @brief Sets surface mesh quadrangle from edge IDs.
    */
@@ -442,8 +529,8 @@ public:
    *
    * This routine is supposed to be used, when no edge information is available
    * per se. Edges are created on the fly within preCICE. This routine is
-   * significantly slower than the one using edge IDs, since it needs to check,
-   * whether an edge is created already or not.
+   * slower than the one using edge IDs, since it needs to check, whether an
+   * edge is created already or not.
    */
   void setMeshQuadWithEdges (
     int meshID,
@@ -6,6 +6,7 @@ extern "C" {
 #include "utils/Dimensions.hpp"
 #include <string>
 #include "boost/smart_ptr.hpp"
+#include <set>
 #include <vector>
 
 static precice::impl::SolverInterfaceImpl* impl = nullptr;
@@ -128,6 +129,36 @@ int precicec_getDataID ( const char* dataName, int meshID )
   return impl->getDataID (stringDataName, meshID);
 }
 
+void precicec_inquirePositions
+(
+  int           size,
+  const double* points,
+  int           meshIDsSize,
+  const int*    meshIDs,
+  int*          positions )
+{
+  assertion ( impl != nullptr );
+  std::set<int> ids ( meshIDs, meshIDs + meshIDsSize );
+  impl->inquirePositions ( size, points, ids, positions );
+}
+
+void precicec_inquireClosestMeshes
+(
+  int           size,
+  const double* points,
+  int           meshIDsSize,
+  const int*    meshIDs,
+  int*          positions,
+  double*       distances,
+  double*       distanceVectors,
+  int*          closestMeshIDs )
+{
+  assertion ( impl != nullptr );
+  std::set<int> ids ( meshIDs, meshIDs + meshIDsSize );
+  impl->inquireClosestMeshes ( size, points, ids, positions, distances,
+                               distanceVectors, closestMeshIDs );
+}
+
 int precicec_setMeshVertex
 (
   int           meshID,
@@ -200,6 +231,37 @@ void precicec_setMeshTriangleWithEdges
   impl->setMeshTriangleWithEdges ( meshID, firstVertexID, secondVertexID, thirdVertexID );
 }
 
+void precicec_setMeshEdges
+(
+  int        meshID,
+  int        size,
+  const int* vertexIDs,
+  int*       edgeIDs )
+{
+  assertion ( impl != nullptr );
+  impl->setMeshEdges ( meshID, size, vertexIDs, edgeIDs );
+}
+
+void precicec_setMeshTriangles
+(
+  int        meshID,
+  int        size,
+  const int* edgeIDs )
+{
+  assertion ( impl != nullptr );
+  impl->setMeshTriangles ( meshID, size, edgeIDs );
+}
+
+void precicec_setMeshTrianglesWithEdges
+(
+  int        meshID,
+  int        size,
+  const int* vertexIDs )
+{
+  assertion ( impl != nullptr );
+  impl->setMeshTrianglesWithEdges ( meshID, size, vertexIDs );
+}
+
 void precicec_writeBlockVectorData
 (
   int     dataID,
@@ -91,6 +91,39 @@ int precicec_hasData ( const char* dataName, int meshID );
  */
 int precicec_getDataID ( const char* dataName, int meshID );
 
+/**
+ * @brief Inquires the positions of several points, see SolverInterface::inquirePositions().
+ *
+ * @param size [IN] Number of points.
+ * @param points [IN] Coordinates of the points, dimensions entries per point.
+ * @param meshIDsSize [IN] Number of mesh IDs, 0 to consider all meshes.
+ * @param meshIDs [IN] IDs of the meshes to be considered.
+ * @param positions [OUT] Positions of the points relative to the meshes.
+ */
+void precicec_inquirePositions (
+  int           size,
+  const double* points,
+  int           meshIDsSize,
+  const int*    meshIDs,
+  int*          positions );
+
+/**
+ * @brief Inquires the closest meshes of several points, see SolverInterface::inquireClosestMeshes().
+ *
+ * @param distances [OUT] Unsigned distances to the closest meshes.
+ * @param distanceVectors [OUT] Distance vectors, dimensions entries per point.
+ * @param closestMeshIDs [OUT] First ID of the closest mesh, -1 if none is found.
+ */
+void precicec_inquireClosestMeshes (
+  int           size,
+  const double* points,
+  int           meshIDsSize,
+  const int*    meshIDs,
+  int*          positions,
+  double*       distances,
+  double*       distanceVectors,
+  int*          closestMeshIDs );
+
 int precicec_setMeshVertex (
   int           meshID,
   const double* position );
@@ -130,6 +163,31 @@ void precicec_setMeshTriangleWithEdges (
   int secondVertexID,
   int thirdVertexID );
 
+/**
+ * @brief Sets several edges from vertex ID pairs, see SolverInterface::setMeshEdges().
+ */
+void precicec_setMeshEdges (
+  int        meshID,
+  int        size,
+  const int* vertexIDs,
+  int*       edgeIDs );
+
+/**
+ * @brief Sets several triangles from edge ID triples.
+ */
+void precicec_setMeshTriangles (
+  int        meshID,
+  int        size,
+  const int* edgeIDs );
+
+/**
+ * @brief Sets several triangles from vertex ID triples. Creates missing edges.
+ */
+void precicec_setMeshTrianglesWithEdges (
+  int        meshID,
+  int        size,
+  const int* vertexIDs );
+
 /**
  * @brief Writes vector data values given as block.
  *
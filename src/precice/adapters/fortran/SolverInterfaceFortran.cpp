@@ -1,6 +1,7 @@
 #include "SolverInterfaceFortran.hpp"
 #include "precice/impl/SolverInterfaceImpl.hpp"
 #include <iostream>
+#include <set>
 #include <string>
 
 using namespace std;
@@ -198,6 +199,36 @@ void precicef_get_data_id_
   *dataID = impl->getDataID(stringDataName, *meshID);
 }
 
+void precicef_inquire_positions_
+(
+  const int*    size,
+  const double* points,
+  const int*    meshIDsSize,
+  const int*    meshIDs,
+  int*          positions )
+{
+  assertion(impl != nullptr);
+  std::set<int> ids(meshIDs, meshIDs + *meshIDsSize);
+  impl->inquirePositions(*size, points, ids, positions);
+}
+
+void precicef_inquire_closest_meshes_
+(
+  const int*    size,
+  const double* points,
+  const int*    meshIDsSize,
+  const int*    meshIDs,
+  int*          positions,
+  double*       distances,
+  double*       distanceVectors,
+  int*          closestMeshIDs )
+{
+  assertion(impl != nullptr);
+  std::set<int> ids(meshIDs, meshIDs + *meshIDsSize);
+  impl->inquireClosestMeshes(*size, points, ids, positions, distances,
+                             distanceVectors, closestMeshIDs);
+}
+
 void precicef_set_vertex_
 (
   const int*    meshID,
@@ -252,6 +283,37 @@ void precicef_set_triangle_we_
   impl->setMeshTriangleWithEdges(*meshID, *firstVertexID, *secondVertexID, *thirdVertexID);
 }
 
+void precicef_set_edges_
+(
+  const int* meshID,
+  const int* size,
+  const int* vertexIDs,
+  int*       edgeIDs )
+{
+  assertion(impl != nullptr);
+  impl->setMeshEdges(*meshID, *size, vertexIDs, edgeIDs);
+}
+
+void precicef_set_triangles_
+(
+  const int* meshID,
+  const int* size,
+  const int* edgeIDs )
+{
+  assertion(impl != nullptr);
+  impl->setMeshTriangles(*meshID, *size, edgeIDs);
+}
+
+void precicef_set_triangles_we_
+(
+  const int* meshID,
+  const int* size,
+  const int* vertexIDs )
+{
+  assertion(impl != nullptr);
+  impl->setMeshTrianglesWithEdges(*meshID, *size, vertexIDs);
+}
+
 void precicef_write_bvdata_
 (
   const int* dataID,
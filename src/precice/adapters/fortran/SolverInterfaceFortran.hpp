@@ -214,6 +214,54 @@ void precicef_get_data_id_(
   int*        dataID,
   int         lengthDataName);
 
+/**
+ * @brief See precice::SolverInterface::inquirePositions().
+ *
+ * Fortran syntax:
+ * precicef_inquire_positions(
+ *   INTEGER          size,
+ *   DOUBLE PRECISION points(dim*size),
+ *   INTEGER          meshIDsSize,
+ *   INTEGER          meshIDs(meshIDsSize),
+ *   INTEGER          positions(size) )
+ *
+ * IN:  size, points, meshIDsSize, meshIDs (all meshes, if meshIDsSize is 0)
+ * OUT: positions
+ */
+void precicef_inquire_positions_(
+  const int*    size,
+  const double* points,
+  const int*    meshIDsSize,
+  const int*    meshIDs,
+  int*          positions );
+
+/**
+ * @brief See precice::SolverInterface::inquireClosestMeshes().
+ *
+ * Fortran syntax:
+ * precicef_inquire_closest_meshes(
+ *   INTEGER          size,
+ *   DOUBLE PRECISION points(dim*size),
+ *   INTEGER          meshIDsSize,
+ *   INTEGER          meshIDs(meshIDsSize),
+ *   INTEGER          positions(size),
+ *   DOUBLE PRECISION distances(size),
+ *   DOUBLE PRECISION distanceVectors(dim*size),
+ *   INTEGER          closestMeshIDs(size) )
+ *
+ * IN:  size, points, meshIDsSize, meshIDs (all meshes, if meshIDsSize is 0)
+ * OUT: positions, distances, distanceVectors, closestMeshIDs
+ */
+void precicef_inquire_closest_meshes_(
+  const int*    size,
+  const double* points,
+  const int*    meshIDsSize,
+  const int*    meshIDs,
+  int*          positions,
+  double*       distances,
+  double*       distanceVectors,
+  int*          closestMeshIDs );
+
 /**
  * @brief See precice::SolverInterface::setMeshVertex().
  *
@@ -308,6 +356,59 @@ void precicef_set_triangle_we_(
   const int* secondVertexID,
   const int* thirdVertexID );
 
+/**
+ * @brief See precice::SolverInterface::setMeshEdges().
+ *
+ * Fortran syntax:
+ * precicef_set_edges(
+ *   INTEGER meshID,
+ *   INTEGER size,
+ *   INTEGER vertexIDs(2*size),
+ *   INTEGER edgeIDs(size) )
+ *
+ * IN:  meshID, size, vertexIDs
+ * OUT: edgeIDs
+ */
+void precicef_set_edges_(
+  const int* meshID,
+  const int* size,
+  const int* vertexIDs,
+  int*       edgeIDs );
+
+/**
+ * @brief See precice::SolverInterface::setMeshTriangles().
+ *
+ * Fortran syntax:
+ * precicef_set_triangles(
+ *   INTEGER meshID,
+ *   INTEGER size,
+ *   INTEGER edgeIDs(3*size) )
+ *
+ * IN:  meshID, size, edgeIDs
+ * OUT: -
+ */
+void precicef_set_triangles_(
+  const int* meshID,
+  const int* size,
+  const int* edgeIDs );
+
+/**
+ * @brief See precice::SolverInterface::setMeshTrianglesWithEdges().
+ *
+ * Fortran syntax:
+ * precicef_set_triangles_we(
+ *   INTEGER meshID,
+ *   INTEGER size,
+ *   INTEGER vertexIDs(3*size) )
+ *
+ * IN:  meshID, size, vertexIDs
+ * OUT: -
+ */
+void precicef_set_triangles_we_(
+  const int* meshID,
+  const int* size,
+  const int* vertexIDs );
+
 /**
  * @brief See precice::SolverInterface::writeBlockVectorData.
  *
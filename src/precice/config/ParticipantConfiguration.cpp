@@ -739,8 +739,15 @@ void ParticipantConfiguration:: finishParticipantConfiguration
   for (io::ExportContext& context : _exportConfig->exportContexts()){
     io::PtrExport exporter;
     if (context.type == VALUE_VTK){
-      if(_participants.back()->useMaster()){
-        exporter = io::PtrExport(new io::ExportVTKXML(context.plotNormals));
+      if(_participants.back()->useMaster() || context.format != "ascii"){
+        io::ExportVTKXML::Format format = io::ExportVTKXML::ASCII;
+        if (context.format == "binary"){
+          format = io::ExportVTKXML::BINARY;
+        }
+        else if (context.format == "compressed"){
+          format = io::ExportVTKXML::COMPRESSED;
+        }
+        exporter = io::PtrExport(new io::ExportVTKXML(context.plotNormals, format));
       }
       else{
         exporter = io::PtrExport(new io::ExportVTK(context.plotNormals));
@@ -29,10 +29,16 @@ SolverInterfaceConfiguration:: SolverInterfaceConfiguration
   ATTR_DIMENSIONS("dimensions"),
   ATTR_GEOMETRY_MODE("geometry-mode"),
   ATTR_RESTART_MODE("restart-mode"),
+  ATTR_SYNC_MODE("sync-mode"),
+  ATTR_TRACE("trace"),
+  ATTR_THREADS("threads"),
   ATTR_SPACETREE_NAME("name"),
   _dimensions(-1),
   _geometryMode(false),
   _restartMode(false),
+  _syncMode(false),
+  _trace(false),
+  _threads(1),
   //_participants(),
   //_indexAccessor(-1),
   _dataConfiguration(),
@@ -72,6 +78,30 @@ SolverInterfaceConfiguration:: SolverInterfaceConfiguration
   attrRestartMode.setDefaultValue(false);
   tag.addAttribute(attrRestartMode);
 
+  XMLAttribute<bool> attrSyncMode(ATTR_SYNC_MODE);
+  doc = "If sync-mode is activated, the processes of a participant are synchronized ";
+  doc += "before and after time measurements of performance critical sections. ";
+  doc += "This gives more meaningful timings, but slows down the simulation.";
+  attrSyncMode.setDocumentation(doc);
+  attrSyncMode.setDefaultValue(false);
+  tag.addAttribute(attrSyncMode);
+
+  XMLAttribute<bool> attrTrace(ATTR_TRACE);
+  doc = "If trace is activated, every rank records all time measurements and writes ";
+  doc += "them at the end of the simulation to EventTrace-<participant>-<rank>.json, ";
+  doc += "which can be viewed with Chrome's about:tracing.";
+  attrTrace.setDocumentation(doc);
+  attrTrace.setDefaultValue(false);
+  tag.addAttribute(attrTrace);
+
+  XMLAttribute<int> attrThreads(ATTR_THREADS);
+  doc = "Number of threads per process used for batched geometry queries and for ";
+  doc += "nearest-neighbor and nearest-projection mappings. ";
+  doc += "A value of 0 uses one thread per hardware thread.";
+  attrThreads.setDocumentation(doc);
+  attrThreads.setDefaultValue(1);
+  tag.addAttribute(attrThreads);
+
   _dataConfiguration = mesh::PtrDataConfiguration (
       new mesh::DataConfiguration(tag) );
   _meshConfiguration = mesh::PtrMeshConfiguration (
@@ -101,6 +131,12 @@ void SolverInterfaceConfiguration:: xmlTagCallback
     _dimensions = tag.getIntAttributeValue(ATTR_DIMENSIONS);
     _geometryMode = tag.getBooleanAttributeValue(ATTR_GEOMETRY_MODE);
     _restartMode = tag.getBooleanAttributeValue(ATTR_RESTART_MODE);
+    _syncMode = tag.getBooleanAttributeValue(ATTR_SYNC_MODE);
+    _trace = tag.getBooleanAttributeValue(ATTR_TRACE);
+    _threads = tag.getIntAttributeValue(ATTR_THREADS);
+    preciceCheck(_threads >= 0, "xmlTagCallback()",
+                 "Attribute \"" << ATTR_THREADS << "\" of tag <" << TAG
+                 << "> must not be negative");
     _dataConfiguration->setDimensions(_dimensions);
     _meshConfiguration->setDimensions(_dimensions);
     _geometryConfiguration->setDimensions(_dimensions);
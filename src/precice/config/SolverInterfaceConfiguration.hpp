@@ -76,6 +76,30 @@ public:
     return _restartMode;
   }
 
+  /**
+   * @brief Returns true if processes are synchronized for time measurements.
+   */
+  bool isSyncMode() const
+  {
+    return _syncMode;
+  }
+
+  /**
+   * @brief Returns true if all time measurements are written to a trace file.
+   */
+  bool isTrace() const
+  {
+    return _trace;
+  }
+
+  /**
+   * @brief Returns the number of threads per process, 0 for one per hardware thread.
+   */
+  int getThreads() const
+  {
+    return _threads;
+  }
+
   const mesh::PtrDataConfiguration getDataConfiguration() const
   {
     return _dataConfiguration;
@@ -148,6 +172,9 @@ private:
   const std::string ATTR_DIMENSIONS;
   const std::string ATTR_GEOMETRY_MODE;
   const std::string ATTR_RESTART_MODE;
+  const std::string ATTR_SYNC_MODE;
+  const std::string ATTR_TRACE;
+  const std::string ATTR_THREADS;
   const std::string ATTR_SPACETREE_NAME;
 
   // @brief Spatial dimension of problem to be solved. Either 2 or 3.
@@ -159,6 +186,15 @@ private:
   // @brief True, if the coupled simulation is started from a checkpoint.
   bool _restartMode;
 
+  // @brief True, if processes are synchronized for time measurements.
+  bool _syncMode;
+
+  // @brief True, if all time measurements are written to a trace file.
+  bool _trace;
+
+  // @brief Number of threads per process, 0 for one per hardware thread.
+  int _threads;
+
   // @brief Participating solvers in the coupled simulation.
   //std::vector<impl::PtrParticipant> _participants;
 
@@ -7,8 +7,15 @@
 #include "com/Communication.hpp"
 #include "mapping/Mapping.hpp"
 #include "SharedPointer.hpp"
+#include <memory>
 #include <vector>
 
+namespace precice {
+namespace query {
+  class VertexHash;
+  class ElementIndex;
+}}
+
 namespace precice {
 namespace impl {
 
@@ -22,6 +29,12 @@ struct MeshContext
    // @brief Spacetree accelerating access to geometry data structure.
    spacetree::PtrSpacetree spacetree;
 
+   /// Finds vertices of the mesh by position, created on first use.
+   std::shared_ptr<query::VertexHash> vertexHash;
+
+   /// Finds the elements of the mesh closest to a point, created on first use.
+   std::shared_ptr<query::ElementIndex> elementIndex;
+
    // @brief Data IDs of properties the geometry does posses.
    std::vector<int> associatedData;
 
@@ -56,6 +69,8 @@ struct MeshContext
    :
      mesh (),
      spacetree (),
+     vertexHash (),
+     elementIndex (),
      associatedData (),
      meshRequirement ( mapping::Mapping::UNDEFINED ),
      receiveMeshFrom ( "" ),
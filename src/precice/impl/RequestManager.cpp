@@ -114,6 +114,14 @@ void RequestManager:: handleRequests()
       handleRequestInquireVoxelPosition(rankSender);
       singleRequest = true;
       break;
+    case REQUEST_INQUIRE_POSITIONS:
+      handleRequestInquirePositions(rankSender);
+      singleRequest = true;
+      break;
+    case REQUEST_INQUIRE_CLOSEST_MESHES:
+      handleRequestInquireClosestMeshes(rankSender);
+      singleRequest = true;
+      break;
     case REQUEST_SET_MESH_VERTEX:
       handleRequestSetMeshVertex(rankSender);
       singleRequest = true;
@@ -345,6 +353,42 @@ void RequestManager:: requestInquireClosestMesh
   closest.setDistanceVector(distanceVector);
 }
 
+void RequestManager:: requestInquirePositions
+(
+  int                  size,
+  const double*        points,
+  const std::set<int>& meshIDs,
+  int*                 positions )
+{
+  TRACE(size, meshIDs.size());
+  _com->send(REQUEST_INQUIRE_POSITIONS, 0);
+  _com->send(size, 0);
+  _com->send(const_cast<double*>(points), size*_interface.getDimensions(), 0);
+  sendMeshIDs(meshIDs);
+  _com->receive(positions, size, 0);
+}
+
+void RequestManager:: requestInquireClosestMeshes
+(
+  int                  size,
+  const double*        points,
+  const std::set<int>& meshIDs,
+  int*                 positions,
+  double*              distances,
+  double*              distanceVectors,
+  int*                 closestMeshIDs )
+{
+  TRACE(size, meshIDs.size());
+  _com->send(REQUEST_INQUIRE_CLOSEST_MESHES, 0);
+  _com->send(size, 0);
+  _com->send(const_cast<double*>(points), size*_interface.getDimensions(), 0);
+  sendMeshIDs(meshIDs);
+  _com->receive(positions, size, 0);
+  _com->receive(distances, size, 0);
+  _com->receive(distanceVectors, size*_interface.getDimensions(), 0);
+  _com->receive(closestMeshIDs, size, 0);
+}
+
 void RequestManager:: requestInquireVoxelPosition
 (
   Eigen::VectorXd&     voxelCenter,
@@ -797,6 +841,48 @@ void RequestManager:: handleRequestInquireClosestMesh
   _com->send(distanceVector, _interface.getDimensions(), rankSender);
 }
 
+void RequestManager:: handleRequestInquirePositions
+(
+  int rankSender )
+{
+  TRACE(rankSender);
+  int size = -1;
+  _com->receive(size, rankSender);
+  assertion(size > 0, size);
+  std::vector<double> points(size*_interface.getDimensions());
+  _com->receive(points.data(), size*_interface.getDimensions(), rankSender);
+  std::set<int> meshIDs = receiveMeshIDs(rankSender);
+
+  std::vector<int> positions(size);
+  _interface.inquirePositions(size, points.data(), meshIDs, positions.data());
+  _com->send(positions.data(), size, rankSender);
+}
+
+void RequestManager:: handleRequestInquireClosestMeshes
+(
+  int rankSender )
+{
+  TRACE(rankSender);
+  int size = -1;
+  _com->receive(size, rankSender);
+  assertion(size > 0, size);
+  std::vector<double> points(size*_interface.getDimensions());
+  _com->receive(points.data(), size*_interface.getDimensions(), rankSender);
+  std::set<int> meshIDs = receiveMeshIDs(rankSender);
+
+  std::vector<int> positions(size);
+  std::vector<double> distances(size);
+  std::vector<double> distanceVectors(size*_interface.getDimensions());
+  std::vector<int> closestMeshIDs(size);
+  _interface.inquireClosestMeshes(size, points.data(), meshIDs, positions.data(),
+                                  distances.data(), distanceVectors.data(),
+                                  closestMeshIDs.data());
+  _com->send(positions.data(), size, rankSender);
+  _com->send(distances.data(), size, rankSender);
+  _com->send(distanceVectors.data(), size*_interface.getDimensions(), rankSender);
+  _com->send(closestMeshIDs.data(), size, rankSender);
+}
+
 void RequestManager:: handleRequestInquireVoxelPosition
 (
   int rankSender )
@@ -1164,5 +1250,29 @@ void RequestManager:: handleRequestExportMesh
   _interface.exportMesh(filenameSuffix, exportType);
 }
 
+void RequestManager:: sendMeshIDs
+(
+  const std::set<int>& meshIDs )
+{
+  std::vector<int> ids(meshIDs.begin(), meshIDs.end());
+  _com->send((int)ids.size(), 0);
+  if (not ids.empty()){
+    _com->send(ids.data(), (int)ids.size(), 0);
+  }
+}
+
+std::set<int> RequestManager:: receiveMeshIDs
+(
+  int rankSender )
+{
+  int size = -1;
+  _com->receive(size, rankSender);
+  assertion(size >= 0, size);
+  std::vector<int> ids(size);
+  if (size > 0){
+    _com->receive(ids.data(), size, rankSender);
+  }
+  return std::set<int>(ids.begin(), ids.end());
+}
 
 }} // namespace precice, impl
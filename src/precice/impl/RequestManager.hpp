@@ -79,6 +79,27 @@ public:
     const std::set<int>& meshIDs,
     ClosestMesh&         closest );
 
+  /**
+   * @brief Requests inquire positions of several points from server, by one request.
+   */
+  void requestInquirePositions (
+    int                  size,
+    const double*        points,
+    const std::set<int>& meshIDs,
+    int*                 positions );
+
+  /**
+   * @brief Requests inquire closest meshes of several points from server, by one request.
+   */
+  void requestInquireClosestMeshes (
+    int                  size,
+    const double*        points,
+    const std::set<int>& meshIDs,
+    int*                 positions,
+    double*              distances,
+    double*              distanceVectors,
+    int*                 closestMeshIDs );
+
   /**
    * @brief Requests inquire voxel position from server.
    */
@@ -278,6 +299,8 @@ private:
     REQUEST_INQUIRE_POSITION,
     REQUEST_INQUIRE_CLOSEST_MESH,
     REQUEST_INQUIRE_VOXEL_POSITION,
+    REQUEST_INQUIRE_POSITIONS,
+    REQUEST_INQUIRE_CLOSEST_MESHES,
     REQUEST_SET_MESH_VERTEX,
     REQUEST_GET_MESH_VERTEX_SIZE,
     REQUEST_RESET_MESH,
@@ -353,6 +376,22 @@ private:
    */
   void handleRequestInquireVoxelPosition ( int rankSender );
 
+  /**
+   * @brief Handles request inquire positions of several points from client.
+   */
+  void handleRequestInquirePositions ( int rankSender );
+
+  /**
+   * @brief Handles request inquire closest meshes of several points from client.
+   */
+  void handleRequestInquireClosestMeshes ( int rankSender );
+
+  /// Sends the mesh IDs of an inquiry as one array.
+  void sendMeshIDs ( const std::set<int>& meshIDs );
+
+  /// Receives the mesh IDs sent by sendMeshIDs().
+  std::set<int> receiveMeshIDs ( int rankSender );
+
   /**
    * @brief Handles request set mesh vertex from client.
    */
@@ -14,11 +14,13 @@
 #include "mesh/Edge.hpp"
 #include "mesh/Triangle.hpp"
 #include "mesh/Merge.hpp"
-#include "io/ExportVRML.hpp"
+#include "io/Export.hpp"
 #include "io/ExportContext.hpp"
-#include "io/SimulationStateIO.hpp"
+#include "io/Checkpoint.hpp"
+#include "query/ElementIndex.hpp"
 #include "query/FindClosest.hpp"
 #include "query/FindVoxelContent.hpp"
+#include "query/VertexHash.hpp"
 #include "spacetree/config/SpacetreeConfiguration.hpp"
 #include "spacetree/Spacetree.hpp"
 #include "spacetree/ExportSpacetree.hpp"
@@ -45,9 +47,12 @@
 #include "utils/Parallel.hpp"
 #include "utils/Petsc.hpp"
 #include "utils/MasterSlave.hpp"
+#include "utils/Threads.hpp"
 #include "mapping/Mapping.hpp"
 #include <set>
+#include <algorithm>
 #include <cstring>
+#include <limits>
 #include <Eigen/Dense>
 
 #include <signal.h> // used for installing crash handler
@@ -89,9 +94,11 @@ SolverInterfaceImpl:: SolverInterfaceImpl
   _m2ns(),
   _participants(),
   _checkpointTimestepInterval(-1),
-  _checkpointFileName("precice_checkpoint_" + _accessorName),
+  _checkpointFileName("precice_checkpoint_" + _accessorName + "_"
+                      + std::to_string(accessorProcessRank) + ".ckpt"),
   _numberAdvanceCalls(0),
-  _requestManager(nullptr)
+  _requestManager(nullptr),
+  _checkpointWriter()
 {
   CHECK(_accessorProcessRank >= 0, "Accessor process index has to be >= 0!");
   CHECK(_accessorCommunicatorSize >= 0, "Accessor process size has to be >= 0!");
@@ -144,6 +151,9 @@ void SolverInterfaceImpl:: configure
   _dimensions = config.getDimensions();
   _geometryMode = config.isGeometryMode ();
   _restartMode = config.isRestartMode ();
+  utils::EventRegistry::setSyncMode(config.isSyncMode());
+  utils::EventRegistry::setTracing(config.isTrace());
+  utils::Threads::setNumberOfThreads(config.getThreads());
   _accessor = determineAccessingParticipant(config);
 
   CHECK(not (_accessor->useServer() && _accessor->useMaster()), "You cannot use a server and a master.");
@@ -239,7 +249,8 @@ void SolverInterfaceImpl:: configure
 double SolverInterfaceImpl:: initialize()
 {
   TRACE();
-  Event e("initialize", not precice::testMode);
+  static const int eventID = utils::EventRegistry::getID("initialize");
+  Event e(eventID, not precice::testMode);
 
   m2n::PointToPointCommunication::ScopedSetEventNamePrefix ssenp(
       "initialize"
@@ -338,18 +349,20 @@ double SolverInterfaceImpl:: initialize()
     double time = 0.0;
     int timestep = 1;
 
+    io::Checkpoint checkpoint;
     if (_restartMode){
       preciceInfo("initialize()", "Reading simulation state for restart");
-      io::SimulationStateIO stateIO(_checkpointFileName + "_simstate.txt");
-      stateIO.readState(time, timestep, _numberAdvanceCalls);
+      checkpoint.readFile(_checkpointFileName);
+      checkpoint.get("time", time);
+      checkpoint.get("timestep", timestep);
+      checkpoint.get("advancecalls", _numberAdvanceCalls);
     }
 
     _couplingScheme->initialize(time, timestep);
 
     if (_restartMode){
       preciceInfo("initialize()", "Reading coupling scheme state for restart");
-      //io::TXTReader txtReader(_checkpointFileName + "_cplscheme.txt");
-      _couplingScheme->importState(_checkpointFileName);
+      _couplingScheme->importState("cplscheme", checkpoint);
     }
 
     dt = _couplingScheme->getNextTimestepMaxLength();
@@ -371,7 +384,8 @@ double SolverInterfaceImpl:: initialize()
 void SolverInterfaceImpl:: initializeData ()
 {
   preciceTrace("initializeData()" );
-  Event e("initializeData", not precice::testMode);
+  static const int eventID = utils::EventRegistry::getID("initializeData");
+  Event e(eventID, not precice::testMode);
 
   m2n::PointToPointCommunication::ScopedSetEventNamePrefix ssenp(
       "initializeData"
@@ -415,7 +429,8 @@ double SolverInterfaceImpl:: advance
 {
   TRACE(computedTimestepLength);
 
-  Event e("advance", not precice::testMode);
+  static const int eventID = utils::EventRegistry::getID("advance");
+  Event e(eventID, not precice::testMode);
 
   m2n::PointToPointCommunication::ScopedSetEventNamePrefix ssenp(
       "advance"
@@ -560,6 +575,13 @@ void SolverInterfaceImpl:: finalize()
     _accessor->getClientServerCommunication()->closeConnection();
   }
 
+  _checkpointWriter.wait();
+  if (not _clientMode){
+    for (const io::ExportContext& context : _accessor->exportContexts()){
+      context.exporter->wait();
+    }
+  }
+
   // Stop and print Event logging
   precice::utils::EventRegistry::finalize();
   if (not precice::utils::MasterSlave::_slaveMode) {
@@ -567,6 +589,10 @@ void SolverInterfaceImpl:: finalize()
     r.print();
     r.print("EventTimings.log", true);
   }
+  if (precice::utils::EventRegistry::isTracing()) {
+    precice::utils::EventRegistry::writeTrace("EventTrace-" + _accessorName + "-"
+                                              + std::to_string(_accessorProcessRank) + ".json");
+  }
 
   // Tear down MPI and PETSc
   if (not precice::testMode && not _serverMode ) {
@@ -704,43 +730,9 @@ int SolverInterfaceImpl:: inquirePosition
   else {
     std::vector<int> markedContexts(_accessor->usedMeshContexts().size());
     selectInquiryMeshIDs(meshIDs, markedContexts);
-    for (int i=0; i < (int)markedContexts.size(); i++){
-      MeshContext* meshContext = _accessor->usedMeshContexts()[i];
-      if (markedContexts[i] == markedSkip()){
-        DEBUG("Skipping mesh " << meshContext->mesh->getName());
-        continue;
-      }
-      int tempPos = -1;
-      if (markedContexts[i] == markedQuerySpacetree()){
-        assertion(meshContext->spacetree.use_count() > 0);
-        tempPos = meshContext->spacetree->searchPosition(searchPoint);
-      }
-      else {
-        assertion(markedContexts[i] == markedQueryDirectly(), markedContexts[i]);
-        query::FindClosest findClosest(searchPoint);
-        findClosest(*(meshContext->mesh));
-        assertion(findClosest.hasFound());
-        tempPos = positionOnGeometry();
-        if (math::greater(findClosest.getClosest().distance, 0.0)){
-          tempPos = positionOutsideOfGeometry();
-        }
-        else if (math::greater(0.0, findClosest.getClosest().distance)){
-          tempPos = positionInsideOfGeometry();
-        }
-      }
-
-      // Union logic for multiple geometries:
-      if (pos != positionInsideOfGeometry()){
-        if (tempPos == positionOutsideOfGeometry()){
-          if (pos != positionOnGeometry()){
-            pos = tempPos; // set outside of geometry
-          }
-        }
-        else {
-          pos = tempPos; // set inside or on geometry
-        }
-      }
-    }
+    prepareQuery(markedContexts);
+    query::ElementIndex::Buffer buffer;
+    pos = computePosition(searchPoint, markedContexts, buffer);
   }
   DEBUG("Return position = " << pos);
   return pos;
@@ -761,56 +753,98 @@ ClosestMesh SolverInterfaceImpl:: inquireClosestMesh
     _requestManager->requestInquireClosestMesh(searchPoint, meshIDs, closestMesh);
   }
   else {
-    using namespace precice::constants;
     std::vector<int> markedContexts(_accessor->usedMeshContexts().size());
     selectInquiryMeshIDs(meshIDs, markedContexts);
-    closestMesh.setPosition(positionOutsideOfGeometry());
-    //for (MeshContext& meshContext : _accessor->usedMeshContexts()){
-    for (int i=0; i < (int)markedContexts.size(); i++){
-      MeshContext* meshContext = _accessor->usedMeshContexts()[i];
-      if (markedContexts[i] == markedSkip()){
-        DEBUG("Skipping mesh " << meshContext->mesh->getName());
-        continue;
-      }
-      query::FindClosest findClosest(searchPoint);
-      if (markedContexts[i] == markedQuerySpacetree()){
-        assertion(meshContext->spacetree.get() != nullptr);
-        meshContext->spacetree->searchDistance(findClosest);
-      }
-      else {
-        assertion(markedContexts[i] == markedQueryDirectly(), markedContexts[i]);
-        findClosest(*(meshContext->mesh));
-      }
-      assertion(findClosest.hasFound());
-      const query::ClosestElement& element = findClosest.getClosest();
-      if ( element.distance > math::NUMERICAL_ZERO_DIFFERENCE &&
-           closestMesh.position() == positionOutsideOfGeometry() )
-      {
-        if ( closestMesh.distance() > element.distance ) {
-          closestMesh.setDistanceVector ( element.vectorToElement.data() );
-          closestMesh.meshIDs() = element.meshIDs;
-        }
-      }
-      else if ( element.distance < - math::NUMERICAL_ZERO_DIFFERENCE ) {
-        closestMesh.setPosition ( positionInsideOfGeometry() );
-        if ( closestMesh.distance() > std::abs(element.distance) ) {
-          closestMesh.setDistanceVector ( element.vectorToElement.data() );
-          closestMesh.meshIDs() = element.meshIDs;
-        }
-      }
-      else if ( closestMesh.position() != positionInsideOfGeometry() ){
-        closestMesh.setPosition ( positionOnGeometry() );
-        closestMesh.setDistanceVector ( element.vectorToElement.data() );
-        closestMesh.meshIDs() = element.meshIDs;
-      }
-      //if ( _accessor->exportContext().plotNeighbors ){
-      //  _exportVTKNeighbors.addNeighbors ( searchPoint, element );
-      //}
-    }
+    prepareQuery(markedContexts);
+    query::ElementIndex::Buffer buffer;
+    int position = constants::positionOutsideOfGeometry();
+    Eigen::VectorXd distanceVector(_dimensions);
+    computeClosestMesh(searchPoint, markedContexts, buffer, position,
+                       distanceVector.data(), closestMesh.meshIDs());
+    closestMesh.setPosition(position);
+    closestMesh.setDistanceVector(distanceVector.data());
   }
   return closestMesh;
 }
 
+void SolverInterfaceImpl:: inquirePositions
+(
+  int                  size,
+  const double*        points,
+  const std::set<int>& meshIDs,
+  int*                 positions )
+{
+  TRACE(size, meshIDs.size());
+  if (size == 0){
+    return;
+  }
+  if (_clientMode){
+    _requestManager->requestInquirePositions(size, points, meshIDs, positions);
+    return;
+  }
+  std::vector<int> markedContexts(_accessor->usedMeshContexts().size());
+  selectInquiryMeshIDs(meshIDs, markedContexts);
+  bool concurrent = prepareQuery(markedContexts);
+  std::vector<query::ElementIndex::Buffer> buffers(utils::Threads::getNumberOfThreads());
+  auto query = [&](int thread, int begin, int end){
+    Eigen::VectorXd searchPoint(_dimensions);
+    for (int i=begin; i < end; i++){
+      searchPoint = Eigen::Map<const Eigen::VectorXd>(&points[i*_dimensions], _dimensions);
+      positions[i] = computePosition(searchPoint, markedContexts, buffers[thread]);
+    }
+  };
+  if (concurrent){
+    utils::Threads::parallelFor(0, size, query);
+  }
+  else {
+    query(0, 0, size);
+  }
+}
+
+void SolverInterfaceImpl:: inquireClosestMeshes
+(
+  int                  size,
+  const double*        points,
+  const std::set<int>& meshIDs,
+  int*                 positions,
+  double*              distances,
+  double*              distanceVectors,
+  int*                 closestMeshIDs )
+{
+  TRACE(size, meshIDs.size());
+  if (size == 0){
+    return;
+  }
+  if (_clientMode){
+    _requestManager->requestInquireClosestMeshes(size, points, meshIDs, positions,
+                                                 distances, distanceVectors, closestMeshIDs);
+    return;
+  }
+  std::vector<int> markedContexts(_accessor->usedMeshContexts().size());
+  selectInquiryMeshIDs(meshIDs, markedContexts);
+  bool concurrent = prepareQuery(markedContexts);
+  std::vector<query::ElementIndex::Buffer> buffers(utils::Threads::getNumberOfThreads());
+  auto query = [&](int thread, int begin, int end){
+    Eigen::VectorXd searchPoint(_dimensions);
+    std::vector<int> elementMeshIDs;
+    for (int i=begin; i < end; i++){
+      searchPoint = Eigen::Map<const Eigen::VectorXd>(&points[i*_dimensions], _dimensions);
+      double* distanceVector = &distanceVectors[i*_dimensions];
+      elementMeshIDs.clear();
+      computeClosestMesh(searchPoint, markedContexts, buffers[thread], positions[i],
+                         distanceVector, elementMeshIDs);
+      distances[i] = Eigen::Map<Eigen::VectorXd>(distanceVector, _dimensions).norm();
+      closestMeshIDs[i] = elementMeshIDs.empty() ? -1 : elementMeshIDs.front();
+    }
+  };
+  if (concurrent){
+    utils::Threads::parallelFor(0, size, query);
+  }
+  else {
+    query(0, 0, size);
+  }
+}
+
 VoxelPosition SolverInterfaceImpl:: inquireVoxelPosition
 (
   const double*        voxelCenter,
@@ -1007,6 +1041,12 @@ void SolverInterfaceImpl:: resetMesh
 
     DEBUG ( "Clear mesh positions for mesh \"" << context.mesh->getName() << "\"" );
     context.mesh->clear ();
+    if (context.vertexHash){
+      context.vertexHash->clear();
+    }
+    if (context.elementIndex){
+      context.elementIndex->clear();
+    }
   }
 }
 
@@ -1051,6 +1091,7 @@ void SolverInterfaceImpl:: setMeshVertices
     mesh::PtrMesh mesh(context.mesh);
     Eigen::VectorXd internalPosition(_dimensions);
     DEBUG("Set positions");
+    mesh->reserveVertices(mesh->vertices().size() + size);
     for (int i=0; i < size; i++){
       for (int dim=0; dim < _dimensions; dim++){
         internalPosition[dim] = positions[i*_dimensions + dim];
@@ -1103,22 +1144,17 @@ void SolverInterfaceImpl:: getMeshVertexIDsFromPositions (
     MeshContext& context = _accessor->meshContext(meshID);
     mesh::PtrMesh mesh(context.mesh);
     DEBUG("Get IDs");
-    Eigen::VectorXd internalPosition(_dimensions);
+    if (not context.vertexHash){
+      context.vertexHash = std::make_shared<query::VertexHash>(mesh);
+    }
     Eigen::VectorXd position(_dimensions);
     assertion(mesh->vertices().size() <= size, mesh->vertices().size(), size);
     for (size_t i=0; i < size; i++){
       for (int dim=0; dim < _dimensions; dim++){
         position[dim] = positions[i*_dimensions+dim];
       }
-      size_t j=0;
-      for (j=0; j < mesh->vertices().size(); j++){
-        internalPosition = mesh->vertices()[j].getCoords();
-        if (math::equals(internalPosition, position)){
-          ids[i] = j;
-          break;
-        }
-      }
-      CHECK(j < mesh->vertices().size(), "Position " << i << "=" << position << " unknown!");
+      ids[i] = context.vertexHash->getVertexAt(position);
+      CHECK(ids[i] != -1, "Position " << i << "=" << position << " unknown!");
     }
   }
 }
@@ -1224,65 +1260,119 @@ void SolverInterfaceImpl:: setMeshTriangleWithEdges
     vertices[0] = &mesh->vertices()[firstVertexID];
     vertices[1] = &mesh->vertices()[secondVertexID];
     vertices[2] = &mesh->vertices()[thirdVertexID];
-    mesh::Edge* edges[3];
-    edges[0] = nullptr;
-    edges[1] = nullptr;
-    edges[2] = nullptr;
-    for (mesh::Edge& edge : mesh->edges()) {
-      // Check edge 0
-      bool foundEdge = edge.vertex(0).getID() == vertices[0]->getID();
-      foundEdge &= edge.vertex(1).getID() == vertices[1]->getID();
-      if (foundEdge){
-        edges[0] = &edge;
-        continue;
-      }
-      foundEdge = edge.vertex(0).getID() == vertices[1]->getID();
-      foundEdge &= edge.vertex(1).getID() == vertices[0]->getID();
-      if (foundEdge){
-        edges[0] = &edge;
-        continue;
-      }
-
-      // Check edge 1
-      foundEdge = edge.vertex(0).getID() == vertices[1]->getID();
-      foundEdge &= edge.vertex(1).getID() == vertices[2]->getID();
-      if (foundEdge){
-        edges[1] = &edge;
-        continue;
-      }
-      foundEdge = edge.vertex(0).getID() == vertices[2]->getID();
-      foundEdge &= edge.vertex(1).getID() == vertices[1]->getID();
-      if (foundEdge){
-        edges[1] = &edge;
-        continue;
-      }
+    mesh::Edge& e0 = mesh->createUniqueEdge(*vertices[0], *vertices[1]);
+    mesh::Edge& e1 = mesh->createUniqueEdge(*vertices[1], *vertices[2]);
+    mesh::Edge& e2 = mesh->createUniqueEdge(*vertices[2], *vertices[0]);
+    mesh->createTriangle(e0, e1, e2);
+  }
+}
 
-      // Check edge 2
-      foundEdge = edge.vertex(0).getID() == vertices[2]->getID();
-      foundEdge &= edge.vertex(1).getID() == vertices[0]->getID();
-      if (foundEdge){
-        edges[2] = &edge;
-        continue;
-      }
-      foundEdge = edge.vertex(0).getID() == vertices[0]->getID();
-      foundEdge &= edge.vertex(1).getID() == vertices[2]->getID();
-      if (foundEdge){
-        edges[2] = &edge;
-        continue;
-      }
-    }
-    // Create missing edges
-    if (edges[0] == nullptr){
-      edges[0] = & mesh->createEdge(*vertices[0], *vertices[1]);
+void SolverInterfaceImpl:: setMeshEdges
+(
+  int        meshID,
+  int        size,
+  const int* vertexIDs,
+  int*       edgeIDs )
+{
+  TRACE(meshID, size);
+  if (_restartMode){
+    DEBUG("Ignoring edges, since restart mode is active");
+    std::fill(edgeIDs, edgeIDs + size, -1);
+    return;
+  }
+  if (_clientMode){
+    for (int i=0; i < size; i++){
+      edgeIDs[i] = _requestManager->requestSetMeshEdge(meshID, vertexIDs[2*i], vertexIDs[2*i+1]);
     }
-    if (edges[1] == nullptr){
-      edges[1] = & mesh->createEdge(*vertices[1], *vertices[2]);
+    return;
+  }
+  MeshContext& context = _accessor->meshContext(meshID);
+  if (context.meshRequirement != mapping::Mapping::FULL){
+    std::fill(edgeIDs, edgeIDs + size, -1);
+    return;
+  }
+  mesh::PtrMesh& mesh = context.mesh;
+  mesh::Mesh::VertexContainer& vertices = mesh->vertices();
+  mesh->reserveEdges(mesh->edges().size() + size);
+  for (int i=0; i < size; i++){
+    assertion(vertexIDs[2*i] >= 0 && vertexIDs[2*i] < (int) vertices.size(),
+              i, vertexIDs[2*i], vertices.size());
+    assertion(vertexIDs[2*i+1] >= 0 && vertexIDs[2*i+1] < (int) vertices.size(),
+              i, vertexIDs[2*i+1], vertices.size());
+    mesh::Vertex& v0 = vertices[vertexIDs[2*i]];
+    mesh::Vertex& v1 = vertices[vertexIDs[2*i+1]];
+    edgeIDs[i] = mesh->createEdge(v0, v1).getID();
+  }
+}
+
+void SolverInterfaceImpl:: setMeshTriangles
+(
+  int        meshID,
+  int        size,
+  const int* edgeIDs )
+{
+  TRACE(meshID, size);
+  if (_restartMode){
+    DEBUG("Ignoring triangles, since restart mode is active");
+    return;
+  }
+  if (_clientMode){
+    for (int i=0; i < size; i++){
+      _requestManager->requestSetMeshTriangle(meshID, edgeIDs[3*i], edgeIDs[3*i+1], edgeIDs[3*i+2]);
     }
-    if (edges[2] == nullptr){
-      edges[2] = & mesh->createEdge(*vertices[2], *vertices[0]);
+    return;
+  }
+  MeshContext& context = _accessor->meshContext(meshID);
+  if (context.meshRequirement != mapping::Mapping::FULL){
+    return;
+  }
+  mesh::PtrMesh& mesh = context.mesh;
+  mesh::Mesh::EdgeContainer& edges = mesh->edges();
+  mesh->reserveTriangles(mesh->triangles().size() + size);
+  for (int i=0; i < size; i++){
+    const int* ids = &edgeIDs[3*i];
+    for (int j=0; j < 3; j++){
+      assertion(ids[j] >= 0 && ids[j] < (int) edges.size(), i, ids[j], edges.size());
     }
+    mesh->createTriangle(edges[ids[0]], edges[ids[1]], edges[ids[2]]);
+  }
+}
 
-    mesh->createTriangle(*edges[0], *edges[1], *edges[2]);
+void SolverInterfaceImpl:: setMeshTrianglesWithEdges
+(
+  int        meshID,
+  int        size,
+  const int* vertexIDs )
+{
+  TRACE(meshID, size);
+  if (_clientMode){
+    for (int i=0; i < size; i++){
+      _requestManager->requestSetMeshTriangleWithEdges(meshID, vertexIDs[3*i],
+                                                       vertexIDs[3*i+1], vertexIDs[3*i+2]);
+    }
+    return;
+  }
+  MeshContext& context = _accessor->meshContext(meshID);
+  if (context.meshRequirement != mapping::Mapping::FULL){
+    return;
+  }
+  mesh::PtrMesh& mesh = context.mesh;
+  mesh::Mesh::VertexContainer& vertices = mesh->vertices();
+  // A closed triangulated surface has 1.5 edges per triangle
+  mesh->reserveEdges(mesh->edges().size() + (3 * size + 1) / 2);
+  mesh->reserveTriangles(mesh->triangles().size() + size);
+  for (int i=0; i < size; i++){
+    const int* ids = &vertexIDs[3*i];
+    for (int j=0; j < 3; j++){
+      assertion(ids[j] >= 0 && ids[j] < (int) vertices.size(), i, ids[j], vertices.size());
+    }
+    mesh::Vertex& v0 = vertices[ids[0]];
+    mesh::Vertex& v1 = vertices[ids[1]];
+    mesh::Vertex& v2 = vertices[ids[2]];
+    mesh::Edge& e0 = mesh->createUniqueEdge(v0, v1);
+    mesh::Edge& e1 = mesh->createUniqueEdge(v1, v2);
+    mesh::Edge& e2 = mesh->createUniqueEdge(v2, v0);
+    mesh->createTriangle(e0, e1, e2);
   }
 }
 
@@ -1360,83 +1450,11 @@ void SolverInterfaceImpl:: setMeshQuadWithEdges
     vertices[1] = &mesh->vertices()[secondVertexID];
     vertices[2] = &mesh->vertices()[thirdVertexID];
     vertices[3] = &mesh->vertices()[fourthVertexID];
-    mesh::Edge* edges[4];
-    edges[0] = nullptr;
-    edges[1] = nullptr;
-    edges[2] = nullptr;
-    edges[3] = nullptr;
-    for (mesh::Edge& edge : mesh->edges()) {
-      // Check edge 0
-      bool foundEdge = edge.vertex(0).getID() == vertices[0]->getID();
-      foundEdge &= edge.vertex(1).getID() == vertices[1]->getID();
-      if ( foundEdge ){
-        edges[0] = &edge;
-        continue;
-      }
-      foundEdge = edge.vertex(0).getID() == vertices[1]->getID();
-      foundEdge &= edge.vertex(1).getID() == vertices[0]->getID();
-      if (foundEdge){
-        edges[0] = &edge;
-        continue;
-      }
-
-      // Check edge 1
-      foundEdge = edge.vertex(0).getID() == vertices[1]->getID();
-      foundEdge &= edge.vertex(1).getID() == vertices[2]->getID();
-      if ( foundEdge ){
-        edges[1] = &edge;
-        continue;
-      }
-      foundEdge = edge.vertex(0).getID() == vertices[2]->getID();
-      foundEdge &= edge.vertex(1).getID() == vertices[1]->getID();
-      if ( foundEdge ){
-        edges[1] = &edge;
-        continue;
-      }
-
-      // Check edge 2
-      foundEdge = edge.vertex(0).getID() == vertices[2]->getID();
-      foundEdge &= edge.vertex(1).getID() == vertices[3]->getID();
-      if ( foundEdge ){
-        edges[2] = &edge;
-        continue;
-      }
-      foundEdge = edge.vertex(0).getID() == vertices[3]->getID();
-      foundEdge &= edge.vertex(1).getID() == vertices[2]->getID();
-      if ( foundEdge ){
-        edges[2] = &edge;
-        continue;
-      }
-
-      // Check edge 3
-      foundEdge = edge.vertex(0).getID() == vertices[3]->getID();
-      foundEdge &= edge.vertex(1).getID() == vertices[0]->getID();
-      if ( foundEdge ){
-        edges[3] = &edge;
-        continue;
-      }
-      foundEdge = edge.vertex(0).getID() == vertices[0]->getID();
-      foundEdge &= edge.vertex(1).getID() == vertices[3]->getID();
-      if ( foundEdge ){
-        edges[3] = &edge;
-        continue;
-      }
-    }
-    // Create missing edges
-    if (edges[0] == nullptr){
-      edges[0] = & mesh->createEdge(*vertices[0], *vertices[1]);
-    }
-    if (edges[1] == nullptr){
-      edges[1] = & mesh->createEdge(*vertices[1], *vertices[2]);
-    }
-    if (edges[2] == nullptr){
-      edges[2] = & mesh->createEdge(*vertices[2], *vertices[3]);
-    }
-    if (edges[3] == nullptr){
-      edges[3] = & mesh->createEdge(*vertices[3], *vertices[0]);
-    }
-
-    mesh->createQuad(*edges[0], *edges[1], *edges[2], *edges[3]);
+    mesh::Edge& e0 = mesh->createUniqueEdge(*vertices[0], *vertices[1]);
+    mesh::Edge& e1 = mesh->createUniqueEdge(*vertices[1], *vertices[2]);
+    mesh::Edge& e2 = mesh->createUniqueEdge(*vertices[2], *vertices[3]);
+    mesh::Edge& e3 = mesh->createUniqueEdge(*vertices[3], *vertices[0]);
+    mesh->createQuad(e0, e1, e2, e3);
   }
 }
 
@@ -1951,13 +1969,11 @@ void SolverInterfaceImpl:: prepareGeometry
   assertion ( not _clientMode );
   mesh::PtrMesh mesh = meshContext.mesh;
   assertion(mesh.use_count() > 0);
-  std::string meshName(mesh->getName());
   if (_restartMode){
-    std::string fileName("precice_checkpoint_" + _accessorName + "_" + meshName);
     DEBUG("Importing geometry = " << mesh->getName());
     geometry::ImportGeometry* importGeo = new geometry::ImportGeometry (
-      Eigen::VectorXd::Zero(_dimensions), fileName,
-      geometry::ImportGeometry::VRML_1_FILE, true, not meshContext.provideMesh);
+      Eigen::VectorXd::Zero(_dimensions), _checkpointFileName,
+      geometry::ImportGeometry::CHECKPOINT_FILE, true, not meshContext.provideMesh);
     meshContext.geometry.reset(importGeo);
   }
   else if ( (not _geometryMode) && (meshContext.geometry.use_count() > 0) ){
@@ -2168,24 +2184,20 @@ void SolverInterfaceImpl:: handleExports()
       watchPoint->exportPointData(_couplingScheme->getTime());
     }
 
-    if(not utils::MasterSlave::_slaveMode){ //TODO not yet supported
-      // Checkpointing
-      int checkpointingInterval = _couplingScheme->getCheckpointTimestepInterval();
-      if ((checkpointingInterval != -1) && (timesteps % checkpointingInterval == 0)){
-        DEBUG("Set require checkpoint");
-        _couplingScheme->requireAction(constants::actionWriteSimulationCheckpoint());
-        for (const MeshContext* meshContext : _accessor->usedMeshContexts()) {
-          io::ExportVRML exportVRML(false);
-          std::string filename("precice_checkpoint_" + _accessorName
-                               + "_" + meshContext->mesh->getName());
-          exportVRML.doExportCheckpoint(filename, *(meshContext->mesh));
-        }
-        io::SimulationStateIO exportState(_checkpointFileName + "_simstate.txt");
-
-        exportState.writeState(_couplingScheme->getTime(),_couplingScheme->getTimesteps(), _numberAdvanceCalls);
-        //io::TXTWriter exportCouplingSchemeState(_checkpointFileName + "_cplscheme.txt");
-        _couplingScheme->exportState(_checkpointFileName);
+    // Checkpointing, every rank takes a snapshot of its part and writes it in the background
+    int checkpointingInterval = _couplingScheme->getCheckpointTimestepInterval();
+    if ((checkpointingInterval != -1) && (timesteps % checkpointingInterval == 0)){
+      DEBUG("Set require checkpoint");
+      _couplingScheme->requireAction(constants::actionWriteSimulationCheckpoint());
+      io::Checkpoint checkpoint;
+      for (const MeshContext* meshContext : _accessor->usedMeshContexts()) {
+        checkpoint.addMesh(*(meshContext->mesh));
       }
+      checkpoint.add("time", _couplingScheme->getTime());
+      checkpoint.add("timestep", (long int) _couplingScheme->getTimesteps());
+      checkpoint.add("advancecalls", _numberAdvanceCalls);
+      _couplingScheme->exportState("cplscheme", checkpoint);
+      _checkpointWriter.write(_checkpointFileName, std::move(checkpoint));
     }
   }
 }
@@ -2231,6 +2243,132 @@ PtrParticipant SolverInterfaceImpl:: determineAccessingParticipant
   ERROR("Accessing participant \"" << _accessorName << "\" is not defined in configuration!");
 }
 
+bool SolverInterfaceImpl:: prepareQuery
+(
+  const std::vector<int>& markedContexts )
+{
+  TRACE();
+  bool concurrent = true;
+  for (int i=0; i < (int)markedContexts.size(); i++){
+    MeshContext* meshContext = _accessor->usedMeshContexts()[i];
+    if (markedContexts[i] == markedQuerySpacetree()){
+      assertion(meshContext->spacetree.get() != nullptr);
+      concurrent &= meshContext->spacetree->prepareConcurrentSearch();
+    }
+    else if (markedContexts[i] == markedQueryDirectly()){
+      if (not meshContext->elementIndex){
+        meshContext->elementIndex = std::make_shared<query::ElementIndex>(meshContext->mesh);
+      }
+      meshContext->elementIndex->update();
+    }
+  }
+  DEBUG("Query " << (concurrent ? "on several threads" : "serially"));
+  return concurrent;
+}
+
+int SolverInterfaceImpl:: computePosition
+(
+  const Eigen::VectorXd&       searchPoint,
+  const std::vector<int>&      markedContexts,
+  query::ElementIndex::Buffer& buffer )
+{
+  using namespace precice::constants;
+  int pos = positionOutsideOfGeometry();
+  for (int i=0; i < (int)markedContexts.size(); i++){
+    MeshContext* meshContext = _accessor->usedMeshContexts()[i];
+    if (markedContexts[i] == markedSkip()){
+      DEBUG("Skipping mesh " << meshContext->mesh->getName());
+      continue;
+    }
+    int tempPos = -1;
+    if (markedContexts[i] == markedQuerySpacetree()){
+      assertion(meshContext->spacetree.use_count() > 0);
+      tempPos = meshContext->spacetree->searchPosition(searchPoint);
+    }
+    else {
+      assertion(markedContexts[i] == markedQueryDirectly(), markedContexts[i]);
+      assertion(meshContext->elementIndex.get() != nullptr);
+      query::FindClosest findClosest(searchPoint);
+      findClosest(meshContext->elementIndex->getCandidates(searchPoint, buffer));
+      assertion(findClosest.hasFound());
+      tempPos = positionOnGeometry();
+      if (math::greater(findClosest.getClosest().distance, 0.0)){
+        tempPos = positionOutsideOfGeometry();
+      }
+      else if (math::greater(0.0, findClosest.getClosest().distance)){
+        tempPos = positionInsideOfGeometry();
+      }
+    }
+
+    // Union logic for multiple geometries:
+    if (pos != positionInsideOfGeometry()){
+      if (tempPos == positionOutsideOfGeometry()){
+        if (pos != positionOnGeometry()){
+          pos = tempPos; // set outside of geometry
+        }
+      }
+      else {
+        pos = tempPos; // set inside or on geometry
+      }
+    }
+  }
+  return pos;
+}
+
+void SolverInterfaceImpl:: computeClosestMesh
+(
+  const Eigen::VectorXd&       searchPoint,
+  const std::vector<int>&      markedContexts,
+  query::ElementIndex::Buffer& buffer,
+  int&                         position,
+  double*                      distanceVector,
+  std::vector<int>&            closestMeshIDs )
+{
+  using namespace precice::constants;
+  Eigen::Map<Eigen::VectorXd> closestVector(distanceVector, _dimensions);
+  closestVector.setConstant(std::numeric_limits<double>::max());
+  position = positionOutsideOfGeometry();
+  for (int i=0; i < (int)markedContexts.size(); i++){
+    MeshContext* meshContext = _accessor->usedMeshContexts()[i];
+    if (markedContexts[i] == markedSkip()){
+      DEBUG("Skipping mesh " << meshContext->mesh->getName());
+      continue;
+    }
+    query::FindClosest findClosest(searchPoint);
+    if (markedContexts[i] == markedQuerySpacetree()){
+      assertion(meshContext->spacetree.get() != nullptr);
+      meshContext->spacetree->searchDistance(findClosest);
+    }
+    else {
+      assertion(markedContexts[i] == markedQueryDirectly(), markedContexts[i]);
+      assertion(meshContext->elementIndex.get() != nullptr);
+      findClosest(meshContext->elementIndex->getCandidates(searchPoint, buffer));
+    }
+    assertion(findClosest.hasFound());
+    const query::ClosestElement& element = findClosest.getClosest();
+    if ( element.distance > math::NUMERICAL_ZERO_DIFFERENCE &&
+         position == positionOutsideOfGeometry() )
+    {
+      if ( closestVector.norm() > element.distance ) {
+        closestVector = element.vectorToElement;
+        closestMeshIDs = element.meshIDs;
+      }
+    }
+    else if ( element.distance < - math::NUMERICAL_ZERO_DIFFERENCE ) {
+      position = positionInsideOfGeometry();
+      if ( closestVector.norm() > std::abs(element.distance) ) {
+        closestVector = element.vectorToElement;
+        closestMeshIDs = element.meshIDs;
+      }
+    }
+    else if ( position != positionInsideOfGeometry() ){
+      position = positionOnGeometry();
+      closestVector = element.vectorToElement;
+      closestMeshIDs = element.meshIDs;
+    }
+  }
+}
+
 void SolverInterfaceImpl:: selectInquiryMeshIDs
 (
   const std::set<int>& meshIDs,
@@ -9,11 +9,15 @@
 #include "action/Action.hpp"
 #include "boost/noncopyable.hpp"
 #include "io/Constants.hpp"
+#include "io/CheckpointWriter.hpp"
 #include "query/ExportVTKNeighbors.hpp"
+#include "query/ElementIndex.hpp"
 #include "cplscheme/SharedPointer.hpp"
 #include "com/Communication.hpp"
 #include "m2n/M2N.hpp"
 #include "m2n/config/M2NConfiguration.hpp"
+#include <Eigen/Core>
+#include <memory>
 #include <string>
 #include <vector>
 #include <set>
@@ -249,6 +253,48 @@ public:
     const double*        point,
     const std::set<int>& meshIDs );
 
+  /**
+   * @brief Find out positions of several points relative to geometries.
+   *
+   * Gives the same results as inquirePosition() for every point. The points
+   * are queried in one pass, which is split over utils::Threads, if all used
+   * spacetrees allow for concurrent searches. In client mode, all points are
+   * sent to the server by one request.
+   *
+   * @param size      [IN] Number of points.
+   * @param points    [IN] Coordinates of the points, dimensions entries per point.
+   * @param meshIDs   [IN] Mesh IDs of the geometries to be considered.
+   * @param positions [OUT] Position IDs of the points (see precice::constants::positionXYZ()).
+   */
+  void inquirePositions (
+    int                  size,
+    const double*        points,
+    const std::set<int>& meshIDs,
+    int*                 positions );
+
+  /**
+   * @brief Find out, which geometry is closest to each of several points.
+   *
+   * Gives the same results as inquireClosestMesh() for every point, queried
+   * as in inquirePositions().
+   *
+   * @param size            [IN] Number of points.
+   * @param points          [IN] Coordinates of the points, dimensions entries per point.
+   * @param meshIDs         [IN] Mesh IDs of the geometries to be considered.
+   * @param positions       [OUT] Positions relative to the closest meshes.
+   * @param distances       [OUT] Unsigned distances to the closest meshes.
+   * @param distanceVectors [OUT] Distance vectors to the closest meshes, dimensions entries per point.
+   * @param closestMeshIDs  [OUT] First mesh ID of the closest element, -1 if none is found.
+   */
+  void inquireClosestMeshes (
+    int                  size,
+    const double*        points,
+    const std::set<int>& meshIDs,
+    int*                 positions,
+    double*              distances,
+    double*              distanceVectors,
+    int*                 closestMeshIDs );
+
   /**
    * @brief Inquires, whether voxel is inside, outside or on geometry surface
    *
@@ -353,6 +399,38 @@ public:
     int secondVertexID,
     int thirdVertexID );
 
+  /**
+   * @brief Sets several edges of a solver mesh.
+   *
+   * @param vertexIDs [IN] Vertex ID pairs (v0,v1,v0,v1,...) of the edges.
+   * @param edgeIDs [OUT] IDs of the edges, -1 if the edges are not stored.
+   */
+  void setMeshEdges (
+    int        meshID,
+    int        size,
+    const int* vertexIDs,
+    int*       edgeIDs );
+
+  /**
+   * @brief Sets several triangles of a solver mesh from edge IDs.
+   *
+   * @param edgeIDs [IN] Edge ID triples (e0,e1,e2,e0,e1,e2,...) of the triangles.
+   */
+  void setMeshTriangles (
+    int        meshID,
+    int        size,
+    const int* edgeIDs );
+
+  /**
+   * @brief Sets several triangles of a solver mesh and creates/sets their edges.
+   *
+   * @param vertexIDs [IN] Vertex ID triples (v0,v1,v2,v0,v1,v2,...) of the triangles.
+   */
+  void setMeshTrianglesWithEdges (
+    int        meshID,
+    int        size,
+    const int* vertexIDs );
+
   /**
    * @brief Set a quadrangle of a solver mesh.
    */
@@ -613,6 +691,9 @@ private:
   // @brief Manages client-server requests, when a server is used.
   RequestManager* _requestManager;
 
+  // @brief Writes the checkpoints in the background.
+  io::CheckpointWriter _checkpointWriter;
+
   // @brief In case of a server lock (_lockServerToClient), a specific request
   //        is expected.
   //int _expectRequest;
@@ -727,6 +808,44 @@ private:
   int markedQueryDirectly() const { return 1; }
   int markedQuerySpacetree() const { return 2; }
 
+  /**
+   * @brief Prepares a query of one or many points on the marked mesh contexts.
+   *
+   * Rebuilds changed spacetrees and updates the ElementIndex of each mesh
+   * context marked to be queried directly, which is created on first use and
+   * kept by the context. Hence, these meshes are not searched element by
+   * element for every point. The indices are only read by the queries and
+   * shared by all threads.
+   *
+   * @return True, if the points can be split over threads.
+   */
+  bool prepareQuery ( const std::vector<int>& markedContexts );
+
+  /**
+   * @brief Returns the position of searchPoint relative to the marked mesh contexts.
+   *
+   * Meshes queried directly are searched through their ElementIndex, see
+   * prepareQuery(), buffer holds the candidates found by the calling thread.
+   */
+  int computePosition (
+    const Eigen::VectorXd&       searchPoint,
+    const std::vector<int>&      markedContexts,
+    query::ElementIndex::Buffer& buffer );
+
+  /**
+   * @brief Computes the closest mesh of searchPoint among the marked mesh contexts.
+   *
+   * The results are the ones stored in a ClosestMesh, see inquireClosestMesh().
+   * Meshes queried directly are searched as in computePosition().
+   */
+  void computeClosestMesh (
+    const Eigen::VectorXd&       searchPoint,
+    const std::vector<int>&      markedContexts,
+    query::ElementIndex::Buffer& buffer,
+    int&                         position,
+    double*                      distanceVector,
+    std::vector<int>&            closestMeshIDs );
+
   /**
    * @brief Initializes communication between data server and client.
    */
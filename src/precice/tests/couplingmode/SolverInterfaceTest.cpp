@@ -1813,16 +1813,12 @@ void SolverInterfaceTest:: testNASTINMeshRestart()
   assertion(utils::Parallel::getCommunicatorSize() == 2);
 
   std::vector<std::string> restartFiles;
-  restartFiles.push_back("precice_checkpoint_NASTIN_NASTIN_Mesh.wrl");
-  restartFiles.push_back("precice_checkpoint_NASTIN_SOLIDZ_Mesh.wrl");
-  restartFiles.push_back("precice_checkpoint_NASTIN_simstate.txt");
-  restartFiles.push_back("precice_checkpoint_SOLIDZ_cplscheme.txt");
-  restartFiles.push_back("precice_checkpoint_SOLIDZ_SOLIDZ_Mesh.wrl");
-  restartFiles.push_back("precice_checkpoint_SOLIDZ_simstate.txt");
+  restartFiles.push_back("precice_checkpoint_NASTIN_0.ckpt");
+  restartFiles.push_back("precice_checkpoint_SOLIDZ_0.ckpt");
 
   for (std::string& restartFile : restartFiles){
-    std::ifstream  src(_pathToTests + restartFile, std::ifstream::in);
-    std::ofstream  dst(restartFile, std::ifstream::out);
+    std::ifstream  src(_pathToTests + restartFile, std::ifstream::in | std::ifstream::binary);
+    std::ofstream  dst(restartFile, std::ifstream::out | std::ifstream::binary);
     dst << src.rdbuf();
   }
 
@@ -10,11 +10,13 @@
 #include "query/FindClosest.hpp"
 #include "utils/Parallel.hpp"
 #include "utils/Globals.hpp"
+#include "utils/Threads.hpp"
 #include "io/ExportVTK.hpp"
 #include <vector>
 #include <set>
 #include <algorithm>
 #include <fstream>
+#include <map>
 
 #include "tarch/tests/TestCaseFactory.h"
 registerIntegrationTest(precice::tests::SolverInterfaceTestGeometry)
@@ -57,6 +59,7 @@ void SolverInterfaceTestGeometry:: run()
     testMethod(testConservativeStationaryDataMapping);
     testMethod(testMappingRBF);
     testMethod(testCustomGeometryCreation);
+    testMethod(testBulkGeometryCreation);
 #   ifndef PRECICE_NO_PYTHON
     testMethod(testPinelli);
 #   endif // not PRECICE_NO_PYTHON
@@ -69,6 +72,7 @@ void SolverInterfaceTestGeometry:: run()
     testMethod(testBug5);
     testMethod(testUpdateSpacetree);
     testMethod(testMultipleMeshSpacetree);
+    testMethod(testBatchQueries);
     Par::setGlobalCommunicator(Par::getCommunicatorWorld());
   }
 }
@@ -1144,6 +1148,144 @@ void SolverInterfaceTestGeometry:: testCustomGeometryCreation()
   }
 }
 
+void SolverInterfaceTestGeometry:: testBulkGeometryCreation()
+{
+  TRACE();
+  // Triangulated grid of 4 x 3 vertices
+  int sizeX = 4;
+  int sizeY = 3;
+  std::vector<double> positions;
+  for (int j=0; j < sizeY; j++){
+    for (int i=0; i < sizeX; i++){
+      positions.push_back(0.5 * i);
+      positions.push_back(0.4 * j);
+      positions.push_back(0.1 * i * j);
+    }
+  }
+  int vertexCount = sizeX * sizeY;
+  std::vector<int> triangleVertices;
+  for (int j=0; j < sizeY - 1; j++){
+    for (int i=0; i < sizeX - 1; i++){
+      int v00 = j * sizeX + i;
+      int v10 = v00 + 1;
+      int v01 = v00 + sizeX;
+      int v11 = v01 + 1;
+      triangleVertices.insert(triangleVertices.end(), {v00, v10, v11, v00, v11, v01});
+    }
+  }
+  int triangleCount = triangleVertices.size() / 3;
+
+  // Edges of the triangles, each only once
+  std::vector<int> edgeVertices;
+  std::vector<int> triangleEdges;
+  std::map<std::pair<int,int>,int> edgePositions;
+  for (int t=0; t < triangleCount; t++){
+    for (int k=0; k < 3; k++){
+      int a = triangleVertices[3 * t + k];
+      int b = triangleVertices[3 * t + (k + 1) % 3];
+      std::pair<int,int> key(std::min(a, b), std::max(a, b));
+      if (edgePositions.count(key) == 0){
+        edgePositions[key] = edgeVertices.size() / 2;
+        edgeVertices.push_back(a);
+        edgeVertices.push_back(b);
+      }
+      triangleEdges.push_back(edgePositions[key]);
+    }
+  }
+  int edgeCount = edgeVertices.size() / 2;
+
+  // Creates a mesh in a new interface, and returns its vertices, edges, and triangles
+  struct MeshContent
+  {
+    std::vector<int> vertexIDs;
+    std::vector<double> coords;
+    std::vector<int> edges;
+    std::vector<int> triangles;
+  };
+  auto createMesh = [&](bool bulk, bool withEdges) -> MeshContent {
+    SolverInterface geo ( "TestAccessor", 0, 1 );
+    configureSolverInterface ( _pathToTests + "solvermesh-3D.xml", geo );
+    std::string meshName = "custom-geometry";
+    int meshID = geo.getMeshID ( meshName );
+    geo._impl->_accessor->meshContext(meshID).meshRequirement = mapping::Mapping::FULL;
+    std::vector<int> vertexIDs(vertexCount);
+    std::vector<int> edgeIDs(edgeCount);
+    if (bulk){
+      geo.setMeshVertices ( meshID, vertexCount, positions.data(), vertexIDs.data() );
+    }
+    else {
+      for (int i=0; i < vertexCount; i++){
+        vertexIDs[i] = geo.setMeshVertex ( meshID, &positions[3 * i] );
+      }
+    }
+    if (withEdges){
+      if (bulk){
+        geo.setMeshEdges ( meshID, edgeCount, edgeVertices.data(), edgeIDs.data() );
+        std::vector<int> edgeIDsOfTriangles;
+        for (int edge : triangleEdges){
+          edgeIDsOfTriangles.push_back(edgeIDs[edge]);
+        }
+        geo.setMeshTriangles ( meshID, triangleCount, edgeIDsOfTriangles.data() );
+      }
+      else {
+        for (int e=0; e < edgeCount; e++){
+          edgeIDs[e] = geo.setMeshEdge ( meshID, edgeVertices[2 * e], edgeVertices[2 * e + 1] );
+        }
+        for (int t=0; t < triangleCount; t++){
+          geo.setMeshTriangle ( meshID, edgeIDs[triangleEdges[3 * t]],
+                                edgeIDs[triangleEdges[3 * t + 1]], edgeIDs[triangleEdges[3 * t + 2]] );
+        }
+      }
+    }
+    else {
+      if (bulk){
+        geo.setMeshTrianglesWithEdges ( meshID, triangleCount, triangleVertices.data() );
+      }
+      else {
+        for (int t=0; t < triangleCount; t++){
+          geo.setMeshTriangleWithEdges ( meshID, triangleVertices[3 * t],
+                                         triangleVertices[3 * t + 1], triangleVertices[3 * t + 2] );
+        }
+      }
+    }
+
+    MeshContent content;
+    content.vertexIDs = vertexIDs;
+    MeshHandle handle = geo.getMeshHandle ( meshName );
+    VertexHandle vertices = handle.vertices();
+    for (VertexIterator iter = vertices.begin(); iter != vertices.end(); iter++){
+      content.coords.insert(content.coords.end(), iter.vertexCoords(), iter.vertexCoords() + 3);
+    }
+    EdgeHandle edges = handle.edges();
+    for (EdgeIterator iter = edges.begin(); iter != edges.end(); iter++){
+      content.edges.push_back(iter.vertexID(0));
+      content.edges.push_back(iter.vertexID(1));
+    }
+    TriangleHandle triangles = handle.triangles();
+    for (TriangleIterator iter = triangles.begin(); iter != triangles.end(); iter++){
+      for (int k=0; k < 3; k++){
+        content.triangles.push_back(iter.vertexID(k));
+      }
+    }
+    return content;
+  };
+
+  for (bool withEdges : {false, true}){
+    MeshContent single = createMesh(false, withEdges);
+    MeshContent bulk = createMesh(true, withEdges);
+    for (int i=0; i < vertexCount; i++){
+      validateEquals ( single.vertexIDs[i], i );
+    }
+    validate ( bulk.vertexIDs == single.vertexIDs );
+    validate ( single.coords == positions );
+    validate ( bulk.coords == single.coords );
+    validateEquals ( (int)single.edges.size(), 2 * edgeCount );
+    validate ( bulk.edges == single.edges );
+    validateEquals ( (int)single.triangles.size(), 3 * triangleCount );
+    validate ( bulk.triangles == single.triangles );
+  }
+}
+
 void SolverInterfaceTestGeometry:: testBug()
 {
   TRACE();
@@ -1559,6 +1701,57 @@ void SolverInterfaceTestGeometry:: testMultipleMeshSpacetree()
   }
 }
 
+void SolverInterfaceTestGeometry:: testBatchQueries()
+{
+  TRACE();
+  SolverInterface interface("Accessor", 0, 1);
+  configureSolverInterface(_pathToTests + "batch-queries.xml", interface);
+  validateEquals(interface.getDimensions(), 3);
+  validateEquals(utils::Threads::getNumberOfThreads(), 3);
+  interface.initialize();
+  int sphereID = interface.getMeshID("Sphere");
+  int cuboidID = interface.getMeshID("Cuboid");
+
+  // Grid of points through both geometries, some of them on the cuboid surface
+  std::vector<double> points;
+  for (int i=0; i < 11; i++){
+    for (int j=0; j < 11; j++){
+      for (int k=0; k < 5; k++){
+        points.push_back(0.1 * i);
+        points.push_back(0.1 * j);
+        points.push_back(0.1 + 0.2 * k);
+      }
+    }
+  }
+  int size = points.size() / 3;
+
+  // The spacetree of the sphere and the cuboid queried directly, each alone and combined
+  std::vector<std::set<int>> meshIDSets {{}, {sphereID}, {cuboidID}};
+  for (const std::set<int>& meshIDs : meshIDSets){
+    std::vector<int> positions(size, -1);
+    interface.inquirePositions(size, points.data(), meshIDs, positions.data());
+    std::vector<int> closestPositions(size, -1);
+    std::vector<double> distances(size, -1.0);
+    std::vector<double> distanceVectors(3 * size, 0.0);
+    std::vector<int> closestMeshIDs(size, -2);
+    interface.inquireClosestMeshes(size, points.data(), meshIDs, closestPositions.data(),
+                                   distances.data(), distanceVectors.data(),
+                                   closestMeshIDs.data());
+    for (int i=0; i < size; i++){
+      const double* point = &points[3 * i];
+      validateEquals(positions[i], interface.inquirePosition(point, meshIDs));
+      ClosestMesh closest = interface.inquireClosestMesh(point, meshIDs);
+      validateEquals(closestPositions[i], closest.position());
+      validateNumericalEquals(distances[i], closest.distance());
+      for (int dim=0; dim < 3; dim++){
+        validateNumericalEquals(distanceVectors[3 * i + dim], closest.distanceVector()[dim]);
+      }
+      validateEquals(closestMeshIDs[i], closest.meshIDs().front());
+    }
+  }
+  utils::Threads::setNumberOfThreads(1);
+}
+
 }} // namespace precice, tests
 
 
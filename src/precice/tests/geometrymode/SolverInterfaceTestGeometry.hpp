@@ -69,6 +69,11 @@ private:
 
   void testCustomGeometryCreation();
 
+  /**
+   * @brief Tests that meshes set by the bulk calls equal meshes set element by element.
+   */
+  void testBulkGeometryCreation();
+
   /**
    * @bried Tests the main functionality that is necessary to perform a Pinelli-type Direct Forcing method
    */
@@ -116,6 +121,11 @@ private:
    * @brief Tests spacetree with multiple meshes.
    */
   void testMultipleMeshSpacetree();
+
+  /**
+   * @brief Tests that batched queries on several threads equal single point queries.
+   */
+  void testBatchQueries();
 };
 
 }} // namespace precice, tests
@@ -8,6 +8,7 @@
 #include "com/MPIDirectCommunication.hpp"
 #include "query/tests/GeometryTestScenarios.hpp"
 #include "tarch/la/WrappedVector.h"
+#include <vector>
 
 #include "tarch/tests/TestCaseFactory.h"
 registerIntegrationTest(precice::tests::SolverInterfaceTestRemote)
@@ -42,6 +43,7 @@ void SolverInterfaceTestRemote:: run()
     if (Par::getProcessRank() <= 1){
       Par::setGlobalCommunicator(comm);
       testMethod(testGeometryMode);
+      testMethod(testGeometryModeBatchQueries);
       Par::setGlobalCommunicator(Par::getCommunicatorWorld());
     }
   }
@@ -195,6 +197,93 @@ void SolverInterfaceTestRemote:: testGeometryMode()
   }
 }
 
+void SolverInterfaceTestRemote:: testGeometryModeBatchQueries()
+{
+  TRACE();
+  for (int dim=2; dim <= 3; dim++){
+    std::string configFilename;
+    if (dim == 2){
+      configFilename = _pathToTests + "geomode-2D.xml";
+    }
+    else {
+      configFilename = _pathToTests + "geomode-3D.xml";
+    }
+    int rank = utils::Parallel::getProcessRank();
+    if (rank == 0){
+      SolverInterface interface("TestAccessor", rank, 2);
+      configureSolverInterface(configFilename, interface);
+      validateEquals(interface.getDimensions(), dim);
+      interface.initialize();
+      interface.initializeData(); // is skipped due to geometry mode
+
+      std::set<int> ids;
+      ids.insert(interface.getMeshID("CuboidMesh"));
+      typedef query::tests::GeometryTestScenarios GeoTests;
+      GeoTests geoTests;
+
+      // Test inquireClosestMeshes(), one request for all points of the scenario
+      const GeoTests::PointQueryScenario& pointScen = geoTests.pointQueryScenario(dim);
+      std::vector<double> points;
+      for (const Eigen::VectorXd& coords : pointScen.queryCoords){
+        points.insert(points.end(), coords.data(), coords.data() + dim);
+      }
+      int size = pointScen.queryCoords.size();
+      std::vector<int> positions(size, -1);
+      std::vector<double> distances(size, -1.0);
+      std::vector<double> distanceVectors(dim * size, 0.0);
+      std::vector<int> closestMeshIDs(size, -2);
+      interface.inquireClosestMeshes(size, points.data(), ids, positions.data(),
+                                     distances.data(), distanceVectors.data(),
+                                     closestMeshIDs.data());
+      std::list<double>::const_iterator distIter = pointScen.validDistances.begin();
+      std::list<Eigen::VectorXd>::const_iterator distVectorIter = pointScen.validDistanceVectors.begin();
+      for (int i=0; i < size; i++){
+        Eigen::Map<const Eigen::VectorXd> distanceVec(&distanceVectors[dim * i], dim);
+        validate(math::equals(*distVectorIter, distanceVec));
+        validate(math::equals(*distIter, distances[i]));
+        ClosestMesh closest = interface.inquireClosestMesh(&points[dim * i], ids);
+        validateEquals(positions[i], closest.position());
+        validateEquals(closestMeshIDs[i], closest.meshIDs().front());
+        distIter++;
+        distVectorIter++;
+      }
+
+      // Test inquirePositions()
+      const GeoTests::PositionQueryScenario& posScen = geoTests.positionQueryScenario(dim);
+      points.clear();
+      for (const Eigen::VectorXd& coords : posScen.queryCoords){
+        points.insert(points.end(), coords.data(), coords.data() + dim);
+      }
+      size = posScen.queryCoords.size();
+      positions.assign(size, -2);
+      interface.inquirePositions(size, points.data(), ids, positions.data());
+      std::list<int>::const_iterator posIter = posScen.validPositions.begin();
+      for (int i=0; i < size; i++){
+        validateEquals(positions[i], *posIter);
+        posIter++;
+      }
+
+      interface.advance(1.0);
+      interface.finalize();
+    }
+    else {
+      assertion(rank == 1, rank);
+      bool isServer = true;
+      impl::SolverInterfaceImpl server("TestAccessor", rank, 2, isServer);
+      // Perform manual configuration without overwritting logging config
+      mesh::Mesh::resetGeometryIDsGlobally();
+      mesh::Data::resetDataCount();
+      impl::Participant::resetParticipantCount();
+      config::Configuration config;
+      utils::configure(config.getXMLTag(), configFilename);
+      server.configure(config.getSolverInterfaceConfiguration());
+
+      validateEquals(server.getDimensions(), dim);
+      server.runServer();
+    }
+  }
+}
+
 void SolverInterfaceTestRemote:: testGeometryModeParallel()
 {
   TRACE();  
@@ -54,6 +54,11 @@ private:
    */
   void testGeometryMode();
 
+  /**
+   * @brief Queries all points of a scenario by one request to the server.
+   */
+  void testGeometryModeBatchQueries();
+
   /**
    * @brief Two processes run the solver interface in geo-mode with server.
    */
@@ -0,0 +1,289 @@
+#include "ElementIndex.hpp"
+#include "mesh/Vertex.hpp"
+#include "mesh/Edge.hpp"
+#include "mesh/Triangle.hpp"
+#include "mesh/Quad.hpp"
+#include "utils/Globals.hpp"
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <numeric>
+
+namespace precice {
+namespace query {
+
+logging::Logger ElementIndex::_log("precice::query::ElementIndex");
+
+ElementIndex:: ElementIndex
+(
+  const mesh::PtrMesh& mesh )
+:
+  _mesh(mesh),
+  _dimensions(mesh->getDimensions()),
+  _isBuilt(false),
+  _vertexIndex(mesh),
+  _edgeTree(),
+  _triangleTree(),
+  _quadTree(),
+  _buffer()
+{
+  _mesh->addListener(*this);
+}
+
+ElementIndex:: ~ElementIndex()
+{
+  _mesh->removeListener(*this);
+}
+
+const mesh::PtrMesh& ElementIndex:: getMesh() const
+{
+  return _mesh;
+}
+
+void ElementIndex:: meshChanged
+(
+  mesh::Mesh& mesh )
+{
+  TRACE(mesh.getName());
+  _isBuilt = false;
+}
+
+void ElementIndex:: clear()
+{
+  _isBuilt = false;
+  _vertexIndex.clear();
+}
+
+void ElementIndex:: update()
+{
+  if ((not _isBuilt) || hasChangedSize()){
+    build();
+  }
+  _vertexIndex.update();
+}
+
+mesh::Group& ElementIndex:: getCandidates
+(
+  const Eigen::VectorXd& point,
+  Buffer&                buffer )
+{
+  assertion(point.size() == _dimensions, point.size(), _dimensions);
+  update();
+  mesh::Group& candidates = buffer.candidates;
+  std::vector<int>& positions = buffer.positions;
+  candidates.clear();
+  double distance = 0.0;
+  int closestVertex = _vertexIndex.getClosestVertex(point, distance);
+  if (closestVertex == -1){
+    return candidates;
+  }
+  candidates.add(_mesh->vertices()[closestVertex]);
+  double squaredDistance = distance * distance;
+
+  positions.clear();
+  _edgeTree.search(point.data(), squaredDistance, positions);
+  for (int position : positions){
+    candidates.add(_mesh->edges()[position]);
+  }
+  positions.clear();
+  _triangleTree.search(point.data(), squaredDistance, positions);
+  for (int position : positions){
+    candidates.add(_mesh->triangles()[position]);
+  }
+  positions.clear();
+  _quadTree.search(point.data(), squaredDistance, positions);
+  for (int position : positions){
+    candidates.add(_mesh->quads()[position]);
+  }
+  return candidates;
+}
+
+mesh::Group& ElementIndex:: getCandidates
+(
+  const Eigen::VectorXd& point )
+{
+  return getCandidates(point, _buffer);
+}
+
+void ElementIndex:: build()
+{
+  TRACE(_mesh->getName());
+  buildTree(_mesh->edges(), 2, _edgeTree);
+  buildTree(_mesh->triangles(), 3, _triangleTree);
+  buildTree(_mesh->quads(), 4, _quadTree);
+  _isBuilt = true;
+}
+
+bool ElementIndex:: hasChangedSize() const
+{
+  return (_edgeTree.size() != _mesh->edges().size())
+      || (_triangleTree.size() != _mesh->triangles().size())
+      || (_quadTree.size() != _mesh->quads().size());
+}
+
+template<typename CONTAINER_T>
+void ElementIndex:: buildTree
+(
+  const CONTAINER_T& elements,
+  int                vertexCount,
+  BoxTree&           tree )
+{
+  size_t size = elements.size();
+  std::vector<double> lowerBounds(size * _dimensions, std::numeric_limits<double>::max());
+  std::vector<double> upperBounds(size * _dimensions, std::numeric_limits<double>::lowest());
+  for (size_t i=0; i < size; i++){
+    double* lower = &lowerBounds[i * _dimensions];
+    double* upper = &upperBounds[i * _dimensions];
+    for (int j=0; j < vertexCount; j++){
+      mesh::Vertex::ConstVectorMap coords = elements[i].vertex(j).getCoords();
+      for (int d=0; d < _dimensions; d++){
+        lower[d] = std::min(lower[d], coords[d]);
+        upper[d] = std::max(upper[d], coords[d]);
+      }
+    }
+    // Projections are accepted slightly outside of the element, enlarge the box accordingly
+    for (int d=0; d < _dimensions; d++){
+      double tolerance = (std::abs(lower[d]) + std::abs(upper[d]) + 1.0) * 1e-10;
+      lower[d] -= tolerance;
+      upper[d] += tolerance;
+    }
+  }
+  tree.build(_dimensions, lowerBounds, upperBounds);
+}
+
+void ElementIndex::BoxTree:: build
+(
+  int                        dimensions,
+  const std::vector<double>& lowerBounds,
+  const std::vector<double>& upperBounds )
+{
+  _dimensions = dimensions;
+  int size = (int) lowerBounds.size() / dimensions;
+  _nodes.clear();
+  _nodeLowerBounds.clear();
+  _nodeUpperBounds.clear();
+  _positions.resize(size);
+  std::iota(_positions.begin(), _positions.end(), 0);
+  if (size > 0){
+    buildNode(lowerBounds, upperBounds, 0, size);
+  }
+
+  // Store element boxes in tree order, to traverse them contiguously
+  _lowerBounds.resize(size * dimensions);
+  _upperBounds.resize(size * dimensions);
+  for (int i=0; i < size; i++){
+    int position = _positions[i] * dimensions;
+    std::copy(&lowerBounds[position], &lowerBounds[position] + dimensions, &_lowerBounds[i * dimensions]);
+    std::copy(&upperBounds[position], &upperBounds[position] + dimensions, &_upperBounds[i * dimensions]);
+  }
+}
+
+size_t ElementIndex::BoxTree:: size() const
+{
+  return _positions.size();
+}
+
+int ElementIndex::BoxTree:: buildNode
+(
+  const std::vector<double>& lowerBounds,
+  const std::vector<double>& upperBounds,
+  int                        begin,
+  int                        end )
+{
+  int dim = _dimensions;
+  int nodeIndex = (int) _nodes.size();
+  _nodes.push_back(Node{begin, end, -1, -1});
+  _nodeLowerBounds.resize(_nodeLowerBounds.size() + dim, std::numeric_limits<double>::max());
+  _nodeUpperBounds.resize(_nodeUpperBounds.size() + dim, std::numeric_limits<double>::lowest());
+
+  // Bounding box of the node and of the element centers
+  Eigen::VectorXd lowerCenter = Eigen::VectorXd::Constant(dim, std::numeric_limits<double>::max());
+  Eigen::VectorXd upperCenter = Eigen::VectorXd::Constant(dim, std::numeric_limits<double>::lowest());
+  for (int i=begin; i < end; i++){
+    const double* lower = &lowerBounds[_positions[i] * dim];
+    const double* upper = &upperBounds[_positions[i] * dim];
+    for (int d=0; d < dim; d++){
+      _nodeLowerBounds[nodeIndex * dim + d] = std::min(_nodeLowerBounds[nodeIndex * dim + d], lower[d]);
+      _nodeUpperBounds[nodeIndex * dim + d] = std::max(_nodeUpperBounds[nodeIndex * dim + d], upper[d]);
+      double center = 0.5 * (lower[d] + upper[d]);
+      lowerCenter[d] = std::min(lowerCenter[d], center);
+      upperCenter[d] = std::max(upperCenter[d], center);
+    }
+  }
+  if (end - begin <= _leafSize){
+    return nodeIndex;
+  }
+
+  // Split at the median center along the dimension of largest extent
+  int splitDimension = 0;
+  (upperCenter - lowerCenter).maxCoeff(&splitDimension);
+  int median = begin + (end - begin) / 2;
+  std::nth_element(_positions.begin() + begin, _positions.begin() + median,
+                   _positions.begin() + end,
+                   [&lowerBounds, &upperBounds, splitDimension, dim] (int lhs, int rhs) {
+                     return lowerBounds[lhs * dim + splitDimension] + upperBounds[lhs * dim + splitDimension]
+                          < lowerBounds[rhs * dim + splitDimension] + upperBounds[rhs * dim + splitDimension];
+                   });
+  int left = buildNode(lowerBounds, upperBounds, begin, median);
+  int right = buildNode(lowerBounds, upperBounds, median, end);
+  _nodes[nodeIndex].left = left;
+  _nodes[nodeIndex].right = right;
+  return nodeIndex;
+}
+
+void ElementIndex::BoxTree:: search
+(
+  const double*     point,
+  double            squaredDistance,
+  std::vector<int>& positions ) const
+{
+  if (_nodes.empty()){
+    return;
+  }
+  size_t first = positions.size();
+  searchNode(0, point, squaredDistance, positions);
+  std::sort(positions.begin() + first, positions.end());
+}
+
+void ElementIndex::BoxTree:: searchNode
+(
+  int               node,
+  const double*     point,
+  double            squaredDistance,
+  std::vector<int>& positions ) const
+{
+  if (squaredDistanceToBox(point, &_nodeLowerBounds[node * _dimensions],
+                           &_nodeUpperBounds[node * _dimensions]) > squaredDistance)
+  {
+    return;
+  }
+  const Node& current = _nodes[node];
+  if (current.left == -1){
+    for (int i=current.begin; i < current.end; i++){
+      if (squaredDistanceToBox(point, &_lowerBounds[i * _dimensions],
+                               &_upperBounds[i * _dimensions]) <= squaredDistance)
+      {
+        positions.push_back(_positions[i]);
+      }
+    }
+    return;
+  }
+  searchNode(current.left, point, squaredDistance, positions);
+  searchNode(current.right, point, squaredDistance, positions);
+}
+
+double ElementIndex::BoxTree:: squaredDistanceToBox
+(
+  const double* point,
+  const double* lowerBound,
+  const double* upperBound ) const
+{
+  double distance = 0.0;
+  for (int d=0; d < _dimensions; d++){
+    double difference = std::max({lowerBound[d] - point[d], point[d] - upperBound[d], 0.0});
+    distance += difference * difference;
+  }
+  return distance;
+}
+
+}} // namespace precice, query
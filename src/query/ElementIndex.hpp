@@ -0,0 +1,199 @@
+#pragma once
+
+#include "query/VertexIndex.hpp"
+#include "mesh/Group.hpp"
+#include "mesh/Mesh.hpp"
+#include "mesh/SharedPointer.hpp"
+#include "logging/Logger.hpp"
+#include <boost/noncopyable.hpp>
+#include <Eigen/Core>
+#include <vector>
+
+// ----------------------------------------------------------- CLASS DEFINITION
+
+namespace precice {
+namespace query {
+
+/**
+ * @brief Spatial index over all elements (vertices, edges, triangles, quads) of one mesh.
+ *
+ * Vertices are indexed by a VertexIndex, edges, triangles and quads by one
+ * bounding volume hierarchy (axis aligned bounding boxes) per element type.
+ *
+ * The distance of a search point to its closest element is bounded by the
+ * distance to the closest vertex. Since projections onto edges, triangles and
+ * quads are only valid inside the element, all elements whose bounding box is
+ * farther away than this bound are pruned. The remaining candidates are
+ * returned in the order of the mesh containers, such that a query::FindClosest
+ * run on them gives the same result as a search over the whole mesh.
+ *
+ * Like VertexIndex, the hierarchies are built lazily and rebuilt after the mesh
+ * has notified a change, or after the number of mesh elements has changed.
+ * Once built, queries only read the index and write their results to a Buffer.
+ * After update(), one index can hence be queried concurrently by several
+ * threads, each passing its own Buffer, as long as the mesh does not change.
+ *
+ * Usage: query::FindClosest::operator()(ElementIndex&).
+ */
+class ElementIndex : public mesh::Mesh::MeshListener, private boost::noncopyable
+{
+public:
+
+  /// Results of the queries of one thread, reused between queries.
+  struct Buffer
+  {
+    /// Candidates of the last query.
+    mesh::Group candidates;
+
+    /// Container positions of the candidates of one element type.
+    std::vector<int> positions;
+  };
+
+  /// Constructor, registers the index as listener of the mesh.
+  ElementIndex ( const mesh::PtrMesh& mesh );
+
+  /// Destructor, deregisters the index from the mesh.
+  virtual ~ElementIndex();
+
+  /// Returns the indexed mesh.
+  const mesh::PtrMesh& getMesh() const;
+
+  /// Marks the index as outdated, called by the mesh on changes.
+  virtual void meshChanged ( mesh::Mesh& mesh );
+
+  /// Marks the index as outdated, it is rebuilt on the next query.
+  void clear();
+
+  /// Builds the hierarchies and the vertex index, if they do not represent the current mesh.
+  void update();
+
+  /**
+   * @brief Returns all elements of the mesh that can be closest to the point.
+   *
+   * The returned group is buffer.candidates, overwritten by the next call with
+   * the same buffer. It holds the closest vertex and all edges, triangles, and
+   * quads whose bounding box is not farther away from the point than that vertex.
+   */
+  mesh::Group& getCandidates (
+    const Eigen::VectorXd& point,
+    Buffer&                buffer );
+
+  /// Returns the candidates as above, in a buffer owned by the index.
+  mesh::Group& getCandidates ( const Eigen::VectorXd& point );
+
+private:
+
+  /**
+   * @brief Bounding volume hierarchy over the bounding boxes of one element type.
+   */
+  class BoxTree
+  {
+  public:
+
+    /// Builds the tree from the boxes of all elements, _dimensions entries per bound.
+    void build (
+      int                        dimensions,
+      const std::vector<double>& lowerBounds,
+      const std::vector<double>& upperBounds );
+
+    /// Returns the number of indexed elements.
+    size_t size() const;
+
+    /**
+     * @brief Appends the container positions of all elements within distance to positions.
+     *
+     * The positions are appended in ascending order.
+     */
+    void search (
+      const double*     point,
+      double            squaredDistance,
+      std::vector<int>& positions ) const;
+
+  private:
+
+    struct Node
+    {
+      /// Range of tree positions [begin, end) held by the node.
+      int begin;
+      int end;
+
+      /// Indices of child nodes, -1 for leaves.
+      int left;
+      int right;
+    };
+
+    /// Maximum number of elements in a leaf node.
+    static const int _leafSize = 4;
+
+    int _dimensions = 0;
+
+    std::vector<Node> _nodes;
+
+    /// Lower and upper bounds of all node boxes, _dimensions entries per node.
+    std::vector<double> _nodeLowerBounds;
+    std::vector<double> _nodeUpperBounds;
+
+    /// Lower and upper bounds of all element boxes in tree order.
+    std::vector<double> _lowerBounds;
+    std::vector<double> _upperBounds;
+
+    /// Container position of the element at each tree position.
+    std::vector<int> _positions;
+
+    /// Recursively builds the subtree over tree positions [begin, end), returns its node index.
+    int buildNode (
+      const std::vector<double>& lowerBounds,
+      const std::vector<double>& upperBounds,
+      int                        begin,
+      int                        end );
+
+    /// Returns the squared distance from point to the box given by its bounds.
+    double squaredDistanceToBox (
+      const double* point,
+      const double* lowerBound,
+      const double* upperBound ) const;
+
+    void searchNode (
+      int               node,
+      const double*     point,
+      double            squaredDistance,
+      std::vector<int>& positions ) const;
+  };
+
+  /// Logging device.
+  static logging::Logger _log;
+
+  /// Indexed mesh.
+  mesh::PtrMesh _mesh;
+
+  int _dimensions;
+
+  /// True, if the hierarchies represent the current state of the mesh.
+  bool _isBuilt;
+
+  VertexIndex _vertexIndex;
+
+  BoxTree _edgeTree;
+
+  BoxTree _triangleTree;
+
+  BoxTree _quadTree;
+
+  /// Buffer of getCandidates() without buffer argument.
+  Buffer _buffer;
+
+  /// Builds the hierarchies from the current elements of the mesh.
+  void build();
+
+  /// Returns true, if the number of mesh elements differs from the indexed ones.
+  bool hasChangedSize() const;
+
+  /// Builds the tree over the bounding boxes of the given elements.
+  template<typename CONTAINER_T>
+  void buildTree (
+    const CONTAINER_T& elements,
+    int                vertexCount,
+    BoxTree&           tree );
+};
+
+}} // namespace precice, query
@@ -1,4 +1,5 @@
 #include "FindClosest.hpp"
+#include "ElementIndex.hpp"
 #include "mesh/Vertex.hpp"
 #include "mesh/Edge.hpp"
 #include "mesh/Triangle.hpp"
@@ -12,6 +13,13 @@ namespace query {
 
 logging::Logger FindClosest:: _log("precice::query::FindClosest");
 
+bool FindClosest:: operator()
+(
+  ElementIndex& index )
+{
+  return (*this)(index.getCandidates(_searchpoint));
+}
+
 bool FindClosest:: hasFound() const
 {
   return not _closest.meshIDs.empty();
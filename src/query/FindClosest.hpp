@@ -9,6 +9,9 @@ namespace precice {
    namespace mesh {
       class Mesh;
    }
+   namespace query {
+      class ElementIndex;
+   }
 }
 
 // ----------------------------------------------------------- CLASS DEFINITION
@@ -78,6 +81,14 @@ public:
   template<typename CONTAINER_T>
   bool operator() ( CONTAINER_T& container );
 
+  /**
+   * @brief Finds closest distance to all elements of the mesh indexed by the given ElementIndex.
+   *
+   * Gives the same result as searching the mesh itself, but only visits the
+   * candidate elements returned by the index.
+   */
+  bool operator() ( ElementIndex& index );
+
   /// Returns true, if a closest element was found.
   bool hasFound() const;
 
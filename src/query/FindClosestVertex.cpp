@@ -1,6 +1,8 @@
 #include "FindClosestVertex.hpp"
 #include "mesh/Vertex.hpp"
 #include "mesh/Mesh.hpp"
+#include "VertexIndex.hpp"
+#include <cmath>
 
 namespace precice {
 namespace query {
@@ -14,6 +16,45 @@ FindClosestVertex:: FindClosestVertex
   _closestVertex (NULL)
 {}
 
+bool FindClosestVertex:: operator()
+(
+  mesh::Mesh& mesh )
+{
+  Eigen::Map<const Eigen::MatrixXd> coords = mesh.vertexCoords();
+  assertion(coords.rows() == _searchPoint.size(), coords.rows(), _searchPoint.size());
+  int closest = -1;
+  double shortestSquared = _shortestDistance < std::numeric_limits<double>::max()
+                           ? _shortestDistance * _shortestDistance
+                           : std::numeric_limits<double>::max();
+  for (int i=0; i < coords.cols(); i++){
+    double distance = (coords.col(i) - _searchPoint).squaredNorm();
+    if (distance < shortestSquared){
+      shortestSquared = distance;
+      closest = i;
+    }
+  }
+  if (closest != -1){
+    // Columns of the coordinates are ordered by vertex ID
+    assertion(mesh.vertices()[closest].getID() == closest, mesh.vertices()[closest].getID(), closest);
+    _shortestDistance = std::sqrt(shortestSquared);
+    _closestVertex = &mesh.vertices()[closest];
+  }
+  return _closestVertex != nullptr;
+}
+
+bool FindClosestVertex:: operator()
+(
+  VertexIndex& index )
+{
+  double distance = 0.0;
+  int position = index.getClosestVertex(_searchPoint, distance);
+  if ((position != -1) && (distance < _shortestDistance)){
+    _shortestDistance = distance;
+    _closestVertex = &index.getMesh()->vertices()[position];
+  }
+  return _closestVertex != nullptr;
+}
+
 const Eigen::VectorXd& FindClosestVertex:: getSearchPoint() const
 {
   return _searchPoint;
@@ -6,6 +6,12 @@
 
 // ---------------------------------------------------------- CLASS DEFINITION
 
+namespace precice {
+  namespace query {
+    class VertexIndex;
+  }
+}
+
 namespace precice {
 namespace query {
 
@@ -32,6 +38,22 @@ public:
   template<typename CONTAINER_T>
   bool operator() ( CONTAINER_T& container );
 
+  /**
+   * @brief Searches among all vertices of the given mesh.
+   *
+   * Scans the contiguous coordinates of Mesh::vertexCoords() instead of
+   * visiting the Vertex objects.
+   */
+  bool operator() ( mesh::Mesh& mesh );
+
+  /**
+   * @brief Searches among all Vertex objects of the mesh indexed by the given VertexIndex.
+   *
+   * Gives the same result as searching the mesh itself, but does not visit all
+   * vertices of the mesh.
+   */
+  bool operator() ( VertexIndex& index );
+
   /**
    * @brief Returns the coordinates of the search point.
    */
@@ -0,0 +1,166 @@
+#include "VertexHash.hpp"
+#include "mesh/Vertex.hpp"
+#include "math/differences.hpp"
+#include "utils/Globals.hpp"
+#include <algorithm>
+#include <cmath>
+#include <numeric>
+
+namespace precice {
+namespace query {
+
+logging::Logger VertexHash::_log("precice::query::VertexHash");
+
+VertexHash:: VertexHash
+(
+  const mesh::PtrMesh& mesh )
+:
+  _mesh(mesh),
+  _dimensions(mesh->getDimensions()),
+  _isBuilt(false),
+  _cellSize(1.0),
+  _vertexPositions(),
+  _cells()
+{
+  _mesh->addListener(*this);
+}
+
+VertexHash:: ~VertexHash()
+{
+  _mesh->removeListener(*this);
+}
+
+const mesh::PtrMesh& VertexHash:: getMesh() const
+{
+  return _mesh;
+}
+
+void VertexHash:: meshChanged
+(
+  mesh::Mesh& mesh )
+{
+  TRACE(mesh.getName());
+  _isBuilt = false;
+}
+
+void VertexHash:: clear()
+{
+  _isBuilt = false;
+  _vertexPositions.clear();
+  _cells.clear();
+}
+
+int VertexHash:: getVertexAt
+(
+  const Eigen::VectorXd& position )
+{
+  assertion(position.size() == _dimensions, position.size(), _dimensions);
+  update();
+  // math::equals(a, b) implies |a - b| <= tolerance * |b|
+  double tolerance = math::NUMERICAL_ZERO_DIFFERENCE * position.norm();
+  std::int64_t lower[3];
+  std::int64_t upper[3];
+  for (int dim=0; dim < _dimensions; dim++){
+    lower[dim] = cellIndex(position[dim] - tolerance);
+    upper[dim] = cellIndex(position[dim] + tolerance);
+  }
+  const mesh::Mesh::VertexContainer& vertices = _mesh->vertices();
+  int found = -1;
+  std::int64_t indices[3] = { lower[0], lower[1], _dimensions == 3 ? lower[2] : 0 };
+  while (true){
+    auto cell = _cells.find(cellKey(indices));
+    if (cell != _cells.end()){
+      for (int i=cell->second.first; i < cell->second.second; i++){
+        int vertexPosition = _vertexPositions[i];
+        if ((found != -1) && (vertexPosition > found)){
+          break;
+        }
+        if (math::equals(vertices[vertexPosition].getCoords(), position)){
+          found = vertexPosition;
+          break;
+        }
+      }
+    }
+    // Advance to the next cell of the box [lower, upper]
+    int dim = 0;
+    while ((dim < _dimensions) && (indices[dim] == upper[dim])){
+      indices[dim] = lower[dim];
+      dim++;
+    }
+    if (dim == _dimensions){
+      break;
+    }
+    indices[dim]++;
+  }
+  return found;
+}
+
+void VertexHash:: update()
+{
+  if ((not _isBuilt) || (_vertexPositions.size() != _mesh->vertices().size())){
+    build();
+  }
+}
+
+void VertexHash:: build()
+{
+  TRACE(_mesh->getName(), _mesh->vertices().size());
+  Eigen::Map<const Eigen::MatrixXd> coords = _mesh->vertexCoords();
+  int size = (int) coords.cols();
+  _cells.clear();
+  _vertexPositions.resize(size);
+  std::iota(_vertexPositions.begin(), _vertexPositions.end(), 0);
+
+  // Cells of about the vertex spacing of a surface mesh, which results in few
+  // vertices per cell also for volume meshes, since only non-empty cells are stored.
+  _cellSize = 1.0;
+  if (size > 1){
+    double extent = (coords.rowwise().maxCoeff() - coords.rowwise().minCoeff()).maxCoeff();
+    double cellsPerAxis = std::pow((double) size, 1.0 / (_dimensions - 1));
+    if (extent > 0.0){
+      _cellSize = extent / cellsPerAxis;
+    }
+  }
+
+  std::vector<std::uint64_t> keys(size);
+  std::int64_t indices[3] = { 0, 0, 0 };
+  for (int i=0; i < size; i++){
+    for (int dim=0; dim < _dimensions; dim++){
+      indices[dim] = cellIndex(coords(dim, i));
+    }
+    keys[i] = cellKey(indices);
+  }
+  std::stable_sort(_vertexPositions.begin(), _vertexPositions.end(),
+                   [&keys](int lhs, int rhs){ return keys[lhs] < keys[rhs]; });
+  _cells.reserve(size);
+  int begin = 0;
+  for (int i=1; i <= size; i++){
+    if ((i == size) || (keys[_vertexPositions[i]] != keys[_vertexPositions[begin]])){
+      _cells[keys[_vertexPositions[begin]]] = std::make_pair(begin, i);
+      begin = i;
+    }
+  }
+  _isBuilt = true;
+  DEBUG("Cell size = " << _cellSize << ", cells = " << _cells.size());
+}
+
+std::int64_t VertexHash:: cellIndex
+(
+  double coordinate ) const
+{
+  return (std::int64_t) std::floor(coordinate / _cellSize);
+}
+
+std::uint64_t VertexHash:: cellKey
+(
+  const std::int64_t* indices ) const
+{
+  std::uint64_t key = (std::uint64_t) indices[0] * 73856093u;
+  key ^= (std::uint64_t) indices[1] * 19349663u;
+  if (_dimensions == 3){
+    key ^= (std::uint64_t) indices[2] * 83492791u;
+  }
+  return key;
+}
+
+}} // namespace precice, query
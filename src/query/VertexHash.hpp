@@ -0,0 +1,99 @@
+#pragma once
+
+#include "mesh/Mesh.hpp"
+#include "mesh/SharedPointer.hpp"
+#include "logging/Logger.hpp"
+#include <boost/noncopyable.hpp>
+#include <Eigen/Core>
+#include <cstdint>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+// ----------------------------------------------------------- CLASS DEFINITION
+
+namespace precice {
+namespace query {
+
+/**
+ * @brief Spatial hash over the vertices of one mesh, to find vertices by position.
+ *
+ * The vertices are sorted into cells of a uniform grid, only non-empty cells
+ * are stored. A position matches a vertex, if math::equals() holds for their
+ * coordinates. Since math::equals() compares with a tolerance relative to the
+ * length of the coordinates, all cells intersecting the tolerance box around
+ * the position are searched, which is usually a single cell.
+ *
+ * As query::VertexIndex, the hash is built lazily on the first query and is
+ * rebuilt after the mesh has notified a change, or after the number of vertices
+ * of the mesh has changed.
+ */
+class VertexHash : public mesh::Mesh::MeshListener, private boost::noncopyable
+{
+public:
+
+  /**
+   * @brief Constructor, registers the hash as listener of the mesh.
+   *
+   * The hash itself is not built before the first query.
+   */
+  VertexHash ( const mesh::PtrMesh& mesh );
+
+  /// Destructor, deregisters the hash from the mesh.
+  virtual ~VertexHash();
+
+  /// Returns the hashed mesh.
+  const mesh::PtrMesh& getMesh() const;
+
+  /// Marks the hash as outdated, called by the mesh on changes.
+  virtual void meshChanged ( mesh::Mesh& mesh );
+
+  /// Marks the hash as outdated, it is rebuilt on the next query.
+  void clear();
+
+  /**
+   * @brief Returns the position in Mesh::vertices() of the vertex located at position.
+   *
+   * Among several matching vertices, the one with the lowest position is
+   * returned, which gives the same result as a linear search.
+   *
+   * @return Position of the vertex, or -1 if no vertex matches.
+   */
+  int getVertexAt ( const Eigen::VectorXd& position );
+
+private:
+
+  /// Logging device.
+  static logging::Logger _log;
+
+  /// Hashed mesh.
+  mesh::PtrMesh _mesh;
+
+  int _dimensions;
+
+  /// True, if the hash represents the current state of the mesh.
+  bool _isBuilt;
+
+  /// Edge length of the grid cells.
+  double _cellSize;
+
+  /// Vertex positions in Mesh::vertices(), sorted by cell key and position.
+  std::vector<int> _vertexPositions;
+
+  /// Range [first, second) in _vertexPositions of the vertices with a cell key.
+  std::unordered_map<std::uint64_t,std::pair<int,int>> _cells;
+
+  /// Builds the hash, if it does not represent the current vertices of the mesh.
+  void update();
+
+  /// Builds the hash from the current vertices of the mesh.
+  void build();
+
+  /// Returns the grid cell index of a coordinate.
+  std::int64_t cellIndex ( double coordinate ) const;
+
+  /// Returns the key of the cell with the given grid indices, collisions are allowed.
+  std::uint64_t cellKey ( const std::int64_t* indices ) const;
+};
+
+}} // namespace precice, query
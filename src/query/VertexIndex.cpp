@@ -0,0 +1,321 @@
+#include "VertexIndex.hpp"
+#include "mesh/Vertex.hpp"
+#include "utils/Globals.hpp"
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <numeric>
+
+namespace precice {
+namespace query {
+
+logging::Logger VertexIndex::_log("precice::query::VertexIndex");
+
+VertexIndex:: VertexIndex
+(
+  const mesh::PtrMesh& mesh )
+:
+  _mesh(mesh),
+  _dimensions(mesh->getDimensions()),
+  _isBuilt(false),
+  _coords(),
+  _vertexPositions(),
+  _splitDimensions()
+{
+  _mesh->addListener(*this);
+}
+
+VertexIndex:: ~VertexIndex()
+{
+  _mesh->removeListener(*this);
+}
+
+const mesh::PtrMesh& VertexIndex:: getMesh() const
+{
+  return _mesh;
+}
+
+void VertexIndex:: meshChanged
+(
+  mesh::Mesh& mesh )
+{
+  TRACE(mesh.getName());
+  _isBuilt = false;
+}
+
+void VertexIndex:: clear()
+{
+  _isBuilt = false;
+  _coords.clear();
+  _vertexPositions.clear();
+  _splitDimensions.clear();
+}
+
+int VertexIndex:: getClosestVertex
+(
+  const Eigen::VectorXd& point,
+  double&                distance )
+{
+  assertion(point.size() == _dimensions, point.size(), _dimensions);
+  update();
+  int closest = -1;
+  double squaredDistance = std::numeric_limits<double>::max();
+  searchClosest(point.data(), 0, (int) _vertexPositions.size(), closest, squaredDistance);
+  if (closest == -1){
+    distance = std::numeric_limits<double>::max();
+    return -1;
+  }
+  distance = std::sqrt(squaredDistance);
+  return _vertexPositions[closest];
+}
+
+void VertexIndex:: getVerticesInRadius
+(
+  const Eigen::VectorXd& point,
+  double                 radius,
+  std::vector<int>&      positions )
+{
+  assertion(point.size() == _dimensions, point.size(), _dimensions);
+  assertion(radius >= 0.0, radius);
+  update();
+  size_t first = positions.size();
+  searchRadius(point.data(), 0, (int) _vertexPositions.size(), radius * radius, positions);
+  std::sort(positions.begin() + first, positions.end());
+}
+
+void VertexIndex:: getVerticesInBox
+(
+  const Eigen::VectorXd& lower,
+  const Eigen::VectorXd& upper,
+  std::vector<int>&      positions )
+{
+  assertion(lower.size() == _dimensions, lower.size(), _dimensions);
+  assertion(upper.size() == _dimensions, upper.size(), _dimensions);
+  update();
+  size_t first = positions.size();
+  searchBox(lower.data(), upper.data(), 0, (int) _vertexPositions.size(), positions);
+  std::sort(positions.begin() + first, positions.end());
+}
+
+void VertexIndex:: update()
+{
+  if ((not _isBuilt) || (_vertexPositions.size() != _mesh->vertices().size())){
+    build();
+  }
+}
+
+void VertexIndex:: build()
+{
+  TRACE(_mesh->getName(), _mesh->vertices().size());
+  Eigen::Map<const Eigen::MatrixXd> meshCoords = _mesh->vertexCoords();
+  assertion(meshCoords.rows() == _dimensions, meshCoords.rows(), _dimensions);
+  int size = (int) meshCoords.cols();
+  assertion(size == (int) _mesh->vertices().size(), size, _mesh->vertices().size());
+# ifdef Asserts
+  // Columns of the coordinates are ordered by vertex ID, the results are positions
+  for (int i=0; i < size; i++){
+    assertion(_mesh->vertices()[i].getID() == i, _mesh->vertices()[i].getID(), i);
+  }
+# endif // Asserts
+
+  std::vector<double> vertexCoords(meshCoords.data(), meshCoords.data() + size * _dimensions);
+
+  _vertexPositions.resize(size);
+  std::iota(_vertexPositions.begin(), _vertexPositions.end(), 0);
+  _splitDimensions.assign(size, -1);
+  buildSubtree(vertexCoords, 0, size);
+
+  // Store coordinates in tree order, to traverse them contiguously
+  _coords.resize(size * _dimensions);
+  for (int i=0; i < size; i++){
+    const double* coords = &vertexCoords[_vertexPositions[i] * _dimensions];
+    std::copy(coords, coords + _dimensions, &_coords[i * _dimensions]);
+  }
+  _isBuilt = true;
+}
+
+void VertexIndex:: buildSubtree
+(
+  const std::vector<double>& vertexCoords,
+  int                        begin,
+  int                        end )
+{
+  if (end - begin <= _leafSize){
+    return;
+  }
+
+  // Split along the dimension of largest extent
+  Eigen::VectorXd lowerBound = Eigen::VectorXd::Constant(_dimensions, std::numeric_limits<double>::max());
+  Eigen::VectorXd upperBound = Eigen::VectorXd::Constant(_dimensions, std::numeric_limits<double>::lowest());
+  for (int i=begin; i < end; i++){
+    const double* coords = &vertexCoords[_vertexPositions[i] * _dimensions];
+    for (int d=0; d < _dimensions; d++){
+      lowerBound[d] = std::min(lowerBound[d], coords[d]);
+      upperBound[d] = std::max(upperBound[d], coords[d]);
+    }
+  }
+  int splitDimension = 0;
+  (upperBound - lowerBound).maxCoeff(&splitDimension);
+
+  int median = begin + (end - begin) / 2;
+  int dim = _dimensions;
+  std::nth_element(_vertexPositions.begin() + begin, _vertexPositions.begin() + median,
+                   _vertexPositions.begin() + end,
+                   [&vertexCoords, splitDimension, dim] (int lhs, int rhs) {
+                     return vertexCoords[lhs * dim + splitDimension] < vertexCoords[rhs * dim + splitDimension];
+                   });
+  _splitDimensions[median] = splitDimension;
+  buildSubtree(vertexCoords, begin, median);
+  buildSubtree(vertexCoords, median + 1, end);
+}
+
+void VertexIndex:: searchClosest
+(
+  const double* point,
+  int           begin,
+  int           end,
+  int&          closest,
+  double&       squaredDistance ) const
+{
+  if (end - begin <= _leafSize){
+    for (int i=begin; i < end; i++){
+      testVertex(point, i, closest, squaredDistance);
+    }
+    return;
+  }
+
+  int median = begin + (end - begin) / 2;
+  int splitDimension = _splitDimensions[median];
+  assertion(splitDimension >= 0, splitDimension);
+  testVertex(point, median, closest, squaredDistance);
+
+  double distanceToPlane = point[splitDimension] - _coords[median * _dimensions + splitDimension];
+  if (distanceToPlane < 0.0){
+    searchClosest(point, begin, median, closest, squaredDistance);
+    if (distanceToPlane * distanceToPlane <= squaredDistance){
+      searchClosest(point, median + 1, end, closest, squaredDistance);
+    }
+  }
+  else {
+    searchClosest(point, median + 1, end, closest, squaredDistance);
+    if (distanceToPlane * distanceToPlane <= squaredDistance){
+      searchClosest(point, begin, median, closest, squaredDistance);
+    }
+  }
+}
+
+void VertexIndex:: searchRadius
+(
+  const double*     point,
+  int               begin,
+  int               end,
+  double            squaredRadius,
+  std::vector<int>& positions ) const
+{
+  if (end - begin <= _leafSize){
+    for (int i=begin; i < end; i++){
+      if (squaredDistanceTo(point, i) <= squaredRadius){
+        positions.push_back(_vertexPositions[i]);
+      }
+    }
+    return;
+  }
+
+  int median = begin + (end - begin) / 2;
+  int splitDimension = _splitDimensions[median];
+  assertion(splitDimension >= 0, splitDimension);
+  if (squaredDistanceTo(point, median) <= squaredRadius){
+    positions.push_back(_vertexPositions[median]);
+  }
+
+  double distanceToPlane = point[splitDimension] - _coords[median * _dimensions + splitDimension];
+  bool searchBoth = distanceToPlane * distanceToPlane <= squaredRadius;
+  if (searchBoth || (distanceToPlane < 0.0)){
+    searchRadius(point, begin, median, squaredRadius, positions);
+  }
+  if (searchBoth || (distanceToPlane >= 0.0)){
+    searchRadius(point, median + 1, end, squaredRadius, positions);
+  }
+}
+
+void VertexIndex:: searchBox
+(
+  const double*     lower,
+  const double*     upper,
+  int               begin,
+  int               end,
+  std::vector<int>& positions ) const
+{
+  if (end - begin <= _leafSize){
+    for (int i=begin; i < end; i++){
+      if (isInBox(lower, upper, i)){
+        positions.push_back(_vertexPositions[i]);
+      }
+    }
+    return;
+  }
+
+  int median = begin + (end - begin) / 2;
+  int splitDimension = _splitDimensions[median];
+  assertion(splitDimension >= 0, splitDimension);
+  if (isInBox(lower, upper, median)){
+    positions.push_back(_vertexPositions[median]);
+  }
+
+  // Equal coordinates can be on both sides of the median
+  double split = _coords[median * _dimensions + splitDimension];
+  if (lower[splitDimension] <= split){
+    searchBox(lower, upper, begin, median, positions);
+  }
+  if (upper[splitDimension] >= split){
+    searchBox(lower, upper, median + 1, end, positions);
+  }
+}
+
+bool VertexIndex:: isInBox
+(
+  const double* lower,
+  const double* upper,
+  int           treePosition ) const
+{
+  const double* coords = &_coords[treePosition * _dimensions];
+  for (int d=0; d < _dimensions; d++){
+    if ((coords[d] < lower[d]) || (coords[d] > upper[d])){
+      return false;
+    }
+  }
+  return true;
+}
+
+double VertexIndex:: squaredDistanceTo
+(
+  const double* point,
+  int           treePosition ) const
+{
+  const double* coords = &_coords[treePosition * _dimensions];
+  double distance = 0.0;
+  for (int d=0; d < _dimensions; d++){
+    double difference = coords[d] - point[d];
+    distance += difference * difference;
+  }
+  return distance;
+}
+
+void VertexIndex:: testVertex
+(
+  const double* point,
+  int           treePosition,
+  int&          closest,
+  double&       squaredDistance ) const
+{
+  double distance = squaredDistanceTo(point, treePosition);
+  if ((closest == -1) || (distance < squaredDistance)
+      || ((distance == squaredDistance)
+          && (_vertexPositions[treePosition] < _vertexPositions[closest])))
+  {
+    closest = treePosition;
+    squaredDistance = distance;
+  }
+}
+
+}} // namespace precice, query
@@ -0,0 +1,170 @@
+#pragma once
+
+#include "mesh/Mesh.hpp"
+#include "mesh/SharedPointer.hpp"
+#include "logging/Logger.hpp"
+#include <boost/noncopyable.hpp>
+#include <Eigen/Core>
+#include <vector>
+
+// ----------------------------------------------------------- CLASS DEFINITION
+
+namespace precice {
+namespace query {
+
+/**
+ * @brief Spatial index (k-d tree) over the vertices of one mesh.
+ *
+ * The tree is built lazily on the first query and stores the vertex
+ * coordinates in tree order in one contiguous array, such that queries do not
+ * allocate and do not dereference any mesh::Vertex objects. The index
+ * registers itself as listener of the mesh and is rebuilt on the next query
+ * after the mesh has notified a change, or after the number of vertices of the
+ * mesh has changed.
+ *
+ * Queries only read the tree, once it is built. After update(), one index can
+ * hence be queried concurrently by several threads, as long as the mesh does
+ * not change.
+ *
+ * Usage: query::FindClosestVertex::operator()(VertexIndex&).
+ */
+class VertexIndex : public mesh::Mesh::MeshListener, private boost::noncopyable
+{
+public:
+
+  /**
+   * @brief Constructor, registers the index as listener of the mesh.
+   *
+   * The tree itself is not built before the first query.
+   */
+  VertexIndex ( const mesh::PtrMesh& mesh );
+
+  /// Destructor, deregisters the index from the mesh.
+  virtual ~VertexIndex();
+
+  /// Returns the indexed mesh.
+  const mesh::PtrMesh& getMesh() const;
+
+  /// Marks the index as outdated, called by the mesh on changes.
+  virtual void meshChanged ( mesh::Mesh& mesh );
+
+  /// Marks the index as outdated, it is rebuilt on the next query.
+  void clear();
+
+  /// Builds the tree, if it does not represent the current vertices of the mesh.
+  void update();
+
+  /**
+   * @brief Returns the position in Mesh::vertices() of the vertex closest to point.
+   *
+   * Among vertices with equal distance, the one with the lowest position is
+   * returned, which gives the same result as a linear search.
+   *
+   * @param[in] point Search point, of same dimension as the mesh.
+   * @param[out] distance Euclidian distance to the closest vertex.
+   * @return Position of the closest vertex, or -1 if the mesh has no vertices.
+   */
+  int getClosestVertex (
+    const Eigen::VectorXd& point,
+    double&                distance );
+
+  /**
+   * @brief Appends the positions in Mesh::vertices() of all vertices within radius to positions.
+   *
+   * A vertex is within radius, if its Euclidian distance to point is not larger
+   * than radius. The positions are appended in ascending order.
+   */
+  void getVerticesInRadius (
+    const Eigen::VectorXd& point,
+    double                 radius,
+    std::vector<int>&      positions );
+
+  /**
+   * @brief Appends the positions in Mesh::vertices() of all vertices within a box to positions.
+   *
+   * A vertex is within the box, if lower[d] <= coords[d] <= upper[d] holds for
+   * all dimensions d. The positions are appended in ascending order.
+   */
+  void getVerticesInBox (
+    const Eigen::VectorXd& lower,
+    const Eigen::VectorXd& upper,
+    std::vector<int>&      positions );
+
+private:
+
+  /// Logging device.
+  static logging::Logger _log;
+
+  /// Maximum number of vertices in a leaf of the tree, searched linearly.
+  static const int _leafSize = 8;
+
+  /// Indexed mesh.
+  mesh::PtrMesh _mesh;
+
+  int _dimensions;
+
+  /// True, if the tree represents the current state of the mesh.
+  bool _isBuilt;
+
+  /// Vertex coordinates in tree order, _dimensions entries per vertex.
+  std::vector<double> _coords;
+
+  /// Position in Mesh::vertices() of the vertex at each tree position.
+  std::vector<int> _vertexPositions;
+
+  /// Split dimension of the subtree having its median at the tree position, -1 for leaves.
+  std::vector<int> _splitDimensions;
+
+  /// Builds the tree from the current vertices of the mesh.
+  void build();
+
+  /// Recursively sorts the tree positions [begin, end) into a k-d tree.
+  void buildSubtree (
+    const std::vector<double>& vertexCoords,
+    int                        begin,
+    int                        end );
+
+  /// Recursively searches the subtree stored at the tree positions [begin, end).
+  void searchClosest (
+    const double* point,
+    int           begin,
+    int           end,
+    int&          closest,
+    double&       squaredDistance ) const;
+
+  /// Recursively collects the subtree vertices within distance, appends their mesh positions.
+  void searchRadius (
+    const double*     point,
+    int               begin,
+    int               end,
+    double            squaredRadius,
+    std::vector<int>& positions ) const;
+
+  /// Recursively collects the subtree vertices within the box, appends their mesh positions.
+  void searchBox (
+    const double*     lower,
+    const double*     upper,
+    int               begin,
+    int               end,
+    std::vector<int>& positions ) const;
+
+  /// Returns true, if the vertex at tree position is within the box.
+  bool isInBox (
+    const double* lower,
+    const double* upper,
+    int           treePosition ) const;
+
+  /// Returns the squared distance from point to the vertex at tree position.
+  double squaredDistanceTo (
+    const double* point,
+    int           treePosition ) const;
+
+  /// Updates closest, if the vertex at tree position is closer to point.
+  void testVertex (
+    const double* point,
+    int           treePosition,
+    int&          closest,
+    double&       squaredDistance ) const;
+};
+
+}} // namespace precice, query
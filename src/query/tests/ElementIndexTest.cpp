@@ -0,0 +1,168 @@
+#include "ElementIndexTest.hpp"
+#include "query/ElementIndex.hpp"
+#include "mesh/Mesh.hpp"
+#include "mesh/Vertex.hpp"
+#include "mesh/Edge.hpp"
+#include "utils/Parallel.hpp"
+#include "utils/Threads.hpp"
+#include "math/math.hpp"
+#include "tarch/tests/TestCaseFactory.h"
+#include <random>
+registerTest(precice::query::tests::ElementIndexTest)
+
+namespace precice {
+namespace query {
+namespace tests {
+
+logging::Logger ElementIndexTest::_log("precice::query::tests::ElementIndexTest");
+
+ElementIndexTest:: ElementIndexTest()
+:
+  tarch::tests::TestCase("query::ElementIndexTest")
+{}
+
+void ElementIndexTest:: run()
+{
+  PRECICE_MASTER_ONLY {
+    testMethod(testEdges);
+    testMethod(testTriangles);
+    testMethod(testConcurrentQueries);
+  }
+}
+
+void ElementIndexTest:: testEdges()
+{
+  TRACE();
+  mesh::PtrMesh mesh(new mesh::Mesh("Mesh", 2, false));
+  int size = 200;
+  for (int i=0; i < size; i++){
+    double angle = 2.0 * math::PI * i / size;
+    mesh->createVertex(Eigen::Vector2d(std::cos(angle), std::sin(angle)));
+  }
+  for (int i=0; i < size; i++){
+    mesh->createEdge(mesh->vertices()[i], mesh->vertices()[(i + 1) % size]);
+  }
+  mesh->computeState();
+
+  ElementIndex index(mesh);
+  std::mt19937 generator(42);
+  std::uniform_real_distribution<double> distribution(-1.5, 1.5);
+  for (int i=0; i < 200; i++){
+    Eigen::Vector2d point(distribution(generator), distribution(generator));
+    FindClosest findLinear(point);
+    validate(findLinear(*mesh));
+    FindClosest findIndexed(point);
+    validate(findIndexed(index));
+    validateClosest(findIndexed.getClosest(), findLinear.getClosest());
+  }
+  // Search points coinciding with vertices
+  for (int i=0; i < size; i += 10){
+    FindClosest findLinear(mesh->vertices()[i].getCoords());
+    findLinear(*mesh);
+    FindClosest findIndexed(mesh->vertices()[i].getCoords());
+    findIndexed(index);
+    validateClosest(findIndexed.getClosest(), findLinear.getClosest());
+  }
+}
+
+void ElementIndexTest:: testTriangles()
+{
+  TRACE();
+  mesh::PtrMesh mesh(new mesh::Mesh("Mesh", 3, false));
+  int size = 20;
+  for (int i=0; i <= size; i++){
+    for (int j=0; j <= size; j++){
+      double x = (double) i / size;
+      double y = (double) j / size;
+      mesh->createVertex(Eigen::Vector3d(x, y, 0.2 * std::sin(3.0 * x) * std::cos(2.0 * y)));
+    }
+  }
+  auto vertex = [&mesh, size] (int i, int j) -> mesh::Vertex& {
+    return mesh->vertices()[i * (size + 1) + j];
+  };
+  for (int i=0; i < size; i++){
+    for (int j=0; j < size; j++){
+      mesh::Edge& e0 = mesh->createEdge(vertex(i, j), vertex(i+1, j));
+      mesh::Edge& e1 = mesh->createEdge(vertex(i+1, j), vertex(i+1, j+1));
+      mesh::Edge& e2 = mesh->createEdge(vertex(i+1, j+1), vertex(i, j));
+      mesh::Edge& e3 = mesh->createEdge(vertex(i, j), vertex(i+1, j+1));
+      mesh::Edge& e4 = mesh->createEdge(vertex(i+1, j+1), vertex(i, j+1));
+      mesh::Edge& e5 = mesh->createEdge(vertex(i, j+1), vertex(i, j));
+      mesh->createTriangle(e0, e1, e2);
+      mesh->createTriangle(e3, e4, e5);
+    }
+  }
+  mesh->computeState();
+
+  ElementIndex index(mesh);
+  std::mt19937 generator(42);
+  std::uniform_real_distribution<double> distribution(-0.5, 1.5);
+  for (int i=0; i < 300; i++){
+    Eigen::Vector3d point(distribution(generator), distribution(generator),
+                          0.2 * distribution(generator));
+    FindClosest findLinear(point);
+    validate(findLinear(*mesh));
+    FindClosest findIndexed(point);
+    validate(findIndexed(index));
+    validateClosest(findIndexed.getClosest(), findLinear.getClosest());
+  }
+}
+
+void ElementIndexTest:: testConcurrentQueries()
+{
+  TRACE();
+  mesh::PtrMesh mesh(new mesh::Mesh("Mesh", 2, false));
+  int size = 200;
+  for (int i=0; i < size; i++){
+    double angle = 2.0 * math::PI * i / size;
+    mesh->createVertex(Eigen::Vector2d(std::cos(angle), std::sin(angle)));
+  }
+  for (int i=0; i < size; i++){
+    mesh->createEdge(mesh->vertices()[i], mesh->vertices()[(i + 1) % size]);
+  }
+  mesh->computeState();
+
+  std::mt19937 generator(42);
+  std::uniform_real_distribution<double> distribution(-1.5, 1.5);
+  std::vector<Eigen::VectorXd> points;
+  for (int i=0; i < 400; i++){
+    points.push_back(Eigen::Vector2d(distribution(generator), distribution(generator)));
+  }
+
+  ElementIndex index(mesh);
+  index.update();
+  utils::Threads::setNumberOfThreads(4);
+  std::vector<ElementIndex::Buffer> buffers(utils::Threads::getNumberOfThreads());
+  std::vector<double> distances(points.size(), -1.0);
+  utils::Threads::parallelFor(0, points.size(), [&](int thread, int begin, int end){
+    for (int i=begin; i < end; i++){
+      FindClosest findIndexed(points[i]);
+      findIndexed(index.getCandidates(points[i], buffers[thread]));
+      distances[i] = findIndexed.getClosest().distance;
+    }
+  });
+  utils::Threads::setNumberOfThreads(1);
+
+  for (size_t i=0; i < points.size(); i++){
+    FindClosest findLinear(points[i]);
+    validate(findLinear(*mesh));
+    validateNumericalEquals(distances[i], findLinear.getClosest().distance);
+  }
+}
+
+void ElementIndexTest:: validateClosest
+(
+  const ClosestElement& indexed,
+  const ClosestElement& linear )
+{
+  validateNumericalEquals(indexed.distance, linear.distance);
+  validateEquals(indexed.interpolationElements.size(), linear.interpolationElements.size());
+  if (indexed.interpolationElements.size() == linear.interpolationElements.size()){
+    for (size_t i=0; i < linear.interpolationElements.size(); i++){
+      validateEquals(indexed.interpolationElements[i].element, linear.interpolationElements[i].element);
+      validateNumericalEquals(indexed.interpolationElements[i].weight, linear.interpolationElements[i].weight);
+    }
+  }
+}
+
+}}} // namespace precice, query, tests
@@ -0,0 +1,45 @@
+#pragma once
+
+#include "tarch/tests/TestCase.h"
+#include "logging/Logger.hpp"
+#include "query/FindClosest.hpp"
+
+namespace precice {
+namespace query {
+namespace tests {
+
+/**
+ * @brief Provides tests for class ElementIndex.
+ */
+class ElementIndexTest : public tarch::tests::TestCase
+{
+public:
+
+  ElementIndexTest();
+
+  virtual ~ElementIndexTest() {}
+
+  virtual void setUp() {}
+
+  virtual void run();
+
+private:
+
+  static logging::Logger _log;
+
+  /// Compares the indexed search to a search over a 2D circle of edges.
+  void testEdges();
+
+  /// Compares the indexed search to a search over a 3D surface of triangles.
+  void testTriangles();
+
+  /// Queries one index from several threads, each with its own buffer.
+  void testConcurrentQueries();
+
+  /// Validates that both closest elements have equal distances and interpolation elements.
+  void validateClosest (
+    const ClosestElement& indexed,
+    const ClosestElement& linear );
+};
+
+}}} // namespace precice, query, tests
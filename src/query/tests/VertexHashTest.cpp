@@ -0,0 +1,88 @@
+#include "VertexHashTest.hpp"
+#include "query/VertexHash.hpp"
+#include "mesh/Mesh.hpp"
+#include "mesh/Vertex.hpp"
+#include "utils/Parallel.hpp"
+#include "math/math.hpp"
+#include "tarch/tests/TestCaseFactory.h"
+#include <random>
+registerTest(precice::query::tests::VertexHashTest)
+
+namespace precice {
+namespace query {
+namespace tests {
+
+logging::Logger VertexHashTest::_log("precice::query::tests::VertexHashTest");
+
+VertexHashTest:: VertexHashTest()
+:
+  tarch::tests::TestCase("query::VertexHashTest")
+{}
+
+void VertexHashTest:: run()
+{
+  PRECICE_MASTER_ONLY {
+    testMethod(testVertexAt);
+    testMethod(testDuplicatesAndChanges);
+  }
+}
+
+void VertexHashTest:: testVertexAt()
+{
+  TRACE();
+  std::mt19937 generator(42);
+  std::uniform_real_distribution<double> distribution(-1.0, 1.0);
+  for (int dim=2; dim <= 3; dim++){
+    mesh::PtrMesh mesh(new mesh::Mesh("Mesh", dim, false));
+    Eigen::VectorXd coords(dim);
+    for (int i=0; i < 1000; i++){
+      for (int d=0; d < dim; d++){
+        coords[d] = distribution(generator);
+      }
+      mesh->createVertex(coords);
+    }
+
+    VertexHash hash(mesh);
+    for (mesh::Vertex& vertex : mesh->vertices()){
+      validateEquals(hash.getVertexAt(vertex.getCoords()), vertex.getID());
+    }
+    for (int i=0; i < 100; i++){
+      for (int d=0; d < dim; d++){
+        coords[d] = 1.5 * distribution(generator);
+      }
+      validateEquals(hash.getVertexAt(coords), -1);
+    }
+  }
+}
+
+void VertexHashTest:: testDuplicatesAndChanges()
+{
+  TRACE();
+  mesh::PtrMesh mesh(new mesh::Mesh("Mesh", 3, false));
+  mesh->createVertex(Eigen::Vector3d(0.0, 0.0, 0.0));
+  mesh->createVertex(Eigen::Vector3d(1.0, 2.0, 3.0));
+  mesh->createVertex(Eigen::Vector3d(1.0, 2.0, 3.0));
+  VertexHash hash(mesh);
+
+  // The first of duplicate vertices is found, as by a linear search
+  validateEquals(hash.getVertexAt(Eigen::Vector3d(1.0, 2.0, 3.0)), 1);
+  validateEquals(hash.getVertexAt(Eigen::Vector3d(0.0, 0.0, 0.0)), 0);
+
+  // Positions are compared with the tolerance of math::equals()
+  Eigen::Vector3d shifted(1.0, 2.0, 3.0 + 1e-15);
+  validateEquals(hash.getVertexAt(shifted), 1);
+  shifted(2) = 3.0 + 1e-10;
+  validateEquals(hash.getVertexAt(shifted), -1);
+
+  // Added vertices are found after a rebuild
+  mesh->createVertex(Eigen::Vector3d(-5.0, 4.0, 2.0));
+  validateEquals(hash.getVertexAt(Eigen::Vector3d(-5.0, 4.0, 2.0)), 3);
+
+  // Moved vertices are found after the mesh notified the change
+  mesh->vertices()[0].setCoords(Eigen::Vector3d(7.0, 7.0, 7.0));
+  mesh->notifyListeners();
+  validateEquals(hash.getVertexAt(Eigen::Vector3d(7.0, 7.0, 7.0)), 0);
+  validateEquals(hash.getVertexAt(Eigen::Vector3d(0.0, 0.0, 0.0)), -1);
+}
+
+}}} // namespace precice, query, tests
@@ -0,0 +1,36 @@
+#pragma once
+
+#include "tarch/tests/TestCase.h"
+#include "logging/Logger.hpp"
+
+namespace precice {
+namespace query {
+namespace tests {
+
+/**
+ * @brief Provides tests for class VertexHash.
+ */
+class VertexHashTest : public tarch::tests::TestCase
+{
+public:
+
+  VertexHashTest();
+
+  virtual ~VertexHashTest() {}
+
+  virtual void setUp() {}
+
+  virtual void run();
+
+private:
+
+  static logging::Logger _log;
+
+  /// Looks up all vertices of random 2D and 3D meshes, and positions not in the mesh.
+  void testVertexAt();
+
+  /// Tests duplicate vertices, positions within the tolerance and rebuilding after mesh changes.
+  void testDuplicatesAndChanges();
+};
+
+}}} // namespace precice, query, tests
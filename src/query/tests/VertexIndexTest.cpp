@@ -0,0 +1,194 @@
+#include "VertexIndexTest.hpp"
+#include "query/VertexIndex.hpp"
+#include "query/FindClosestVertex.hpp"
+#include "mesh/Mesh.hpp"
+#include "mesh/Vertex.hpp"
+#include "utils/Parallel.hpp"
+#include "math/math.hpp"
+#include "tarch/tests/TestCaseFactory.h"
+#include <random>
+registerTest(precice::query::tests::VertexIndexTest)
+
+namespace precice {
+namespace query {
+namespace tests {
+
+logging::Logger VertexIndexTest::_log("precice::query::tests::VertexIndexTest");
+
+VertexIndexTest:: VertexIndexTest()
+:
+  tarch::tests::TestCase("query::VertexIndexTest")
+{}
+
+void VertexIndexTest:: run()
+{
+  PRECICE_MASTER_ONLY {
+    testMethod(testClosestVertex);
+    testMethod(testVerticesInRadius);
+    testMethod(testVerticesInBox);
+    testMethod(testTiesAndChanges);
+  }
+}
+
+void VertexIndexTest:: testClosestVertex()
+{
+  TRACE();
+  std::mt19937 generator(42);
+  std::uniform_real_distribution<double> distribution(-1.0, 1.0);
+  for (int dim=2; dim <= 3; dim++){
+    mesh::PtrMesh mesh(new mesh::Mesh("Mesh", dim, false));
+    Eigen::VectorXd coords(dim);
+    for (int i=0; i < 1000; i++){
+      for (int d=0; d < dim; d++){
+        coords[d] = distribution(generator);
+      }
+      mesh->createVertex(coords);
+    }
+
+    VertexIndex index(mesh);
+    for (int i=0; i < 200; i++){
+      for (int d=0; d < dim; d++){
+        coords[d] = 1.5 * distribution(generator);
+      }
+      FindClosestVertex findLinear(coords);
+      validate(findLinear(*mesh));
+      FindClosestVertex findIndexed(coords);
+      validate(findIndexed(index));
+      validateEquals(findIndexed.getClosestVertex().getID(),
+                     findLinear.getClosestVertex().getID());
+      validateNumericalEquals(findIndexed.getEuclidianDistance(),
+                              findLinear.getEuclidianDistance());
+    }
+  }
+}
+
+void VertexIndexTest:: testVerticesInRadius()
+{
+  TRACE();
+  std::mt19937 generator(42);
+  std::uniform_real_distribution<double> distribution(-1.0, 1.0);
+  mesh::PtrMesh mesh(new mesh::Mesh("Mesh", 3, false));
+  Eigen::VectorXd coords(3);
+  for (int i=0; i < 1000; i++){
+    for (int d=0; d < 3; d++){
+      coords[d] = distribution(generator);
+    }
+    mesh->createVertex(coords);
+  }
+
+  VertexIndex index(mesh);
+  std::vector<int> positions;
+  for (double radius : {0.0, 0.1, 0.3, 4.0}){
+    for (int i=0; i < 50; i++){
+      for (int d=0; d < 3; d++){
+        coords[d] = 1.5 * distribution(generator);
+      }
+      std::vector<int> expected;
+      for (const mesh::Vertex& vertex : mesh->vertices()){
+        if ((vertex.getCoords() - coords).squaredNorm() <= radius * radius){
+          expected.push_back(vertex.getID());
+        }
+      }
+      positions.clear();
+      index.getVerticesInRadius(coords, radius, positions);
+      validate(positions == expected);
+    }
+  }
+
+  // Positions are appended, vertices on the radius are included
+  mesh::PtrMesh grid(new mesh::Mesh("Grid", 2, false));
+  for (int i=0; i < 5; i++){
+    for (int j=0; j < 5; j++){
+      grid->createVertex(Eigen::Vector2d(i, j));
+    }
+  }
+  VertexIndex gridIndex(grid);
+  positions.assign(1, -1);
+  gridIndex.getVerticesInRadius(Eigen::Vector2d(2.0, 2.0), 1.0, positions);
+  validate(positions == std::vector<int>({-1, 7, 11, 12, 13, 17}));
+}
+
+void VertexIndexTest:: testVerticesInBox()
+{
+  TRACE();
+  std::mt19937 generator(42);
+  std::uniform_real_distribution<double> distribution(-1.0, 1.0);
+  mesh::PtrMesh mesh(new mesh::Mesh("Mesh", 3, false));
+  Eigen::VectorXd coords(3);
+  for (int i=0; i < 1000; i++){
+    for (int d=0; d < 3; d++){
+      coords[d] = distribution(generator);
+    }
+    mesh->createVertex(coords);
+  }
+
+  VertexIndex index(mesh);
+  std::vector<int> positions;
+  Eigen::VectorXd lower(3);
+  Eigen::VectorXd upper(3);
+  for (int i=0; i < 50; i++){
+    for (int d=0; d < 3; d++){
+      double first = 1.5 * distribution(generator);
+      double second = 1.5 * distribution(generator);
+      lower[d] = std::min(first, second);
+      upper[d] = std::max(first, second);
+    }
+    std::vector<int> expected;
+    for (const mesh::Vertex& vertex : mesh->vertices()){
+      if ((vertex.getCoords().array() >= lower.array()).all()
+          && (vertex.getCoords().array() <= upper.array()).all()){
+        expected.push_back(vertex.getID());
+      }
+    }
+    positions.clear();
+    index.getVerticesInBox(lower, upper, positions);
+    validate(positions == expected);
+  }
+
+  // Vertices on the faces of the box are included
+  mesh::PtrMesh grid(new mesh::Mesh("Grid", 2, false));
+  for (int i=0; i < 5; i++){
+    for (int j=0; j < 5; j++){
+      grid->createVertex(Eigen::Vector2d(i, j));
+    }
+  }
+  VertexIndex gridIndex(grid);
+  positions.clear();
+  gridIndex.getVerticesInBox(Eigen::Vector2d(1.0, 3.0), Eigen::Vector2d(2.0, 4.0), positions);
+  validate(positions == std::vector<int>({8, 9, 13, 14}));
+}
+
+void VertexIndexTest:: testTiesAndChanges()
+{
+  TRACE();
+  mesh::PtrMesh mesh(new mesh::Mesh("Mesh", 2, false));
+  VertexIndex index(mesh);
+  double distance = 0.0;
+  validateEquals(index.getClosestVertex(Eigen::Vector2d(0.0, 0.0), distance), -1);
+
+  // Regular grid with many equidistant vertices
+  for (int i=0; i < 20; i++){
+    for (int j=0; j < 20; j++){
+      mesh->createVertex(Eigen::Vector2d(i, j));
+    }
+  }
+  Eigen::Vector2d point(4.5, 7.5);
+  FindClosestVertex findLinear(point);
+  findLinear(*mesh);
+  validateEquals(index.getClosestVertex(point, distance),
+                 findLinear.getClosestVertex().getID());
+  validateNumericalEquals(distance, std::sqrt(0.5));
+
+  // Moved vertices are found after the mesh notified its listeners
+  mesh->vertices()[399].setCoords(Eigen::Vector2d(4.5, 7.4));
+  mesh->notifyListeners();
+  validateEquals(index.getClosestVertex(point, distance), 399);
+  validateNumericalEquals(distance, 0.1);
+
+  // Added vertices are found without notification
+  mesh->createVertex(Eigen::Vector2d(4.5, 7.5));
+  validateEquals(index.getClosestVertex(point, distance), 400);
+  validateNumericalEquals(distance, 0.0);
+}
+
+}}} // namespace precice, query, tests
@@ -0,0 +1,42 @@
+#pragma once
+
+#include "tarch/tests/TestCase.h"
+#include "logging/Logger.hpp"
+
+namespace precice {
+namespace query {
+namespace tests {
+
+/**
+ * @brief Provides tests for class VertexIndex.
+ */
+class VertexIndexTest : public tarch::tests::TestCase
+{
+public:
+
+  VertexIndexTest();
+
+  virtual ~VertexIndexTest() {}
+
+  virtual void setUp() {}
+
+  virtual void run();
+
+private:
+
+  static logging::Logger _log;
+
+  /// Compares the indexed search to a linear search over 2D and 3D meshes.
+  void testClosestVertex();
+
+  /// Compares the radius search to a linear search, including vertices on the radius.
+  void testVerticesInRadius();
+
+  /// Compares the box search to a linear search, including vertices on the box faces.
+  void testVerticesInBox();
+
+  /// Tests equidistant vertices and rebuilding after mesh changes.
+  void testTiesAndChanges();
+};
+
+}}} // namespace precice, query, tests
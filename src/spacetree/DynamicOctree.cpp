@@ -18,7 +18,7 @@ DynamicOctree:: DynamicOctree
   _center(center),
   _halflength(halflength),
   _refinementLimit(refinementLimit),
-  _rootCell(),
+  _tree(center, halflength),
   _meshChanged(true)
 {}
 
@@ -27,7 +27,7 @@ void DynamicOctree:: addMesh
   const mesh::PtrMesh& mesh )
 {
   TRACE(mesh->getName());
-  assertion(_rootCell.content().empty()); // Spacetree is not initialized yet
+  assertion(_tree.content(0).empty()); // Spacetree is not initialized yet
   _meshes.push_back(mesh);
   mesh->addListener(*this);
 }
@@ -40,7 +40,7 @@ const std::vector<mesh::PtrMesh>& DynamicOctree:: meshes() const
 void DynamicOctree:: initialize()
 {
   TRACE();
-  assertion(_rootCell.content().empty()); // Spacetree is not initialized yet
+  assertion(_tree.content(0).empty()); // Spacetree is not initialized yet
   int dim = _center.size();
   query::FindVoxelContent findVoxel(_center,
                                     Eigen::VectorXd::Constant(dim,_halflength),
@@ -51,9 +51,9 @@ void DynamicOctree:: initialize()
     size += mesh->content().size();
     findVoxel(*mesh);
   }
-  _rootCell.content().add(findVoxel.content());
-  _rootCell.setPosition(positionOnGeometry());
-  CHECK((int)_rootCell.content().size() == size, "Not all meshes are contained in the spacetree!");
+  _tree.content(0).add(findVoxel.content());
+  _tree.setPosition(0, positionOnGeometry());
+  CHECK((int)_tree.content(0).size() == size, "Not all meshes are contained in the spacetree!");
   _meshChanged = false;
 }
 
@@ -75,11 +75,8 @@ int DynamicOctree:: searchPosition
     clear();
     initialize();
   }
-  impl::DynamicTraversal<impl::OctreeCell> traversal;
-  Eigen::VectorXd halflengths = Eigen::VectorXd::Constant(point.size(), _halflength);
-
-  return traversal.searchPosition ( _rootCell, point, _center, halflengths,
-                                    _refinementLimit );
+  impl::DynamicTraversal traversal(_tree, _refinementLimit);
+  return traversal.searchPosition(point);
 }
 
 void DynamicOctree:: searchDistance
@@ -92,11 +89,8 @@ void DynamicOctree:: searchDistance
     clear();
     initialize();
   }
-  impl::DynamicTraversal<impl::OctreeCell> traversal;
-  Eigen::VectorXd halflengths = Eigen::VectorXd::Constant(findClosest.getSearchPoint().size(), _halflength);
-
-  traversal.searchDistance ( _rootCell, findClosest, _center, halflengths,
-                             _refinementLimit );
+  impl::DynamicTraversal traversal(_tree, _refinementLimit);
+  traversal.searchDistance(findClosest);
 }
 
 int DynamicOctree:: searchContent
@@ -109,10 +103,8 @@ int DynamicOctree:: searchContent
     clear();
     initialize();
   }
-  impl::DynamicTraversal<impl::OctreeCell> traversal;
-  Eigen::VectorXd halflengths = Eigen::VectorXd::Constant(findContent.getVoxelCenter().size(), _halflength);
-  return traversal.searchContent ( _rootCell, findContent, _center, halflengths,
-                                   _refinementLimit );
+  impl::DynamicTraversal traversal(_tree, _refinementLimit);
+  return traversal.searchContent(findContent);
 }
 
 void DynamicOctree:: accept ( Visitor& visitor )
@@ -123,15 +115,14 @@ void DynamicOctree:: accept ( Visitor& visitor )
     clear();
     initialize();
   }
-  Eigen::VectorXd halflengths = Eigen::VectorXd::Constant(_center.size(), _halflength);
-  _rootCell.accept(visitor, _center, halflengths);
+  _tree.accept(visitor);
 }
 
 void DynamicOctree:: clear()
 {
   TRACE();
-  _rootCell.clear();
-  assertion(_rootCell.content().empty());
+  _tree.clear();
+  assertion(_tree.content(0).empty());
 }
 
 }} // namespace precice, spacetree
@@ -1,7 +1,7 @@
 #pragma once
 
 #include "spacetree/Spacetree.hpp"
-#include "spacetree/impl/OctreeCell.hpp"
+#include "spacetree/impl/LinearOctree.hpp"
 #include <vector>
 
 namespace precice {
@@ -58,7 +58,7 @@ private:
 
   double _refinementLimit;
 
-  impl::OctreeCell _rootCell;
+  impl::LinearOctree _tree;
 
   bool _meshChanged;
 };
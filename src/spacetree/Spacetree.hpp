@@ -107,6 +107,15 @@ public:
    */
   virtual int searchContent ( query::FindVoxelContent& find ) =0;
 
+  /**
+   * @brief Prepares searchPosition() and searchDistance() for concurrent calls.
+   *
+   * Returns false, if the spacetree is modified by searches and, hence, may
+   * only be searched by one thread at a time. The preparation is valid until
+   * a contained mesh changes.
+   */
+  virtual bool prepareConcurrentSearch() { return false; }
+
   /**
    * @brief Traverses each cell of the spacetree
    */
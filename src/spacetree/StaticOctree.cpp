@@ -19,7 +19,7 @@ StaticOctree:: StaticOctree
   _center(center),
   _halflength(halflength),
   _refinementLimit(refinementLimit),
-  _rootCell(),
+  _tree(center, halflength),
   _meshChanged(true)
 {}
 
@@ -28,7 +28,7 @@ void StaticOctree:: addMesh
   const mesh::PtrMesh& mesh )
 {
   TRACE(mesh->getName());
-  assertion(_rootCell.content().empty()); // Spacetree is not initialized yet
+  assertion(_tree.content(0).empty()); // Spacetree is not initialized yet
   _meshes.push_back(mesh);
   mesh->addListener(*this);
 }
@@ -41,7 +41,7 @@ const std::vector<mesh::PtrMesh>& StaticOctree:: meshes() const
 void StaticOctree:: initialize()
 {
   TRACE();
-  assertion(_rootCell.content().empty());
+  assertion(_tree.content(0).empty());
   int dim = _center.size();
   query::FindVoxelContent findVoxel ( _center, Eigen::VectorXd::Constant(dim,_halflength),
       query::FindVoxelContent::INCLUDE_BOUNDARY );
@@ -51,12 +51,10 @@ void StaticOctree:: initialize()
     size += mesh->content().size();
     findVoxel(*mesh);
   }
-  _rootCell.content().add(findVoxel.content());
-  _rootCell.setPosition(positionOnGeometry());
-  preciceCheck(_rootCell.content().size() == size, "initialize()",
+  _tree.content(0).add(findVoxel.content());
+  _tree.setPosition(0, positionOnGeometry());
+  preciceCheck(_tree.content(0).size() == size, "initialize()",
                "Not all meshes are contained in the spacetree!");
-  impl::StaticTraversal<impl::OctreeCell> traversal;
-  Eigen::VectorXd halflengths = Eigen::VectorXd::Constant(dim, _halflength);
   int twoPowerDim = std::pow(2.0, dim);
   int sides = (dim == 2) ? 4 : 6;
   impl::Environment env(twoPowerDim, sides);
@@ -119,7 +117,9 @@ void StaticOctree:: initialize()
     indices << 0, 2, 4; // Side 7
     env.setNeighborSideIndices(7, indices);
   }
-  traversal.refineAll(_rootCell, _center, halflengths, _refinementLimit, env);
+  impl::StaticTraversal traversal(_tree);
+  traversal.refineAll(_refinementLimit, env);
+  _tree.sortDepthFirst();
   _meshChanged = false;
 }
 
@@ -139,9 +139,8 @@ int StaticOctree:: searchPosition
     clear();
     initialize();
   }
-  impl::StaticTraversal<impl::OctreeCell> traversal;
-  Eigen::VectorXd halflengths = Eigen::VectorXd::Constant(point.size(), _halflength);
-  return traversal.searchPosition ( _rootCell, point, _center, halflengths );
+  impl::StaticTraversal traversal(_tree);
+  return traversal.searchPosition(point);
 }
 
 void StaticOctree:: searchDistance
@@ -154,9 +153,8 @@ void StaticOctree:: searchDistance
     clear();
     initialize();
   }
-  impl::StaticTraversal<impl::OctreeCell> traversal;
-  Eigen::VectorXd halflengths = Eigen::VectorXd::Constant(findClosest.getSearchPoint().size(), _halflength);
-  traversal.searchDistance ( _rootCell, findClosest, _center, halflengths );
+  impl::StaticTraversal traversal(_tree);
+  traversal.searchDistance(findClosest);
 }
 
 int StaticOctree:: searchContent
@@ -169,9 +167,19 @@ int StaticOctree:: searchContent
     clear();
     initialize();
   }
-  impl::StaticTraversal<impl::OctreeCell> traversal;
-  Eigen::VectorXd halflengths = Eigen::VectorXd::Constant(findContent.getVoxelCenter().size(), _halflength);
-  return traversal.searchContent ( _rootCell, findContent, _center, halflengths );
+  impl::StaticTraversal traversal(_tree);
+  return traversal.searchContent(findContent);
+}
+
+bool StaticOctree:: prepareConcurrentSearch()
+{
+  TRACE();
+  if (_meshChanged){
+    DEBUG("A mesh has changed recently, rebuilding spacetree");
+    clear();
+    initialize();
+  }
+  return true;
 }
 
 void StaticOctree:: accept ( Visitor& visitor )
@@ -182,15 +190,14 @@ void StaticOctree:: accept ( Visitor& visitor )
     clear();
     initialize();
   }
-  Eigen::VectorXd halflengths = Eigen::VectorXd::Constant(_center.size(), _halflength);
-  _rootCell.accept(visitor, _center, halflengths);
+  _tree.accept(visitor);
 }
 
 void StaticOctree:: clear()
 {
   TRACE();
-  _rootCell.clear();
-  assertion(_rootCell.content().empty());
+  _tree.clear();
+  assertion(_tree.content(0).empty());
 }
 
 }} // namespace precice, spacetree
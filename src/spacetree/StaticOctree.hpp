@@ -1,7 +1,7 @@
 #pragma once
 
 #include "spacetree/Spacetree.hpp"
-#include "spacetree/impl/OctreeCell.hpp"
+#include "spacetree/impl/LinearOctree.hpp"
 
 namespace precice {
 namespace spacetree {
@@ -71,6 +71,11 @@ public:
    */
   virtual int searchContent ( query::FindVoxelContent& find );
 
+  /**
+   * @brief Rebuilds the tree, if a mesh has changed, searches are read-only then.
+   */
+  virtual bool prepareConcurrentSearch();
+
   /**
    * @brief Visitor entry to visit all cells of the spacetree.
    */
@@ -97,8 +102,8 @@ private:
   // @brief Guaranteed max sidelengths of fully refined cell.
   double _refinementLimit;
 
-  // @brief Root cell data structure.
-  impl::OctreeCell _rootCell;
+  // @brief Cells of the tree.
+  impl::LinearOctree _tree;
 
   // @brief Flag to signal that a contained mesh has changed.
   bool _meshChanged;
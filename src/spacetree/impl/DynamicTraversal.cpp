@@ -0,0 +1,281 @@
+#include "DynamicTraversal.hpp"
+#include "query/FindClosest.hpp"
+#include "query/FindVoxelContent.hpp"
+#include "math/math.hpp"
+
+namespace precice {
+namespace spacetree {
+namespace impl {
+
+logging::Logger DynamicTraversal:: _log("precice::spacetree::impl::DynamicTraversal");
+
+DynamicTraversal:: DynamicTraversal
+(
+  LinearOctree& tree,
+  double        refinementLimit )
+:
+  _tree(tree),
+  _refinementLimit(refinementLimit)
+{}
+
+int DynamicTraversal:: searchPosition
+(
+  const Eigen::VectorXd& searchPoint )
+{
+  TRACE(searchPoint, _refinementLimit);
+  query::FindClosest findClosest(searchPoint);
+  SearchPositionResult result = searchPositionInternal(
+      0, _tree.getCenter(), _tree.getHalflength(), searchPoint, findClosest);
+  assertion(result.position != Spacetree::positionUndefined());
+
+  // Compute position of uncached empty cell
+  if (result.uncachedCell != -1){
+    DEBUG("Computing position of cell at center " << result.uncachedCellCenter);
+    assertion(_tree.getPosition(result.uncachedCell) == Spacetree::positionUndefined());
+    assertion(_tree.content(result.uncachedCell).empty());
+    Eigen::VectorXd cellCenter = result.uncachedCellCenter;
+    query::FindClosest findCellPosition(cellCenter);
+    SearchPositionResult cellResult = searchPositionInternal(
+        0, _tree.getCenter(), _tree.getHalflength(), cellCenter, findCellPosition);
+    assertion(cellResult.position != Spacetree::positionUndefined());
+    assertion(cellResult.position != Spacetree::positionOnGeometry());
+    _tree.setPosition(result.uncachedCell, cellResult.position);
+  }
+  DEBUG("Return position = " << result.position);
+  return result.position;
+}
+
+void DynamicTraversal:: searchDistance
+(
+  query::FindClosest& findClosest )
+{
+  TRACE(findClosest.getSearchPoint(), _refinementLimit);
+  searchDistanceInternal(0, _tree.getCenter(), _tree.getHalflength(), findClosest);
+}
+
+int DynamicTraversal:: searchContent
+(
+  query::FindVoxelContent& findContent )
+{
+  TRACE(findContent.getVoxelCenter(), findContent.getVoxelHalflengths());
+  int position = searchContentInternal(0, _tree.getCenter(), _tree.getHalflength(),
+                                       findContent);
+  if (position == Spacetree::positionUndefined()){
+    // Some/all searched cells had content, but not in the search voxel
+    DEBUG("Computing position of search voxel");
+    query::FindClosest findDistance(findContent.getVoxelCenter());
+    searchDistance(findDistance);
+    double distance = findDistance.getClosest().distance;
+    assertion(not math::equals(distance, 0.0));
+    position = distance > 0 ? Spacetree::positionOutsideOfGeometry()
+                            : Spacetree::positionInsideOfGeometry();
+  }
+  DEBUG("return content().size() = " << findContent.content().size()
+        << ", position = " << position);
+  return position;
+}
+
+DynamicTraversal::SearchPositionResult DynamicTraversal:: searchPositionInternal
+(
+  int                    cell,
+  const Coords&          center,
+  double                 halflength,
+  const Eigen::VectorXd& searchPoint,
+  query::FindClosest&    findClosest )
+{
+  TRACE(cell, center, halflength);
+  SearchPositionResult result {Spacetree::positionUndefined(), false, -1, Coords()};
+  double distance = 0.0;
+  if (_tree.isLeaf(cell)){
+    DEBUG("  Leaf");
+    if (_tree.needsRefinement(cell, halflength, _refinementLimit)){
+      DEBUG("    Needs refinement");
+      assertion(not _tree.content(cell).empty());
+      _tree.refine(cell, center, halflength);
+    }
+    else if (_tree.getPosition(cell) == Spacetree::positionOnGeometry()){
+      DEBUG("    Has content");
+      findClosest(_tree.content(cell));
+      if (findClosest.hasFound()){
+        DEBUG("    Found elements");
+        distance = findClosest.getClosest().distance;
+        result.position = Spacetree::positionOnGeometry(); // May by altered later
+      }
+    }
+    else {
+      DEBUG("    Is empty");
+      assertion(_tree.content(cell).empty());
+      result.position = _tree.getPosition(cell);
+      if (result.position == Spacetree::positionUndefined()){
+        DEBUG("    Has undefined position");
+        result.uncachedCell = cell;
+        result.uncachedCellCenter = center;
+      }
+    }
+  }
+
+  if (not _tree.isLeaf(cell)){ // could be a leaf on entrance to searchPositionInternal
+    DEBUG("  Node");
+    assertion(_tree.getPosition(cell) == Spacetree::positionOnGeometry());
+    int childIndex = _tree.getChildIndex(searchPoint, center);
+    Coords childCenter(center.size());
+    _tree.getChildCenter(childIndex, center, halflength, childCenter);
+    result = searchPositionInternal(_tree.child(cell, childIndex), childCenter,
+                                    0.5 * halflength, searchPoint, findClosest);
+    if ((result.position == Spacetree::positionUndefined()) || result.ambiguous){
+      DEBUG("    Did not find elements or ambiguous, visit others");
+      _tree.visitRemainingLeaves(cell, childIndex, findClosest);
+      if (findClosest.hasFound()){
+        DEBUG("    Found elements in others");
+        distance = findClosest.getClosest().distance;
+        result.position = Spacetree::positionOnGeometry();
+        result.ambiguous = false;
+      }
+    }
+  }
+
+  // Set inside/outside and check for ambiguities
+  if (not math::equals(distance, 0.0)){
+    DEBUG("  Checking for ambiguities of found objects");
+    if (math::greater(distance, 0.0)){
+      result.position = Spacetree::positionOutsideOfGeometry();
+    }
+    else if (math::greater(0.0, distance)){
+      result.position = Spacetree::positionInsideOfGeometry();
+    }
+    DEBUG("  found pos = " << result.position);
+    double distanceToBound = _tree.distanceToBoundary(center, halflength, searchPoint);
+    if (math::greater(std::abs(distance), distanceToBound)){
+      DEBUG("  is ambigious");
+      result.ambiguous = true;
+    }
+  }
+  DEBUG("  return position = " << result.position << ", ambiguous = " << result.ambiguous);
+  return result;
+}
+
+bool DynamicTraversal:: searchDistanceInternal
+(
+  int                 cell,
+  const Coords&       center,
+  double              halflength,
+  query::FindClosest& findClosest )
+{
+  TRACE(cell, center, halflength);
+  if (_tree.isLeaf(cell)){
+    DEBUG("  Leaf");
+    if (_tree.needsRefinement(cell, halflength, _refinementLimit)){
+      DEBUG("    Needs refinement");
+      assertion(not _tree.content(cell).empty());
+      _tree.refine(cell, center, halflength);
+    }
+    else {
+      DEBUG("    Needs no refinement, apply findClosest");
+      findClosest(_tree.content(cell));
+    }
+  }
+
+  if (not _tree.isLeaf(cell)){
+    DEBUG("  Node");
+    int childIndex = _tree.getChildIndex(findClosest.getSearchPoint(), center);
+    Coords childCenter(center.size());
+    _tree.getChildCenter(childIndex, center, halflength, childCenter);
+    bool ambiguous = searchDistanceInternal(_tree.child(cell, childIndex), childCenter,
+                                            0.5 * halflength, findClosest);
+    if (ambiguous){
+      _tree.visitRemainingLeaves(cell, childIndex, findClosest);
+    }
+  }
+
+  if (findClosest.hasFound()){
+    double distance = _tree.distanceToBoundary(center, halflength,
+                                               findClosest.getSearchPoint());
+    bool isAmbiguous = math::greater(findClosest.getEuclidianDistance(), distance);
+    DEBUG("  hasfound, return ambiguous = " << isAmbiguous);
+    return isAmbiguous;
+  }
+  DEBUG("  return ambiguous or not found");
+  return true;
+}
+
+int DynamicTraversal:: searchContentInternal
+(
+  int                      cell,
+  const Coords&            center,
+  double                   halflength,
+  query::FindVoxelContent& findContent )
+{
+  TRACE(cell, center, halflength);
+  int position = Spacetree::positionUndefined();
+  if (_tree.isLeaf(cell)){
+    DEBUG("Leaf...");
+    if (_tree.needsRefinement(cell, halflength, _refinementLimit)){
+      DEBUG("Needs refinement...");
+      _tree.refine(cell, center, halflength);
+    }
+    else {
+      DEBUG("Don't needs refinement...");
+      if ((_tree.getPosition(cell) == Spacetree::positionOutsideOfGeometry())
+          || (_tree.getPosition(cell) == Spacetree::positionInsideOfGeometry()))
+      {
+        DEBUG("empty, position = " << _tree.getPosition(cell));
+        position = _tree.getPosition(cell);
+      }
+      else if (_tree.getPosition(cell) == Spacetree::positionUndefined()){
+        DEBUG("empty, undefined position");
+      }
+      else {
+        DEBUG("content size = " << _tree.content(cell).size());
+        assertion(_tree.getPosition(cell) == Spacetree::positionOnGeometry());
+        assertion(not _tree.content(cell).empty());
+        bool set = _tree.isCovered(center, halflength, findContent.getVoxelCenter(),
+                                   findContent.getVoxelHalflengths());
+        set &= findContent.getBoundaryInclusion() == query::FindVoxelContent::INCLUDE_BOUNDARY;
+        if (set){
+          DEBUG("Is covered by voxel...");
+          findContent.content().add(_tree.content(cell));
+          position = Spacetree::positionOnGeometry();
+        }
+        else {
+          DEBUG("Isn't covered by voxel...");
+          findContent(_tree.content(cell));
+          if (not findContent.content().empty()){
+            position = Spacetree::positionOnGeometry();
+          }
+        }
+      }
+      DEBUG("return size = " << findContent.content().size() << ", pos = " << position);
+      return position;
+    }
+  }
+
+  DEBUG("Node...");
+  Coords childCenter(center.size());
+  for (int i=0; i < _tree.getChildCount(); i++){
+    _tree.getChildCenter(i, center, halflength, childCenter);
+    if (_tree.isOverlapped(childCenter, 0.5 * halflength, findContent.getVoxelCenter(),
+                           findContent.getVoxelHalflengths()))
+    {
+      int childPosition = searchContentInternal(_tree.child(cell, i), childCenter,
+                                                0.5 * halflength, findContent);
+      if ((childPosition != Spacetree::positionUndefined())
+          && (position == Spacetree::positionUndefined()))
+      {
+        position = childPosition;
+      }
+      else if (childPosition == Spacetree::positionOnGeometry()){
+        position = Spacetree::positionOnGeometry();
+      }
+#     ifdef Asserts
+      else if ((childPosition != Spacetree::positionUndefined())
+               && (position != Spacetree::positionOnGeometry()))
+      {
+        assertion(childPosition == position, childPosition, position);
+      }
+#     endif // Asserts
+    }
+  }
+  return position;
+}
+
+}}} // namespace precice, spacetree, impl
@@ -0,0 +1,199 @@
+#include "LinearOctree.hpp"
+#include "query/FindVoxelContent.hpp"
+#include "math/math.hpp"
+#include <algorithm>
+#include <cmath>
+
+namespace precice {
+namespace spacetree {
+namespace impl {
+
+logging::Logger LinearOctree:: _log("precice::spacetree::impl::LinearOctree");
+
+LinearOctree:: LinearOctree
+(
+  const Eigen::VectorXd& center,
+  double                 halflength )
+:
+  _dimensions(center.size()),
+  _childCount(1 << center.size()),
+  _center(center),
+  _halflength(halflength),
+  _cells(),
+  _contents(),
+  _emptyContent()
+{
+  assertion((_dimensions == 2) || (_dimensions == 3), _dimensions);
+  clear();
+}
+
+bool LinearOctree:: needsRefinement
+(
+  int    cell,
+  double halflength,
+  double refinementLimit )
+{
+  if (math::smaller(halflength, refinementLimit)){
+    return false;
+  }
+  else if ((int) content(cell).size() < Spacetree::minElementsToRefineCell){
+    return false;
+  }
+  return true;
+}
+
+void LinearOctree:: refine
+(
+  int           cell,
+  const Coords& center,
+  double        halflength )
+{
+  TRACE(cell, center, halflength);
+  assertion(isLeaf(cell), cell);
+  int firstChild = size();
+  _cells[cell].firstChild = firstChild;
+  _cells.resize(firstChild + _childCount, Cell{-1, Spacetree::positionUndefined()});
+  _contents.resize(firstChild + _childCount);
+  std::unique_ptr<mesh::Group> parentContent(std::move(_contents[cell]));
+  if (not parentContent){
+    return; // Children of an empty leaf are empty
+  }
+  Eigen::VectorXd childCenter(_dimensions);
+  Eigen::VectorXd childHalflengths = Eigen::VectorXd::Constant(_dimensions, 0.5 * halflength);
+  Coords coords(_dimensions);
+  for (int i=0; i < _childCount; i++){
+    getChildCenter(i, center, halflength, coords);
+    childCenter = coords;
+    query::FindVoxelContent findVoxel (
+      childCenter, childHalflengths, query::FindVoxelContent::INCLUDE_BOUNDARY );
+    findVoxel(*parentContent);
+    if (not findVoxel.content().empty()){
+      DEBUG("  Refined child cell with center " << childCenter << " is on geometry");
+      _contents[firstChild + i].reset(new mesh::Group());
+      _contents[firstChild + i]->add(findVoxel.content());
+      _cells[firstChild + i].position = Spacetree::positionOnGeometry();
+    }
+  }
+}
+
+double LinearOctree:: distanceToBoundary
+(
+  const Coords&          center,
+  double                 halflength,
+  const Eigen::VectorXd& point ) const
+{
+  double maxDistanceToCenter = 0.0;
+  for (int d=0; d < _dimensions; d++){
+    maxDistanceToCenter = std::max(maxDistanceToCenter, std::abs(center[d] - point[d]));
+  }
+  assertion(math::greaterEquals(halflength, maxDistanceToCenter), halflength, maxDistanceToCenter);
+  return halflength - maxDistanceToCenter;
+}
+
+bool LinearOctree:: isCovered
+(
+  const Coords&          center,
+  double                 halflength,
+  const Eigen::VectorXd& voxelCenter,
+  const Eigen::VectorXd& voxelHalflengths ) const
+{
+  for (int d=0; d < _dimensions; d++){
+    double coverage = std::abs(center[d] - voxelCenter[d]) + halflength;
+    if (math::greater(coverage, voxelHalflengths[d])){
+      return false;
+    }
+  }
+  return true;
+}
+
+bool LinearOctree:: isOverlapped
+(
+  const Coords&          center,
+  double                 halflength,
+  const Eigen::VectorXd& voxelCenter,
+  const Eigen::VectorXd& voxelHalflengths ) const
+{
+  for (int d=0; d < _dimensions; d++){
+    double overlap = std::abs(center[d] - voxelCenter[d]) - halflength;
+    if (not math::greater(voxelHalflengths[d], overlap)){
+      return false;
+    }
+  }
+  return true;
+}
+
+void LinearOctree:: sortDepthFirst()
+{
+  TRACE();
+  std::vector<Cell> sortedCells;
+  std::vector<std::unique_ptr<mesh::Group>> sortedContents;
+  sortedCells.reserve(_cells.size());
+  sortedContents.reserve(_contents.size());
+  sortedCells.push_back(_cells[0]);
+  sortedContents.push_back(std::move(_contents[0]));
+  appendChildrenDepthFirst(0, 0, sortedCells, sortedContents);
+  assertion(sortedCells.size() == _cells.size(), sortedCells.size(), _cells.size());
+  _cells.swap(sortedCells);
+  _contents.swap(sortedContents);
+}
+
+void LinearOctree:: appendChildrenDepthFirst
+(
+  int                                        cell,
+  int                                        sortedCell,
+  std::vector<Cell>&                         sortedCells,
+  std::vector<std::unique_ptr<mesh::Group>>& sortedContents )
+{
+  if (isLeaf(cell)){
+    return;
+  }
+  int sortedFirstChild = sortedCells.size();
+  sortedCells[sortedCell].firstChild = sortedFirstChild;
+  for (int i=0; i < _childCount; i++){
+    sortedCells.push_back(_cells[child(cell, i)]);
+    sortedContents.push_back(std::move(_contents[child(cell, i)]));
+  }
+  for (int i=0; i < _childCount; i++){
+    appendChildrenDepthFirst(child(cell, i), sortedFirstChild + i, sortedCells,
+                             sortedContents);
+  }
+}
+
+void LinearOctree:: accept
+(
+  Spacetree::Visitor& visitor )
+{
+  accept(visitor, 0, _center, _halflength);
+}
+
+void LinearOctree:: accept
+(
+  Spacetree::Visitor& visitor,
+  int                 cell,
+  const Coords&       center,
+  double              halflength )
+{
+  Eigen::VectorXd cellCenter = center;
+  Eigen::VectorXd cellHalflengths = Eigen::VectorXd::Constant(_dimensions, halflength);
+  if (isLeaf(cell)){
+    visitor.leafCallback(cellCenter, cellHalflengths, getPosition(cell), content(cell));
+  }
+  else {
+    visitor.nodeCallback(cellCenter, cellHalflengths, getPosition(cell));
+    Coords childCenter(_dimensions);
+    for (int i=0; i < _childCount; i++){
+      getChildCenter(i, center, halflength, childCenter);
+      accept(visitor, child(cell, i), childCenter, 0.5 * halflength);
+    }
+  }
+}
+
+void LinearOctree:: clear()
+{
+  _cells.assign(1, Cell{-1, Spacetree::positionUndefined()});
+  _contents.clear();
+  _contents.emplace_back(new mesh::Group());
+  assertion(content(0).empty());
+}
+
+}}} // namespace precice, spacetree, impl
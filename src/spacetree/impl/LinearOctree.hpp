@@ -0,0 +1,256 @@
+#pragma once
+
+#include "spacetree/Spacetree.hpp"
+#include "mesh/Group.hpp"
+#include "logging/Logger.hpp"
+#include "utils/assertion.hpp"
+#include <Eigen/Core>
+#include <memory>
+#include <vector>
+
+namespace precice {
+namespace spacetree {
+namespace impl {
+
+/**
+ * @brief Cells of a quadtree (2D) or octree (3D) stored in flat arrays.
+ *
+ * Cells are referenced by their index, the root cell has index 0. The 2^dim
+ * children of a refined cell are stored consecutively in Morton order, i.e.,
+ * bit d of the child index is set, if the child lies above the center of its
+ * parent in dimension d. Hence, the child containing a point is selected by
+ * comparisons only, and indices stay valid when the tree is refined further.
+ *
+ * All cells are cubes. Centers and halflengths are not stored, but computed
+ * from the root cell while traversing, with Coords of fixed maximal size, such
+ * that traversals do not allocate memory.
+ */
+class LinearOctree
+{
+public:
+
+  /// Coordinates of at most 3 dimensions, which are stored on the stack.
+  typedef Eigen::Matrix<double, Eigen::Dynamic, 1, Eigen::ColMajor, 3, 1> Coords;
+
+  /**
+   * @brief Constructor, creates the root cell as empty leaf.
+   *
+   * @param[in] center Center of the root cell.
+   * @param[in] halflength Half sidelength of the root cell.
+   */
+  LinearOctree (
+    const Eigen::VectorXd& center,
+    double                 halflength );
+
+  int getDimensions() const
+  {
+    return _dimensions;
+  }
+
+  const Coords& getCenter() const
+  {
+    return _center;
+  }
+
+  double getHalflength() const
+  {
+    return _halflength;
+  }
+
+  /// Returns the number of cells, nodes and leaves.
+  int size() const
+  {
+    return (int) _cells.size();
+  }
+
+  /// Returns the number of children of a refined cell, 2^dim.
+  int getChildCount() const
+  {
+    return _childCount;
+  }
+
+  bool isLeaf ( int cell ) const
+  {
+    assertion((cell >= 0) && (cell < size()), cell, size());
+    return _cells[cell].firstChild < 0;
+  }
+
+  int child ( int cell, int childIndex ) const
+  {
+    assertion(not isLeaf(cell), cell);
+    assertion((childIndex >= 0) && (childIndex < _childCount), childIndex);
+    return _cells[cell].firstChild + childIndex;
+  }
+
+  int getPosition ( int cell ) const
+  {
+    assertion((cell >= 0) && (cell < size()), cell, size());
+    return _cells[cell].position;
+  }
+
+  void setPosition ( int cell, int position )
+  {
+    assertion((cell >= 0) && (cell < size()), cell, size());
+    _cells[cell].position = position;
+  }
+
+  /**
+   * @brief Returns the mesh elements of a leaf cell.
+   *
+   * Leaves without elements share one empty group, which must not be modified.
+   * Only the root cell owns a group before it is refined.
+   */
+  mesh::Group& content ( int cell )
+  {
+    assertion(isLeaf(cell), cell);
+    return _contents[cell] ? *_contents[cell] : _emptyContent;
+  }
+
+  bool needsRefinement (
+    int    cell,
+    double halflength,
+    double refinementLimit );
+
+  /**
+   * @brief Appends the children of a leaf cell and distributes its content to them.
+   *
+   * Children with content are on geometry, the position of all others is
+   * undefined.
+   */
+  void refine (
+    int           cell,
+    const Coords& center,
+    double        halflength );
+
+  /// Returns the index of the child of a cell containing a point.
+  template<typename VECTOR_T>
+  int getChildIndex (
+    const VECTOR_T& point,
+    const Coords&   center ) const
+  {
+    int childIndex = 0;
+    for (int d=0; d < _dimensions; d++){
+      childIndex |= (int) (point[d] > center[d]) << d;
+    }
+    return childIndex;
+  }
+
+  /// Computes the center of a child, which has half of the halflength of its parent.
+  void getChildCenter (
+    int           childIndex,
+    const Coords& center,
+    double        halflength,
+    Coords&       childCenter ) const
+  {
+    double childHalflength = 0.5 * halflength;
+    for (int d=0; d < _dimensions; d++){
+      childCenter[d] = center[d] + (double) (2 * ((childIndex >> d) & 1) - 1) * childHalflength;
+    }
+  }
+
+  /// Returns the distance of a point inside of a cell to the cell boundary.
+  double distanceToBoundary (
+    const Coords&          center,
+    double                 halflength,
+    const Eigen::VectorXd& point ) const;
+
+  /// Returns true, if a cell is completely covered by a voxel.
+  bool isCovered (
+    const Coords&          center,
+    double                 halflength,
+    const Eigen::VectorXd& voxelCenter,
+    const Eigen::VectorXd& voxelHalflengths ) const;
+
+  /// Returns true, if a cell and a voxel overlap.
+  bool isOverlapped (
+    const Coords&          center,
+    double                 halflength,
+    const Eigen::VectorXd& voxelCenter,
+    const Eigen::VectorXd& voxelHalflengths ) const;
+
+  /// Applies visitor to the content of all leaves of the subtree of cell.
+  template<typename VISITOR_T>
+  void visitLeaves (
+    int        cell,
+    VISITOR_T& visitor )
+  {
+    if (isLeaf(cell)){
+      visitor(content(cell));
+    }
+    else {
+      for (int i=0; i < _childCount; i++){
+        visitLeaves(child(cell, i), visitor);
+      }
+    }
+  }
+
+  /// Applies visitor to the content of all leaves below cell, except for those of one child.
+  template<typename VISITOR_T>
+  void visitRemainingLeaves (
+    int        cell,
+    int        excludedChildIndex,
+    VISITOR_T& visitor )
+  {
+    assertion(not isLeaf(cell), cell);
+    for (int i=0; i < _childCount; i++){
+      if (i != excludedChildIndex){
+        visitLeaves(child(cell, i), visitor);
+      }
+    }
+  }
+
+  /**
+   * @brief Reorders the cells depth-first.
+   *
+   * Afterwards, the children of all cells are stored in the order of a depth-first
+   * traversal, such that the cells of a subtree are close in memory.
+   */
+  void sortDepthFirst();
+
+  /// Visits all cells depth-first, starting with the root cell.
+  void accept ( Spacetree::Visitor& visitor );
+
+  /// Removes all cells except the root cell, which becomes an empty leaf.
+  void clear();
+
+private:
+
+  struct Cell
+  {
+    /// Index of the first child, -1 for leaves.
+    int firstChild;
+
+    int position;
+  };
+
+  static logging::Logger _log;
+
+  int _dimensions;
+
+  int _childCount;
+
+  Coords _center;
+
+  double _halflength;
+
+  std::vector<Cell> _cells;
+
+  /// Content of the leaves, indexed as _cells, null for nodes and empty leaves.
+  std::vector<std::unique_ptr<mesh::Group>> _contents;
+
+  mesh::Group _emptyContent;
+
+  void accept (
+    Spacetree::Visitor& visitor,
+    int                 cell,
+    const Coords&       center,
+    double              halflength );
+
+  void appendChildrenDepthFirst (
+    int                                        cell,
+    int                                        sortedCell,
+    std::vector<Cell>&                         sortedCells,
+    std::vector<std::unique_ptr<mesh::Group>>& sortedContents );
+};
+
+}}} // namespace precice, spacetree, impl
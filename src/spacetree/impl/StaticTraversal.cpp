@@ -0,0 +1,378 @@
+#include "StaticTraversal.hpp"
+#include "query/FindClosest.hpp"
+#include "query/FindVoxelContent.hpp"
+#include "math/math.hpp"
+
+namespace precice {
+namespace spacetree {
+namespace impl {
+
+logging::Logger StaticTraversal:: _log("precice::spacetree::impl::StaticTraversal");
+
+StaticTraversal:: StaticTraversal
+(
+  LinearOctree& tree )
+:
+  _tree(tree)
+{}
+
+void StaticTraversal:: refineAll
+(
+  double       refinementLimit,
+  Environment& env )
+{
+  TRACE(_tree.getCenter(), _tree.getHalflength(), refinementLimit);
+  // The environment gives information on the position of the cells surrounding
+  // a current cell of consideration. Since a mixture of in- and out-cells is
+  // not possible, the 0th component of the environment vector is used to
+  // indicate, whether there are only on-geometry, out-geometry (and on), or
+  // in-geometry (and on) cells surrounding.
+  Coords outsidePoint(_tree.getCenter());
+  for (int d=0; d < _tree.getDimensions(); d++){
+    outsidePoint[d] += 2.0 * _tree.getHalflength();
+  }
+  query::FindClosest findClosest(outsidePoint);
+  findClosest(_tree.content(0));
+  assertion(not math::equals(findClosest.getClosest().distance, 0.0));
+  int pos = findClosest.getClosest().distance > 0
+            ? Spacetree::positionOutsideOfGeometry()
+            : Spacetree::positionInsideOfGeometry();
+  env.setAllNeighborCellPositions(pos);
+  env.computePosition();
+  std::vector<UndefinedCell> undefinedCells;
+  refineAllInternal(0, _tree.getCenter(), _tree.getHalflength(), refinementLimit,
+                    env, undefinedCells);
+  refineUndefinedCells(undefinedCells, refinementLimit);
+}
+
+void StaticTraversal:: refineAllInternal
+(
+  int                         cell,
+  const Coords&               center,
+  double                      halflength,
+  double                      refinementLimit,
+  Environment&                env,
+  std::vector<UndefinedCell>& undefinedCells )
+{
+  TRACE(cell, center, halflength, refinementLimit, env.getNeighborCellPositions());
+  bool environmentIncomplete = false;
+  if (_tree.isLeaf(cell)){
+    DEBUG("  Leaf");
+    if (_tree.needsRefinement(cell, halflength, refinementLimit)){
+      DEBUG("    Needs refinement");
+      assertion(not _tree.content(cell).empty());
+      assertion(_tree.getPosition(cell) == Spacetree::positionOnGeometry());
+      _tree.refine(cell, center, halflength);
+
+      Environment oldEnvironment(env);
+      for (int i=0; i < _tree.getChildCount(); i++){
+        int childCell = _tree.child(cell, i);
+        if (_tree.getPosition(childCell) == Spacetree::positionUndefined()){
+          // Modify environment positions
+          const auto& cellIndices = env.getNeighborCellIndices(i);
+          const auto& sideIndices = env.getNeighborSideIndices(i);
+          assertion(cellIndices.size() == sideIndices.size(),
+                    cellIndices.size(), sideIndices.size());
+          for (int j=0; j < (int)cellIndices.size(); j++){
+            env.setNeighborCellPosition(sideIndices[j],
+                _tree.getPosition(_tree.child(cell, cellIndices[j])));
+          }
+          env.computePosition();
+          assertion(env.getPosition() != Spacetree::positionUndefined());
+          if (env.getPosition() != Spacetree::positionOnGeometry()){
+            DEBUG("    Derive cell position " << env.getPosition()
+                         << " from environment = " << env.getNeighborCellPositions());
+            // If some of the surrounding cells are either outside or inside,
+            // the new empty cell has to be also outside or inside respectively.
+            _tree.setPosition(childCell, env.getPosition());
+          }
+          else {
+            DEBUG("    Environment incomplete to derive position");
+            environmentIncomplete = true;
+          }
+          env = oldEnvironment;
+        }
+      }
+    }
+  }
+
+  if (environmentIncomplete){
+    DEBUG("  Incomplete environment, storing cell");
+    undefinedCells.push_back(UndefinedCell{cell, center, halflength, env});
+  }
+  else if (not _tree.isLeaf(cell)){
+    DEBUG("  Node");
+    assertion(_tree.getPosition(cell) != Spacetree::positionUndefined());
+    Coords childCenter(center.size());
+    Environment oldEnvironment(env);
+    for (int i=0; i < _tree.getChildCount(); i++){
+      _tree.getChildCenter(i, center, halflength, childCenter);
+      // Modify environment positions
+      const auto& cellIndices = env.getNeighborCellIndices(i);
+      const auto& sideIndices = env.getNeighborSideIndices(i);
+      assertion(cellIndices.size() == sideIndices.size(),
+                cellIndices.size(), sideIndices.size());
+      for (int j=0; j < (int)cellIndices.size(); j++){
+        env.setNeighborCellPosition(sideIndices[j],
+            _tree.getPosition(_tree.child(cell, cellIndices[j])));
+      }
+      env.computePosition();
+      refineAllInternal(_tree.child(cell, i), childCenter, 0.5 * halflength,
+                        refinementLimit, env, undefinedCells);
+      env = oldEnvironment;
+    }
+  }
+}
+
+void StaticTraversal:: refineUndefinedCells
+(
+  std::vector<UndefinedCell>& undefinedCells,
+  double                      refinementLimit )
+{
+  TRACE(undefinedCells.size(), refinementLimit);
+  for (UndefinedCell& undefinedCell : undefinedCells){
+    DEBUG("  Compute child positions of cell with center = " << undefinedCell.center
+                 << ", h = " << undefinedCell.halflength);
+    bool knowPosition = false;
+    int pos = Spacetree::positionUndefined();
+    for (int i=0; i < _tree.getChildCount(); i++){
+      DEBUG("    Child number " << i);
+      int child = _tree.child(undefinedCell.cell, i);
+      if (_tree.getPosition(child) == Spacetree::positionUndefined()){
+        if (knowPosition){
+          DEBUG("    Know position already, position = " << pos);
+          _tree.setPosition(child, pos);
+        }
+        else {
+          DEBUG("    Compute position by findDistance");
+          query::FindClosest findDistance(undefinedCell.center);
+          searchDistance(findDistance);
+          assertion(not math::equals(findDistance.getEuclidianDistance(), 0.0));
+          pos = findDistance.getClosest().distance > 0
+                ? Spacetree::positionOutsideOfGeometry()
+                : Spacetree::positionInsideOfGeometry();
+          DEBUG("    Set computed position = " << pos);
+          _tree.setPosition(child, pos);
+          knowPosition = true;
+        }
+      }
+    }
+    std::vector<UndefinedCell> subcells;
+    DEBUG("  Go on computing subcell positions");
+    refineAllInternal(undefinedCell.cell, undefinedCell.center, undefinedCell.halflength,
+                      refinementLimit, undefinedCell.environment, subcells);
+    refineUndefinedCells(subcells, refinementLimit);
+  }
+}
+
+int StaticTraversal:: searchPosition
+(
+  const Eigen::VectorXd& searchPoint )
+{
+  TRACE(searchPoint);
+  query::FindClosest findClosest(searchPoint);
+  SearchPositionResult result = searchPositionInternal(
+      0, _tree.getCenter(), _tree.getHalflength(), searchPoint, findClosest);
+  assertion(result.position != Spacetree::positionUndefined());
+  return result.position;
+}
+
+void StaticTraversal:: searchDistance
+(
+  query::FindClosest& findClosest )
+{
+  TRACE(findClosest.getSearchPoint());
+  searchDistanceInternal(0, _tree.getCenter(), _tree.getHalflength(), findClosest);
+}
+
+int StaticTraversal:: searchContent
+(
+  query::FindVoxelContent& findContent )
+{
+  TRACE(findContent.getVoxelCenter(), findContent.getVoxelHalflengths());
+  int position = searchContentInternal(0, _tree.getCenter(), _tree.getHalflength(),
+                                       findContent);
+  if (position == Spacetree::positionUndefined()){
+    // Some/all searched cells had content, but not in the search voxel
+    DEBUG("Computing position of search voxel");
+    query::FindClosest findDistance(findContent.getVoxelCenter());
+    searchDistance(findDistance);
+    double distance = findDistance.getClosest().distance;
+    assertion(not math::equals(distance, 0.0));
+    position = distance > 0 ? Spacetree::positionOutsideOfGeometry()
+                            : Spacetree::positionInsideOfGeometry();
+  }
+  DEBUG("return content().size() = " << findContent.content().size());
+  return position;
+}
+
+StaticTraversal::SearchPositionResult StaticTraversal:: searchPositionInternal
+(
+  int                    cell,
+  const Coords&          center,
+  double                 halflength,
+  const Eigen::VectorXd& searchPoint,
+  query::FindClosest&    findClosest )
+{
+  TRACE(cell, center, halflength);
+  SearchPositionResult result {Spacetree::positionUndefined(), false};
+  double distance = 0.0;
+  if (_tree.isLeaf(cell)){
+    DEBUG("  Leaf");
+    if (_tree.getPosition(cell) == Spacetree::positionOnGeometry()){
+      DEBUG("    Has content");
+      findClosest(_tree.content(cell));
+      if (findClosest.hasFound()){
+        DEBUG("    Found elements");
+        distance = findClosest.getClosest().distance;
+        result.position = Spacetree::positionOnGeometry(); // May by altered later
+      }
+    }
+    else {
+      DEBUG("    Is empty");
+      assertion(_tree.content(cell).empty());
+      assertion(_tree.getPosition(cell) != Spacetree::positionUndefined());
+      result.position = _tree.getPosition(cell);
+    }
+  }
+  else {
+    DEBUG("  Node");
+    assertion(_tree.getPosition(cell) == Spacetree::positionOnGeometry());
+    int childIndex = _tree.getChildIndex(searchPoint, center);
+    Coords childCenter(center.size());
+    _tree.getChildCenter(childIndex, center, halflength, childCenter);
+    result = searchPositionInternal(_tree.child(cell, childIndex), childCenter,
+                                    0.5 * halflength, searchPoint, findClosest);
+    if ((result.position == Spacetree::positionUndefined()) || result.ambiguous){
+      DEBUG("    Did not find elements or ambiguous, visit others");
+      _tree.visitRemainingLeaves(cell, childIndex, findClosest);
+      if (findClosest.hasFound()){
+        DEBUG("    Found elements in others");
+        distance = findClosest.getClosest().distance;
+        result.position = Spacetree::positionOnGeometry();
+        result.ambiguous = false;
+      }
+    }
+  }
+
+  // Set inside/outside and check for ambiguities
+  if (not math::equals(distance, 0.0)){
+    DEBUG("  Checking for ambiguities of found objects");
+    if (math::greater(distance, 0.0)){
+      result.position = Spacetree::positionOutsideOfGeometry();
+    }
+    else if (math::greater(0.0, distance)){
+      result.position = Spacetree::positionInsideOfGeometry();
+    }
+    DEBUG("  found pos = " << result.position);
+    double distanceToBound = _tree.distanceToBoundary(center, halflength, searchPoint);
+    if (math::greater(std::abs(distance), distanceToBound)){
+      DEBUG("  is ambigious");
+      result.ambiguous = true;
+    }
+  }
+  DEBUG("  return position = " << result.position << ", ambiguous = " << result.ambiguous);
+  return result;
+}
+
+bool StaticTraversal:: searchDistanceInternal
+(
+  int                 cell,
+  const Coords&       center,
+  double              halflength,
+  query::FindClosest& findClosest )
+{
+  TRACE(cell, center, halflength);
+  if (_tree.isLeaf(cell)){
+    DEBUG("  Leaf");
+    findClosest(_tree.content(cell));
+  }
+  else {
+    DEBUG("  Node");
+    int childIndex = _tree.getChildIndex(findClosest.getSearchPoint(), center);
+    Coords childCenter(center.size());
+    _tree.getChildCenter(childIndex, center, halflength, childCenter);
+    bool ambiguous = searchDistanceInternal(_tree.child(cell, childIndex), childCenter,
+                                            0.5 * halflength, findClosest);
+    if (ambiguous){
+      _tree.visitRemainingLeaves(cell, childIndex, findClosest);
+    }
+  }
+
+  if (findClosest.hasFound()){
+    double distance = _tree.distanceToBoundary(center, halflength,
+                                               findClosest.getSearchPoint());
+    bool isAmbiguous = math::greater(findClosest.getEuclidianDistance(), distance);
+    DEBUG("  hasfound, return " << isAmbiguous);
+    return isAmbiguous;
+  }
+  DEBUG("  return true");
+  return true;
+}
+
+int StaticTraversal:: searchContentInternal
+(
+  int                      cell,
+  const Coords&            center,
+  double                   halflength,
+  query::FindVoxelContent& findContent )
+{
+  TRACE(cell, center, halflength);
+  int position = Spacetree::positionUndefined();
+  if (_tree.isLeaf(cell)){
+    DEBUG("Leaf...");
+    assertion(_tree.getPosition(cell) != Spacetree::positionUndefined());
+    if ((_tree.getPosition(cell) == Spacetree::positionOutsideOfGeometry())
+        || (_tree.getPosition(cell) == Spacetree::positionInsideOfGeometry()))
+    {
+      DEBUG("empty, position = " << _tree.getPosition(cell));
+      position = _tree.getPosition(cell);
+    }
+    else {
+      DEBUG("content size = " << _tree.content(cell).size());
+      assertion(_tree.getPosition(cell) == Spacetree::positionOnGeometry());
+      assertion(not _tree.content(cell).empty());
+      bool set = _tree.isCovered(center, halflength, findContent.getVoxelCenter(),
+                                 findContent.getVoxelHalflengths());
+      set &= findContent.getBoundaryInclusion() == query::FindVoxelContent::INCLUDE_BOUNDARY;
+      if (set){
+        DEBUG("Is covered by voxel, add cell content to find content");
+        findContent.content().add(_tree.content(cell));
+        position = Spacetree::positionOnGeometry();
+      }
+      else {
+        DEBUG("Isn't covered by voxel, apply find content");
+        findContent(_tree.content(cell));
+        if (not findContent.content().empty()){
+          DEBUG("Some content is contained in voxel");
+          position = Spacetree::positionOnGeometry();
+        }
+      }
+    }
+    DEBUG("return size = " << findContent.content().size() << ", pos = " << position);
+    return position;
+  }
+
+  DEBUG("Node...");
+  Coords childCenter(center.size());
+  for (int i=0; i < _tree.getChildCount(); i++){
+    _tree.getChildCenter(i, center, halflength, childCenter);
+    if (_tree.isOverlapped(childCenter, 0.5 * halflength, findContent.getVoxelCenter(),
+                           findContent.getVoxelHalflengths()))
+    {
+      int childPosition = searchContentInternal(_tree.child(cell, i), childCenter,
+                                                0.5 * halflength, findContent);
+      if ((childPosition != Spacetree::positionUndefined())
+          && (position == Spacetree::positionUndefined()))
+      {
+        position = childPosition;
+      }
+      else if (childPosition == Spacetree::positionOnGeometry()){
+        position = Spacetree::positionOnGeometry();
+      }
+    }
+  }
+  return position;
+}
+
+}}} // namespace precice, spacetree, impl
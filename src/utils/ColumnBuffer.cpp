@@ -0,0 +1,100 @@
+#include "ColumnBuffer.hpp"
+#include "Globals.hpp"
+#include <algorithm>
+
+namespace precice {
+namespace utils {
+
+ColumnBuffer:: ColumnBuffer()
+:
+  _storage(),
+  _first(0),
+  _cols(0)
+{}
+
+ColumnBuffer& ColumnBuffer:: operator=
+(
+  const Eigen::MatrixXd& matrix )
+{
+  _storage = matrix;
+  _first = 0;
+  _cols = matrix.cols();
+  return *this;
+}
+
+void ColumnBuffer:: appendFront
+(
+  const Eigen::VectorXd& v )
+{
+  if (_storage.size() == 0){
+    _storage.resize(v.size(), 0);
+  }
+  assertion(v.size() == rows(), v.size(), rows());
+  reserveFront();
+  _first--;
+  _cols++;
+  _storage.col(_first) = v;
+}
+
+void ColumnBuffer:: shiftSetFirst
+(
+  const Eigen::VectorXd& v )
+{
+  assertion(_cols > 0);
+  assertion(v.size() == rows(), v.size(), rows());
+  _cols--;
+  appendFront(v);
+}
+
+void ColumnBuffer:: removeColumn
+(
+  int col )
+{
+  assertion(col < _cols && col >= 0, col, _cols);
+  // move the smaller part of the columns, the ones in front or the ones behind col
+  if (col < _cols - col - 1){
+    for (int j = _first + col; j > _first; j--){
+      _storage.col(j) = _storage.col(j-1);
+    }
+    _first++;
+  }
+  else {
+    for (int j = _first + col; j < _first + _cols - 1; j++){
+      _storage.col(j) = _storage.col(j+1);
+    }
+  }
+  _cols--;
+}
+
+void ColumnBuffer:: clear()
+{
+  _storage.resize(0, 0);
+  _first = 0;
+  _cols = 0;
+}
+
+void ColumnBuffer:: reserveFront()
+{
+  if (_first > 0){
+    return;
+  }
+  // leave at least _cols free columns in front, such that the next move is _cols additions away
+  int capacity = _storage.cols();
+  if (capacity - _cols < std::max(_cols, 1)){
+    // grow the storage to twice the columns and place the columns at its right end
+    int newCapacity = std::max(2 * _cols, 4);
+    Eigen::MatrixXd storage(_storage.rows(), newCapacity);
+    storage.rightCols(_cols) = _storage.leftCols(_cols);
+    _storage.swap(storage);
+  }
+  else {
+    // move the columns to the right end, starting with the last one, as the ranges may overlap
+    int shift = capacity - _cols;
+    for (int j = _cols - 1; j >= 0; j--){
+      _storage.col(j + shift) = _storage.col(j);
+    }
+  }
+  _first = _storage.cols() - _cols;
+}
+
+}} // namespace precice, utils
@@ -0,0 +1,99 @@
+#pragma once
+
+#include <Eigen/Dense>
+
+namespace precice {
+namespace utils {
+
+/**
+ * @brief Matrix to which columns are added at the front in O(rows) time.
+ *
+ * Column 0 is the most recently added column, as for utils::appendFront() and
+ * utils::shiftSetFirst() on an Eigen::MatrixXd, which shift all columns to the
+ * right with each added column.
+ *
+ * The columns are stored in a larger matrix, of which the logical matrix is a
+ * contiguous block of whole columns. The block moves to the left when columns
+ * are added at the front and shrinks from the right when the last column is
+ * dropped. Only when the block reaches the left end of the storage, the columns
+ * are moved back to the right end, such that at least cols() columns are free
+ * in front of them. If the storage is too small for that, it grows to twice the
+ * number of columns. Hence, the columns are copied once every cols() additions
+ * at most, also when a full matrix is shifted, and the block can be used as any
+ * Eigen matrix, e.g., in products, without a copy.
+ */
+class ColumnBuffer
+{
+public:
+
+  typedef Eigen::MatrixXd::ColsBlockXpr Block;
+  typedef Eigen::MatrixXd::ConstColsBlockXpr ConstBlock;
+
+  /// Constructor, creates an empty matrix.
+  ColumnBuffer();
+
+  /// Sets the logical matrix to matrix, e.g. to restore a backup.
+  ColumnBuffer& operator= ( const Eigen::MatrixXd& matrix );
+
+  /// Returns the number of rows, 0 for an empty matrix.
+  int rows() const
+  {
+    return _storage.rows();
+  }
+
+  /// Returns the number of columns.
+  int cols() const
+  {
+    return _cols;
+  }
+
+  /// Returns the logical matrix, column 0 is the most recently added column.
+  Block matrix()
+  {
+    return _storage.middleCols(_first, _cols);
+  }
+
+  /// Returns the logical matrix, column 0 is the most recently added column.
+  ConstBlock matrix() const
+  {
+    return _storage.middleCols(_first, _cols);
+  }
+
+  /// Returns the column at the given logical position.
+  Eigen::MatrixXd::ColXpr col ( int col )
+  {
+    return _storage.col(_first + col);
+  }
+
+  /// Returns the column at the given logical position.
+  Eigen::MatrixXd::ConstColXpr col ( int col ) const
+  {
+    return _storage.col(_first + col);
+  }
+
+  /// Adds v as first column, the number of columns grows by one.
+  void appendFront ( const Eigen::VectorXd& v );
+
+  /// Removes the last column and adds v as first column.
+  void shiftSetFirst ( const Eigen::VectorXd& v );
+
+  /// Removes the column at the given logical position.
+  void removeColumn ( int col );
+
+  /// Removes all columns and rows and frees the storage.
+  void clear();
+
+private:
+
+  /// Holds the logical matrix in the columns [_first, _first + _cols).
+  Eigen::MatrixXd _storage;
+
+  int _first;
+
+  int _cols;
+
+  /// Makes room for one column in front of the logical matrix.
+  void reserveFront();
+};
+
+}} // namespace precice, utils
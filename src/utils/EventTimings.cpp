@@ -12,6 +12,10 @@
 #include <vector>
 #include <map>
 #include <chrono>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
 
 namespace precice {
 extern bool testMode;
@@ -20,17 +24,91 @@ extern bool testMode;
 namespace precice {
 namespace utils {
 
-Event::Event(std::string eventName, Clock::duration eventDuration)
-  : name(eventName),
+namespace {
+
+/// Single event recorded for the trace.
+struct TraceRecord
+{
+  int id;
+  Event::Clock::time_point start;
+  Event::Clock::time_point stop;
+};
+
+/// Events recorded by one thread, only accessed by this thread until printing.
+struct ThreadBuffer
+{
+  int index;
+
+  /// Aggregated data, by event ID
+  std::vector<EventData> data;
+
+  std::vector<TraceRecord> records;
+};
+
+/// Event names and buffers of all threads, guarded by mutex.
+struct Registry
+{
+  std::mutex mutex;
+
+  /// Names by event ID, a deque keeps references to the names valid.
+  std::deque<std::string> names;
+
+  std::unordered_map<std::string, int> ids;
+
+  std::vector<std::unique_ptr<ThreadBuffer>> buffers;
+};
+
+Registry& registry()
+{
+  static Registry instance;
+  return instance;
+}
+
+/// Returns the buffer of the calling thread, which is created on first use.
+ThreadBuffer& threadBuffer()
+{
+  thread_local ThreadBuffer* buffer = nullptr;
+  if (buffer == nullptr) {
+    Registry& reg = registry();
+    std::lock_guard<std::mutex> lock(reg.mutex);
+    reg.buffers.emplace_back(new ThreadBuffer());
+    buffer = reg.buffers.back().get();
+    buffer->index = reg.buffers.size() - 1;
+  }
+  return *buffer;
+}
+
+/// Writes name as JSON string, with quotes and backslashes escaped.
+void writeJSONString(std::ostream& out, const std::string& name)
+{
+  out << '"';
+  for (char c : name) {
+    if (c == '"' or c == '\\')
+      out << '\\';
+    out << c;
+  }
+  out << '"';
+}
+
+}
+
+Event::Event(const std::string& eventName, Clock::duration eventDuration)
+  : id(EventRegistry::getID(eventName)),
     duration(eventDuration),
     isStarted(false),
     _barrier(false)
 {
-  EventRegistry::put(this);
+  stoptime = Clock::now();
+  starttime = stoptime - duration;
+  EventRegistry::put(id, starttime, stoptime);
 }
 
-Event::Event(std::string eventName, bool barrier, bool autostart)
-  : name(eventName),
+Event::Event(const std::string& eventName, bool barrier, bool autostart)
+  : Event(EventRegistry::getID(eventName), barrier, autostart)
+{}
+
+Event::Event(int eventID, bool barrier, bool autostart)
+  : id(eventID),
     _barrier(barrier)
 {
   if (not (precice::utils::MasterSlave::_slaveMode || precice::utils::MasterSlave::_masterMode) ){
@@ -49,7 +127,7 @@ Event::~Event()
 
 void Event::start(bool barrier)
 {
-  if (barrier)
+  if (barrier && EventRegistry::isSyncMode())
     Parallel::synchronizeProcesses();
 
   isStarted = true;
@@ -59,13 +137,13 @@ void Event::start(bool barrier)
 void Event::stop(bool barrier)
 {
   if (isStarted) {
-    if (barrier)
+    if (barrier && EventRegistry::isSyncMode())
       Parallel::synchronizeProcesses();
 
     stoptime = Clock::now();
     isStarted = false;
     duration = Clock::duration(stoptime - starttime);
-    EventRegistry::put(this);
+    EventRegistry::put(id, starttime, stoptime);
   }
 }
 
@@ -74,18 +152,28 @@ Event::Clock::duration Event::getDuration()
   return duration;
 }
 
+const std::string& Event::getName() const
+{
+  return EventRegistry::getName(id);
+}
+
 // -----------------------------------------------------------------------
 
 
-void EventData::put(Event* event)
+void EventData::put(Event::Clock::duration duration)
 {
-  if (not precice::utils::MasterSlave::_slaveMode) {
-    count++;
-    Event::Clock::duration duration = event->getDuration();
-    total += duration;
-    min = std::min(duration, min);
-    max = std::max(duration, max);
-  }
+  count++;
+  total += duration;
+  min = std::min(duration, min);
+  max = std::max(duration, max);
+}
+
+void EventData::merge(const EventData& other)
+{
+  count += other.count;
+  total += other.total;
+  min = std::min(other.min, min);
+  max = std::max(other.max, max);
 }
 
 
@@ -123,10 +211,11 @@ int EventData::getTimePercentage(Event::Clock::duration globalDuration)
 // -----------------------------------------------------------------------
 
 // Static members need to be initalized like that
-std::map<std::string, EventData> EventRegistry::events;
 Event::Clock::time_point EventRegistry::globalStart;
 Event::Clock::time_point EventRegistry::globalStop;
 bool EventRegistry::initialized = false;
+bool EventRegistry::syncMode = false;
+bool EventRegistry::tracing = false;
 std::map<std::string, double> EventRegistry::properties;
 
 void EventRegistry::initialize()
@@ -143,7 +232,13 @@ void EventRegistry::finalize()
 
 void EventRegistry::clear()
 {
-  events.clear();
+  // The IDs are kept, since they may be stored by callers
+  Registry& reg = registry();
+  std::lock_guard<std::mutex> lock(reg.mutex);
+  for (auto& buffer : reg.buffers) {
+    buffer->data.clear();
+    buffer->records.clear();
+  }
   properties.clear();
 }
 
@@ -156,11 +251,66 @@ void EventRegistry::signal_handler(int signal)
   }
 }
 
-void EventRegistry::put(Event* event)
+int EventRegistry::getID(const std::string& name)
+{
+  thread_local std::unordered_map<std::string, int> knownIDs;
+  auto known = knownIDs.find(name);
+  if (known != knownIDs.end())
+    return known->second;
+
+  Registry& reg = registry();
+  std::lock_guard<std::mutex> lock(reg.mutex);
+  auto iter = reg.ids.find(name);
+  int id;
+  if (iter != reg.ids.end()) {
+    id = iter->second;
+  }
+  else {
+    id = reg.names.size();
+    reg.names.push_back(name);
+    reg.ids[name] = id;
+  }
+  knownIDs[name] = id;
+  return id;
+}
+
+const std::string& EventRegistry::getName(int id)
+{
+  Registry& reg = registry();
+  std::lock_guard<std::mutex> lock(reg.mutex);
+  return reg.names[id];
+}
+
+void EventRegistry::put(int id, Event::Clock::time_point start, Event::Clock::time_point stop)
+{
+  ThreadBuffer& buffer = threadBuffer();
+  if (not precice::utils::MasterSlave::_slaveMode) {
+    if (id >= (int) buffer.data.size())
+      buffer.data.resize(id + 1);
+    buffer.data[id].put(stop - start);
+  }
+  if (tracing)
+    buffer.records.push_back({id, start, stop});
+}
+
+void EventRegistry::setSyncMode(bool syncMode)
+{
+  EventRegistry::syncMode = syncMode;
+}
+
+bool EventRegistry::isSyncMode()
 {
-  EventData data = events[event->name];
-  data.put(event);
-  events[event->name] = data;
+  return syncMode;
+}
+
+void EventRegistry::setTracing(bool tracing)
+{
+  EventRegistry::tracing = tracing;
+}
+
+bool EventRegistry::isTracing()
+{
+  return tracing;
 }
 
 void EventRegistry::addProp(std::string property, double value)
@@ -180,6 +330,7 @@ void EventRegistry::print(std::ostream &out, bool terse)
     using std::setw; using std::setprecision;
     using std::left; using std::right;
     Event::Clock::duration globalDuration = globalStop - globalStart;
+    std::map<std::string, EventData> events = collectEvents();
 
     std::time_t currentTime = std::time(nullptr);
 
@@ -254,6 +405,43 @@ void EventRegistry::print(std::string filename, bool terse)
   outfile.close();
 }
 
+void EventRegistry::writeTrace(const std::string& filename)
+{
+  using std::chrono::duration_cast;
+  using Microseconds = std::chrono::duration<double, std::micro>;
+  int rank = std::max(precice::utils::MasterSlave::_rank, 0);
+  std::ofstream out(filename, std::ios::trunc);
+  out << "{\"displayTimeUnit\": \"ms\", \"traceEvents\": [";
+  Registry& reg = registry();
+  std::lock_guard<std::mutex> lock(reg.mutex);
+  bool first = true;
+  for (auto& buffer : reg.buffers) {
+    for (const TraceRecord& record : buffer->records) {
+      out << (first ? "\n" : ",\n") << "{\"name\": ";
+      writeJSONString(out, reg.names[record.id]);
+      out << ", \"ph\": \"X\", \"pid\": " << rank << ", \"tid\": " << buffer->index
+          << ", \"ts\": " << duration_cast<Microseconds>(record.start - globalStart).count()
+          << ", \"dur\": " << duration_cast<Microseconds>(record.stop - record.start).count() << "}";
+      first = false;
+    }
+  }
+  out << "\n]}" << std::endl;
+}
+
+std::map<std::string, EventData> EventRegistry::collectEvents()
+{
+  std::map<std::string, EventData> events;
+  Registry& reg = registry();
+  std::lock_guard<std::mutex> lock(reg.mutex);
+  for (auto& buffer : reg.buffers) {
+    for (size_t id = 0; id < buffer->data.size(); id++) {
+      if (buffer->data[id].getCount() > 0)
+        events[reg.names[id]].merge(buffer->data[id]);
+    }
+  }
+  return events;
+}
+
 void EventRegistry::printGlobalDuration()
 {
   if (precice::utils::MasterSlave::_slaveMode || precice::testMode)
@@ -10,22 +10,31 @@ namespace utils {
 /// Represents an event that can be started and stopped.
 /** Additionally to the duration there is a special property that can be set for a event.
 A property is a a key-value pair with a numerical value that can be used to trace certain events,
-like MPI calls in an event. It is intended to be set by the user. */
+like MPI calls in an event. It is intended to be set by the user.
+
+Events may be nested and used from several threads. */
 class Event
 {
 public:
   /// Default clock type. All other chrono types are derived from it.
   using Clock = std::chrono::steady_clock;
 
-  /// Name used to identify the timer. Events of the same name are accumulated to
-  std::string name;
-
   /// Allows to put a non-measured (i.e. with a given duration) Event to the measurements.
-  Event(std::string eventName, Clock::duration eventDuration);
+  Event(const std::string& eventName, Clock::duration eventDuration);
 
   /// Creates a new event and starts it, unless autostart = false, synchronize processes, when barrier == true
-  /** Use barrier == true with caution, as it can lead to deadlocks. */
-  Event(std::string eventName, bool barrier = false, bool autostart = true);
+  /** Use barrier == true with caution, as it can lead to deadlocks.
+   *  Barriers are only done in sync mode, see EventRegistry::setSyncMode(). */
+  Event(const std::string& eventName, bool barrier = false, bool autostart = true);
+
+  /// Creates a new event of an ID returned by EventRegistry::getID().
+  /** Keep the ID of a fixed name in a function-local static, that saves looking up the name
+   *  for every event:
+   *  @code
+   *  static const int eventID = EventRegistry::getID("name");
+   *  Event e(eventID);
+   *  @endcode */
+  explicit Event(int eventID, bool barrier = false, bool autostart = true);
 
   /// Stops the event if it's running and report its times to the EventRegistry
   ~Event();
@@ -39,7 +48,12 @@ public:
   /// Gets the duration of the event.
   Clock::duration getDuration();
 
+  /// Returns the name used to identify the timer.
+  const std::string& getName() const;
+
 private:
+  /// ID of the name, events of the same name are accumulated.
+  int id;
   Clock::time_point starttime;
   Clock::time_point stoptime;
   Clock::duration duration = Clock::duration::zero();
@@ -52,8 +66,11 @@ private:
 class EventData
 {
 public:
-  /// Adds an events data.
-  void put(Event* event);
+  /// Adds the duration of an event.
+  void put(Event::Clock::duration duration);
+
+  /// Adds the durations aggregated by other.
+  void merge(const EventData& other);
 
   /// Get the average duration of all events so far.
   int getAvg();
@@ -85,7 +102,12 @@ private:
 /// High level object that stores data of all events.
 /** Call EventRegistry::intialize at the beginning of your application and
 EventRegistry::finalize at the end. Event timings will be usuable without calling this
-function at all, but global timings as well as percentages do not work this way.  */
+function at all, but global timings as well as percentages do not work this way.
+
+Event names are mapped to IDs once, when an event is created. Every thread records
+its events into its own buffer, hence stopping an event neither looks up a name nor
+takes a lock. The buffers are combined when printing, which must not run concurrently
+to events of other threads. */
 class EventRegistry
 {
 public:
@@ -101,15 +123,32 @@ public:
   /// Finalizes the timings and calls print. Can be used as a crash handler to still get some timing results.
   static void signal_handler(int signal);
 
-  /// Records the event.
-  static void put(Event* event);
+  /// Returns the ID of an event name, a new ID is assigned to an unknown name.
+  /** The IDs already looked up by the calling thread are cached, only unknown names take a lock. */
+  static int getID(const std::string& name);
+
+  /// Returns the name of an event ID.
+  static const std::string& getName(int id);
+
+  /// Records an event of the calling thread, which started at start and ended at stop.
+  static void put(int id, Event::Clock::time_point start, Event::Clock::time_point stop);
+
+  /// If true, events requested with barrier synchronize all processes. False by default.
+  static void setSyncMode(bool syncMode);
+
+  static bool isSyncMode();
+
+  /// If true, every single event is recorded for writeTrace(). False by default.
+  static void setTracing(bool tracing);
+
+  static bool isTracing();
 
   /// Adds a value to the global property store.
-  /** An existing value is added. */ 
+  /** An existing value is added. */
   static void addProp(std::string property, double value);
 
   /// Sets a value in the global property store
-  /** An existing value is overwritten. */ 
+  /** An existing value is overwritten. */
   static void setProp(std::string property, double value);
 
   /// Prints the result table to an arbitrary stream.
@@ -124,14 +163,23 @@ public:
 
   static void printGlobalDuration();
 
+  /// Writes the events recorded with tracing enabled in the Chrome trace event format (JSON).
+  /** Every rank writes its own file. Timestamps are relative to initialize(), the
+   *  process ID is the rank and the thread ID the index of the recording thread. */
+  static void writeTrace(const std::string& filename);
+
 private:
   static bool initialized;
+  static bool syncMode;
+  static bool tracing;
   static Event::Clock::time_point globalStart;
   static Event::Clock::time_point globalStop;
-  static std::map<std::string, EventData> events;
 
   /// Map of additional properties that can be set by the user.
   static std::map<std::string, double> properties;
+
+  /// Returns the aggregated data of all threads, by event name.
+  static std::map<std::string, EventData> collectEvents();
 };
 
 }} // namespace precice::utils
@@ -243,6 +243,19 @@ MasterSlave::allreduceSum(int& sendData, int& rcvData, int size) {
   }
 }
 
+void
+MasterSlave::allreduceSum(std::vector<double>& values) {
+  TRACE(values.size());
+
+  if ((not _masterMode && not _slaveMode) || values.empty()) {
+    return;
+  }
+
+  // the send buffer is modified by the reduction, do not use afterwards
+  std::vector<double> localValues(values);
+  allreduceSum(localValues.data(), values.data(), (int) values.size());
+}
+
 void
 MasterSlave::broadcast(bool& value) {
   TRACE();
@@ -5,6 +5,7 @@
 #include "com/Communication.hpp"
 
 #include "logging/Logger.hpp"
+#include <vector>
 
 namespace precice {
 namespace utils {
@@ -66,6 +67,14 @@ public:
 
   static void allreduceSum(int& sendData, int& rcvData, int size);
 
+  /**
+   * @brief Sums up the local values of all ranks in place, with a single allreduce.
+   *
+   * Used to batch the local partial sums of several reductions, e.g. the squared
+   * norms of several vectors. Without master-slave mode, values are left unchanged.
+   */
+  static void allreduceSum(std::vector<double>& values);
+
   static void broadcast(bool& value);
 
   static void broadcast(double& value);
@@ -108,6 +108,14 @@ public:
      return *_content.back();
    }
 
+   /**
+    * @brief Reserves storage for the given number of pointers.
+    */
+   void reserve ( size_t capacity )
+   {
+      _content.reserve ( capacity );
+   }
+
    /**
     * @brief Adds element to the end of the vector.
     */
@@ -0,0 +1,206 @@
+#include "Threads.hpp"
+#include "utils/Globals.hpp"
+#include <algorithm>
+#include <condition_variable>
+#include <exception>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace precice {
+namespace utils {
+
+namespace {
+
+/**
+ * @brief Worker threads waiting for tasks of Threads::parallelFor().
+ *
+ * Worker w runs task(w) of every task posted with at least w + 1 chunks, the
+ * posting thread runs task(0). The workers are started on demand and kept,
+ * until stop() is called.
+ */
+class Pool
+{
+public:
+
+  ~Pool()
+  {
+    stop();
+  }
+
+  /// Runs task(0) to task(chunks - 1) on the calling thread and chunks - 1 workers.
+  void run (
+    int                             chunks,
+    const std::function<void(int)>& task )
+  {
+    std::lock_guard<std::mutex> runLock(_runMutex);
+    std::unique_lock<std::mutex> lock(_mutex);
+    while ((int) _workers.size() < chunks - 1){
+      int worker = _workers.size() + 1;
+      long generation = _generation;
+      _workers.emplace_back([this, worker, generation](){ work(worker, generation); });
+    }
+    _task = &task;
+    _chunks = chunks;
+    _pending = chunks - 1;
+    _generation++;
+    lock.unlock();
+    _start.notify_all();
+
+    task(0);
+
+    lock.lock();
+    _done.wait(lock, [this](){ return _pending == 0; });
+    _task = nullptr;
+  }
+
+  /// Joins all workers.
+  void stop()
+  {
+    {
+      std::lock_guard<std::mutex> lock(_mutex);
+      _stopping = true;
+    }
+    _start.notify_all();
+    for (std::thread& worker : _workers){
+      worker.join();
+    }
+    _workers.clear();
+    _stopping = false;
+  }
+
+  /// Returns the number of started workers.
+  int size() const
+  {
+    return _workers.size();
+  }
+
+private:
+
+  /// Serializes tasks posted by different threads.
+  std::mutex _runMutex;
+
+  /// Guards all members below.
+  std::mutex _mutex;
+
+  /// Notifies the workers of a new task or of stop().
+  std::condition_variable _start;
+
+  /// Notifies the posting thread that all workers have finished the task.
+  std::condition_variable _done;
+
+  std::vector<std::thread> _workers;
+
+  const std::function<void(int)>* _task = nullptr;
+
+  /// Number of chunks of the current task.
+  int _chunks = 0;
+
+  /// Number of workers still running the current task.
+  int _pending = 0;
+
+  /// Counts the posted tasks, such that every worker runs each task once.
+  long _generation = 0;
+
+  bool _stopping = false;
+
+  /// Runs the tasks posted after seenGeneration, until stop() is called.
+  void work (
+    int  worker,
+    long seenGeneration )
+  {
+    std::unique_lock<std::mutex> lock(_mutex);
+    while (true){
+      _start.wait(lock, [&](){ return _stopping || _generation != seenGeneration; });
+      if (_stopping){
+        return;
+      }
+      seenGeneration = _generation;
+      if (worker < _chunks){
+        const std::function<void(int)>& task = *_task;
+        lock.unlock();
+        task(worker);
+        lock.lock();
+        _pending--;
+        if (_pending == 0){
+          _done.notify_one();
+        }
+      }
+    }
+  }
+};
+
+Pool pool;
+
+/// True on the thread running parallelFor(), to detect nested loops.
+thread_local bool isInParallelFor = false;
+
+}
+
+logging::Logger Threads:: _log ( "precice::utils::Threads" );
+
+int Threads:: _threads = 1;
+
+void Threads:: setNumberOfThreads
+(
+  int threads )
+{
+  TRACE(threads);
+  assertion(threads >= 0, threads);
+  if (threads == 0){
+    // hardware_concurrency() returns 0, if the number is not computable
+    threads = std::max((int) std::thread::hardware_concurrency(), 1);
+  }
+  _threads = threads;
+  if (pool.size() > _threads - 1){
+    pool.stop();
+  }
+  DEBUG("Using " << _threads << " threads");
+}
+
+int Threads:: getNumberOfThreads()
+{
+  return _threads;
+}
+
+void Threads:: parallelFor
+(
+  int                                     begin,
+  int                                     end,
+  const std::function<void(int,int,int)>& body,
+  int                                     grainSize )
+{
+  assertion(grainSize > 0, grainSize);
+  assertion(not isInParallelFor);
+  int size = end - begin;
+  int chunks = std::min(_threads, size / grainSize);
+  if (chunks <= 1){
+    if (size > 0){
+      body(0, begin, end);
+    }
+    return;
+  }
+
+  std::vector<std::exception_ptr> errors(chunks);
+  auto chunkBegin = [&](int chunk){
+    return begin + (int) ((long long) chunk * size / chunks);
+  };
+  std::function<void(int)> runChunk = [&](int chunk){
+    try {
+      body(chunk, chunkBegin(chunk), chunkBegin(chunk + 1));
+    }
+    catch (...) {
+      errors[chunk] = std::current_exception();
+    }
+  };
+  isInParallelFor = true;
+  pool.run(chunks, runChunk);
+  isInParallelFor = false;
+  for (const std::exception_ptr& error : errors){
+    if (error){
+      std::rethrow_exception(error);
+    }
+  }
+}
+
+}} // namespace precice, utils
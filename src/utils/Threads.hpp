@@ -0,0 +1,57 @@
+#pragma once
+
+#include "logging/Logger.hpp"
+#include <functional>
+
+namespace precice {
+namespace utils {
+
+/**
+ * @brief Runs loops of independent iterations on several threads of one rank.
+ *
+ * The number of threads is set once per process, see the attribute threads of
+ * the solver-interface tag. With one thread, which is the default, all loops
+ * run on the calling thread.
+ *
+ * The worker threads form a pool. They are started by the first parallelFor()
+ * that needs them, wait for further loops in between, and are only joined
+ * when the number of threads is reduced or the process exits.
+ */
+class Threads
+{
+public:
+
+  /// Sets the number of threads, 0 uses one thread per hardware thread.
+  static void setNumberOfThreads ( int threads );
+
+  /// Returns the number of threads used by parallelFor(), at least 1.
+  static int getNumberOfThreads();
+
+  /**
+   * @brief Calls body(thread, chunkBegin, chunkEnd) for consecutive chunks of [begin, end).
+   *
+   * The range is split into at most getNumberOfThreads() chunks of about equal
+   * size, each holding at least grainSize iterations. Ranges of less than two
+   * grain sizes hence run on the calling thread only. The chunk with index
+   * thread is processed by one worker of the pool, chunk 0 by the calling
+   * thread. Returns after all chunks are processed, an exception thrown by
+   * body is rethrown then.
+   *
+   * State written by body has to be either owned by one chunk, e.g., indexed
+   * by thread, or be synchronized. Loops run one after the other, body must
+   * not call parallelFor() itself.
+   */
+  static void parallelFor (
+    int                                     begin,
+    int                                     end,
+    const std::function<void(int,int,int)>& body,
+    int                                     grainSize = 1 );
+
+private:
+
+  static logging::Logger _log;
+
+  static int _threads;
+};
+
+}} // namespace precice, utils
@@ -0,0 +1,143 @@
+#include "ColumnBufferTest.hpp"
+#include "utils/ColumnBuffer.hpp"
+#include "utils/EigenHelperFunctions.hpp"
+#include "utils/Parallel.hpp"
+#include "utils/Globals.hpp"
+
+#include "tarch/tests/TestCaseFactory.h"
+registerTest(precice::utils::tests::ColumnBufferTest)
+
+namespace precice {
+namespace utils {
+namespace tests {
+
+logging::Logger ColumnBufferTest:: _log ( "precice::utils::tests::ColumnBufferTest" );
+
+ColumnBufferTest:: ColumnBufferTest()
+:
+  TestCase ( "utils::tests::ColumnBufferTest" )
+{}
+
+void ColumnBufferTest:: run()
+{
+  PRECICE_MASTER_ONLY {
+    testMethod(testAppendAndShift);
+    testMethod(testRemoveColumn);
+    testMethod(testAssign);
+    testMethod(testShiftFull);
+  }
+}
+
+void ColumnBufferTest:: testAppendAndShift()
+{
+  TRACE();
+  ColumnBuffer buffer;
+  Eigen::MatrixXd reference(3, 0);
+  validateEquals(buffer.cols(), 0);
+
+  // Grows the storage several times, the last additions move the columns
+  // within the storage, since the number of columns is limited to 5.
+  for (int i=0; i < 20; i++){
+    Eigen::VectorXd v = Eigen::VectorXd::Constant(3, (double) i);
+    v(1) = -i;
+    if (reference.cols() < 5){
+      utils::appendFront(reference, v);
+      buffer.appendFront(v);
+    }
+    else {
+      utils::shiftSetFirst(reference, v);
+      buffer.shiftSetFirst(v);
+    }
+    validateEquals(buffer.rows(), 3);
+    validateEquals(buffer.cols(), reference.cols());
+    validate(buffer.matrix() == reference);
+    validate(buffer.col(0) == v);
+  }
+
+  buffer.clear();
+  validateEquals(buffer.rows(), 0);
+  validateEquals(buffer.cols(), 0);
+}
+
+void ColumnBufferTest:: testRemoveColumn()
+{
+  TRACE();
+  ColumnBuffer buffer;
+  Eigen::MatrixXd reference(2, 0);
+  for (int i=0; i < 7; i++){
+    Eigen::VectorXd v = Eigen::VectorXd::Constant(2, (double) i);
+    utils::appendFront(reference, v);
+    buffer.appendFront(v);
+  }
+
+  // Removes from the front, the back and the middle of both halves.
+  int columns[] = { 0, 5, 1, 2, 1 };
+  for (int col : columns){
+    utils::removeColumnFromMatrix(reference, col);
+    buffer.removeColumn(col);
+    validateEquals(buffer.cols(), reference.cols());
+    validate(buffer.matrix() == reference);
+  }
+
+  // Adds columns after the removals, which requires to move the columns.
+  for (int i=7; i < 12; i++){
+    Eigen::VectorXd v = Eigen::VectorXd::Constant(2, (double) i);
+    utils::appendFront(reference, v);
+    buffer.appendFront(v);
+    validate(buffer.matrix() == reference);
+  }
+}
+
+void ColumnBufferTest:: testAssign()
+{
+  TRACE();
+  Eigen::MatrixXd matrix(2, 3);
+  matrix << 1.0, 2.0, 3.0,
+            4.0, 5.0, 6.0;
+  ColumnBuffer buffer;
+  buffer = matrix;
+  validateEquals(buffer.rows(), 2);
+  validateEquals(buffer.cols(), 3);
+  validate(buffer.matrix() == matrix);
+
+  Eigen::VectorXd v(2);
+  v << 7.0, 8.0;
+  buffer.appendFront(v);
+  validateEquals(buffer.cols(), 4);
+  validate(buffer.col(0) == v);
+  validate(buffer.matrix().rightCols(3) == matrix);
+
+  // Assigning an empty matrix keeps the number of rows.
+  buffer = Eigen::MatrixXd::Zero(2, 0);
+  validateEquals(buffer.rows(), 2);
+  validateEquals(buffer.cols(), 0);
+}
+
+void ColumnBufferTest:: testShiftFull()
+{
+  TRACE();
+  int rows = 2;
+  int cols = 8;
+  Eigen::MatrixXd reference = Eigen::MatrixXd::Random(rows, cols);
+  ColumnBuffer buffer;
+  buffer = reference;
+
+  // Without a move, the logical matrix starts one column further left after a shift
+  int shifts = 100;
+  int moves = 0;
+  const double* first = buffer.matrix().data();
+  for (int i=0; i < shifts; i++){
+    Eigen::VectorXd v = Eigen::VectorXd::Constant(rows, (double) i);
+    utils::shiftSetFirst(reference, v);
+    buffer.shiftSetFirst(v);
+    validate(buffer.matrix() == reference);
+    if (buffer.matrix().data() != first - rows){
+      moves++;
+    }
+    first = buffer.matrix().data();
+  }
+  // The columns are moved once every cols - 1 shifts at most
+  validateWithMessage(moves <= shifts / (cols - 1) + 1, moves);
+}
+
+}}} // namespace precice, utils, tests
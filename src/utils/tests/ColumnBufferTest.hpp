@@ -0,0 +1,43 @@
+#ifndef PRECICE_UTILS_COLUMNBUFFERTEST_HPP_
+#define PRECICE_UTILS_COLUMNBUFFERTEST_HPP_
+
+#include "tarch/tests/TestCase.h"
+#include "logging/Logger.hpp"
+
+namespace precice {
+namespace utils {
+namespace tests {
+
+/**
+ * Provides tests for class utils::ColumnBuffer.
+ */
+class ColumnBufferTest : public tarch::tests::TestCase
+{
+public:
+
+  ColumnBufferTest();
+
+  virtual ~ColumnBufferTest() {}
+
+  virtual void setUp() {}
+
+  virtual void run();
+
+private:
+
+  static logging::Logger _log;
+
+  /// Compares appendFront() and shiftSetFirst() with the Eigen helper functions.
+  void testAppendAndShift();
+
+  void testRemoveColumn();
+
+  void testAssign();
+
+  /// Shifts an assigned, hence full, matrix and counts how often the columns are moved.
+  void testShiftFull();
+};
+
+}}} // namespace precice, utils, tests
+
+#endif /* PRECICE_UTILS_COLUMNBUFFERTEST_HPP_ */
@@ -0,0 +1,109 @@
+#include "EventTimingsTest.hpp"
+#include "utils/EventTimings.hpp"
+#include "utils/Parallel.hpp"
+#include "utils/Globals.hpp"
+#include <fstream>
+#include <set>
+#include <sstream>
+#include <thread>
+
+#include "tarch/tests/TestCaseFactory.h"
+registerTest(precice::utils::tests::EventTimingsTest)
+
+namespace precice {
+namespace utils {
+namespace tests {
+
+logging::Logger EventTimingsTest:: _log ( "precice::utils::tests::EventTimingsTest" );
+
+EventTimingsTest:: EventTimingsTest()
+:
+  TestCase ( "utils::tests::EventTimingsTest" )
+{}
+
+void EventTimingsTest:: run()
+{
+  PRECICE_MASTER_ONLY {
+    testMethod(testThreads);
+    testMethod(testTrace);
+  }
+}
+
+void EventTimingsTest:: testThreads()
+{
+  TRACE();
+  EventRegistry::clear();
+  int id = EventRegistry::getID("EventTimingsTest.outer");
+  validateEquals(EventRegistry::getID("EventTimingsTest.outer"), id);
+  validate(EventRegistry::getName(id) == "EventTimingsTest.outer");
+
+  int innerID = EventRegistry::getID("EventTimingsTest.inner");
+  auto record = [innerID](){
+    for (int i=0; i < 10; i++){
+      Event outer("EventTimingsTest.outer", true);
+      Event inner(innerID);
+      inner.stop();
+    }
+  };
+  // The barriers are skipped, since sync mode is off
+  validate(not EventRegistry::isSyncMode());
+  EventRegistry::setTracing(true);
+  std::thread thread(record);
+  record();
+  thread.join();
+  EventRegistry::setTracing(false);
+
+  // IDs are the same on all threads
+  int otherID = -1;
+  std::thread other([&otherID](){ otherID = EventRegistry::getID("EventTimingsTest.inner"); });
+  other.join();
+  validateEquals(otherID, innerID);
+
+  EventRegistry::writeTrace("utils-EventTimingsTest-testThreads.json");
+  std::ifstream in("utils-EventTimingsTest-testThreads.json");
+  std::string line;
+  int outer = 0;
+  int inner = 0;
+  std::set<std::string> threads;
+  while (std::getline(in, line)){
+    if (line.find("\"EventTimingsTest.outer\"") != std::string::npos){
+      outer++;
+      size_t tid = line.find("\"tid\"");
+      threads.insert(line.substr(tid, line.find(',', tid) - tid));
+    }
+    if (line.find("\"EventTimingsTest.inner\"") != std::string::npos){
+      inner++;
+    }
+  }
+  validateEquals(outer, 20);
+  validateEquals(inner, 20);
+  validateEquals(threads.size(), 2);
+  EventRegistry::clear();
+}
+
+void EventTimingsTest:: testTrace()
+{
+  TRACE();
+  EventRegistry::clear();
+  EventRegistry::setTracing(true);
+  {
+    Event outer("EventTimingsTest.\"quoted\"");
+    Event inner("EventTimingsTest.inner");
+  }
+  EventRegistry::setTracing(false);
+  Event untraced("EventTimingsTest.untraced");
+  untraced.stop();
+
+  EventRegistry::writeTrace("utils-EventTimingsTest-testTrace.json");
+  std::ifstream in("utils-EventTimingsTest-testTrace.json");
+  std::stringstream content;
+  content << in.rdbuf();
+  std::string trace = content.str();
+  validateWithMessage(trace.find("\"traceEvents\"") != std::string::npos, trace);
+  validateWithMessage(trace.find("\"name\": \"EventTimingsTest.\\\"quoted\\\"\", \"ph\": \"X\"") != std::string::npos, trace);
+  validateWithMessage(trace.find("\"name\": \"EventTimingsTest.inner\"") != std::string::npos, trace);
+  validateWithMessage(trace.find("untraced") == std::string::npos, trace);
+  EventRegistry::clear();
+}
+
+}}} // namespace precice, utils, tests
@@ -0,0 +1,39 @@
+#ifndef PRECICE_UTILS_EVENTTIMINGSTEST_HPP_
+#define PRECICE_UTILS_EVENTTIMINGSTEST_HPP_
+
+#include "tarch/tests/TestCase.h"
+#include "logging/Logger.hpp"
+
+namespace precice {
+namespace utils {
+namespace tests {
+
+/**
+ * Provides tests for class utils::EventRegistry.
+ */
+class EventTimingsTest : public tarch::tests::TestCase
+{
+public:
+
+  EventTimingsTest();
+
+  virtual ~EventTimingsTest() {}
+
+  virtual void setUp() {}
+
+  virtual void run();
+
+private:
+
+  static logging::Logger _log;
+
+  /// Records nested events in two threads and checks the aggregated counts.
+  void testThreads();
+
+  /// Checks the trace file written for recorded events.
+  void testTrace();
+};
+
+}}} // namespace precice, utils, tests
+
+#endif /* PRECICE_UTILS_EVENTTIMINGSTEST_HPP_ */
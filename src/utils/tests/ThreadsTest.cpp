@@ -0,0 +1,134 @@
+#include "ThreadsTest.hpp"
+#include "../Threads.hpp"
+#include "utils/Parallel.hpp"
+#include <algorithm>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+#include "tarch/tests/TestCaseFactory.h"
+registerTest(precice::utils::tests::ThreadsTest)
+
+namespace precice {
+namespace utils {
+namespace tests {
+
+logging::Logger ThreadsTest:: _log("precice::utils::tests::ThreadsTest");
+
+ThreadsTest:: ThreadsTest()
+:
+  TestCase("utils::ThreadsTest")
+{}
+
+void ThreadsTest:: run()
+{
+  PRECICE_MASTER_ONLY {
+    testMethod(testParallelFor);
+    testMethod(testGrainSize);
+    testMethod(testPool);
+    testMethod(testException);
+  }
+}
+
+void ThreadsTest:: testParallelFor()
+{
+  TRACE();
+  for (int threads : {1, 3, 8}){
+    Threads::setNumberOfThreads(threads);
+    validateEquals(Threads::getNumberOfThreads(), threads);
+    for (int size : {0, 2, 1000}){
+      std::vector<int> visits(size + 10, 0);
+      std::vector<int> chunks(size + 10, -1);
+      Threads::parallelFor(10, size + 10, [&](int thread, int begin, int end){
+        for (int i=begin; i < end; i++){
+          visits[i]++;
+          chunks[i] = thread;
+        }
+      });
+      for (int i=0; i < 10; i++){
+        validateEquals(visits[i], 0);
+      }
+      for (int i=10; i < size + 10; i++){
+        validateEquals(visits[i], 1);
+        if (i > 10){
+          validate(chunks[i] == chunks[i-1] || chunks[i] == chunks[i-1] + 1);
+        }
+      }
+      if (size > 0){
+        validateEquals(chunks[10], 0);
+        validateEquals(chunks[size + 9], std::min(threads, size) - 1);
+      }
+    }
+  }
+  Threads::setNumberOfThreads(0);
+  validate(Threads::getNumberOfThreads() >= 1);
+  Threads::setNumberOfThreads(1);
+}
+
+void ThreadsTest:: testGrainSize()
+{
+  TRACE();
+  Threads::setNumberOfThreads(4);
+  for (int size : {10, 99, 100, 250, 1000}){
+    std::vector<int> sizes(4, 0);
+    Threads::parallelFor(0, size, [&](int thread, int begin, int end){
+      sizes[thread] = end - begin;
+    }, 50);
+    int chunks = std::max(std::min(4, size / 50), 1);
+    for (int thread=0; thread < chunks; thread++){
+      validate(sizes[thread] >= std::min(size, 50));
+    }
+    for (int thread=chunks; thread < 4; thread++){
+      validateEquals(sizes[thread], 0);
+    }
+  }
+  Threads::setNumberOfThreads(1);
+}
+
+void ThreadsTest:: testPool()
+{
+  TRACE();
+  Threads::setNumberOfThreads(3);
+  std::vector<std::thread::id> first(3);
+  Threads::parallelFor(0, 3, [&](int thread, int begin, int end){
+    first[thread] = std::this_thread::get_id();
+  });
+  validate(first[0] == std::this_thread::get_id());
+  validate(first[1] != first[0] && first[2] != first[0] && first[1] != first[2]);
+  for (int run=0; run < 100; run++){
+    std::vector<std::thread::id> ids(3);
+    Threads::parallelFor(0, 3, [&](int thread, int begin, int end){
+      ids[thread] = std::this_thread::get_id();
+    });
+    validate(ids == first);
+  }
+  // Fewer chunks than workers leave the remaining workers idle
+  std::vector<std::thread::id> ids(3);
+  Threads::parallelFor(0, 2, [&](int thread, int begin, int end){
+    ids[thread] = std::this_thread::get_id();
+  });
+  validate(ids[0] == first[0] && ids[1] == first[1]);
+  validate(ids[2] == std::thread::id());
+  Threads::setNumberOfThreads(1);
+}
+
+void ThreadsTest:: testException()
+{
+  TRACE();
+  Threads::setNumberOfThreads(4);
+  bool caught = false;
+  try {
+    Threads::parallelFor(0, 100, [](int thread, int begin, int end){
+      if (thread == 2){
+        throw std::runtime_error("error in chunk");
+      }
+    });
+  }
+  catch (const std::runtime_error& error){
+    caught = true;
+  }
+  validate(caught);
+  Threads::setNumberOfThreads(1);
+}
+
+}}} // namespace precice, utils, tests
@@ -0,0 +1,42 @@
+#pragma once
+
+#include "tarch/tests/TestCase.h"
+#include "logging/Logger.hpp"
+
+namespace precice {
+namespace utils {
+namespace tests {
+
+/**
+ * @brief Provides tests for class utils::Threads.
+ */
+class ThreadsTest : public tarch::tests::TestCase
+{
+public:
+
+  ThreadsTest();
+
+  virtual ~ThreadsTest() {}
+
+  virtual void setUp() {}
+
+  virtual void run();
+
+private:
+
+  static logging::Logger _log;
+
+  /// Tests that every index is visited once, in consecutive chunks.
+  void testParallelFor();
+
+  /// Tests that no chunk gets less than the grain size.
+  void testGrainSize();
+
+  /// Tests that consecutive loops run on the same worker threads.
+  void testPool();
+
+  /// Tests that an exception thrown in a chunk is rethrown by parallelFor.
+  void testException();
+};
+
+}}} // namespace precice, utils, tests